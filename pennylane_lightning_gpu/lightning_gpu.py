@@ -15,7 +15,7 @@ r"""
 This module contains the :class:`~.LightningGPU` class, a PennyLane simulator device that
 interfaces with the NVIDIA cuQuantum cuStateVec simulator library for GPU-enabled calculations.
 """
-from typing import List, Union
+from typing import List, Optional, Union
 from warnings import warn
 from itertools import product
 
@@ -55,7 +55,10 @@ try:
         LightningGPU_C64,
         AdjointJacobianGPU_C128,
         AdjointJacobianGPU_C64,
+        CompiledCircuitGPU_C128,
+        CompiledCircuitGPU_C64,
         device_reset,
+        gate_opcodes,
         is_gpu_supported,
         get_gpu_arch,
         DevPool,
@@ -99,6 +102,13 @@ def _gpu_dtype(dtype):
     return LightningGPU_C128 if dtype == np.complex128 else LightningGPU_C64
 
 
+def _compiled_circuit_dtype(dtype):
+    "Utility to choose the appropriate compiled circuit type based on state-vector precision"
+    if dtype not in [np.complex128, np.complex64]:
+        raise ValueError(f"Data type is not supported for state-vector computation: {dtype}")
+    return CompiledCircuitGPU_C128 if dtype == np.complex128 else CompiledCircuitGPU_C64
+
+
 def _H_dtype(dtype):
     "Utility to choose the appropriate H type based on state-vector precision"
     if dtype not in [np.complex128, np.complex64]:
@@ -175,6 +185,29 @@ if CPP_BINARY_AVAILABLE:
             wires (int): the number of wires to initialize the device with
             sync (bool): immediately sync with host-sv after applying operations
             c_dtype: Datatypes for statevector representation. Must be one of ``np.complex64`` or ``np.complex128``.
+            gate_fusion (int): maximum number of wires of a fused gate block. Consecutive gates acting
+                on at most this many wires are merged into a single matrix before being applied.
+                A value of 0 (default) disables gate fusion.
+            gate_cache_bytes (int): device memory budget in bytes for cached parametric gates.
+                Least recently used gates are evicted once it is exceeded. Uses the default
+                budget of the gate cache if not provided.
+            adjoint_memory_bytes (int): device memory budget in bytes per GPU for the adjoint
+                Jacobian. When the state-vector copies of all observables do not fit, the
+                observables are processed in tiles sized to the budget. Unbounded if not provided.
+            pauli_grouping (bool): measure the Pauli words of large Hamiltonians in groups of
+                qubit-wise-commuting words, with one basis rotation and probability pass per group
+                instead of one pass over the state per word. Needs a scratch copy of the state.
+            seed (int): seed of the random numbers used for sampling. Devices with the same seed
+                draw the same samples for the same circuits. Seeded from the system entropy if not
+                provided.
+            compile_circuits (bool): compile the structure of applied circuits once and replay it
+                with new parameters while the gates, wires and explicit matrices stay the same, as
+                in training loops. Gates without parameters are fused as set by ``gate_fusion``.
+                Parametric gates then bypass the gate cache.
+            cuda_graph (bool): compile applied circuits as with ``compile_circuits`` and replay them
+                as a CUDA graph, captured once per circuit structure, with a single launch instead
+                of one kernel launch per gate. Pays off for circuits of many small gates, where
+                launch latency dominates. Gates may act on at most 6 target wires.
         """
 
         name = "PennyLane plugin for GPU-backed Lightning device using NVIDIA cuQuantum SDK"
@@ -183,6 +216,8 @@ if CPP_BINARY_AVAILABLE:
         version = __version__
         author = "Xanadu Inc."
         _CPP_BINARY_AVAILABLE = True
+        # Opcodes of the gates applied natively by ``apply_tape``
+        _gate_opcodes = gate_opcodes()
 
         operations = allowed_operations
         observables = {
@@ -203,6 +238,13 @@ if CPP_BINARY_AVAILABLE:
             c_dtype=np.complex128,
             shots=None,
             batch_obs: Union[bool, int] = False,
+            gate_fusion: int = 0,
+            gate_cache_bytes: Optional[int] = None,
+            adjoint_memory_bytes: Optional[int] = None,
+            pauli_grouping: bool = True,
+            seed: Optional[int] = None,
+            compile_circuits: bool = False,
+            cuda_graph: bool = False,
         ):
             if c_dtype is np.complex64:
                 r_dtype = np.float32
@@ -218,11 +260,50 @@ if CPP_BINARY_AVAILABLE:
             self._sync = sync
             self._dp = DevPool()
             self._batch_obs = batch_obs
+            self._gpu_state.setGateFusion(gate_fusion)
+            if gate_cache_bytes is not None:
+                self._gpu_state.setGateCacheCapacity(gate_cache_bytes)
+            self._adjoint_memory_bytes = adjoint_memory_bytes
+            self._pauli_grouping = pauli_grouping
+            if seed is not None:
+                self._gpu_state.setSeed(seed)
+            # (sparse matrix, native observable) of the last SparseHamiltonian measured
+            self._sparse_ham_cache = None
+            # (unpacked samples, packed samples) of the last call to generate_samples
+            self._packed_samples = None
+            self._gate_fusion = gate_fusion
+            self._compile_circuits = compile_circuits or cuda_graph
+            self._cuda_graph = cuda_graph
+            # (structure, compiled circuit) of the last circuit applied
+            self._compiled_circuit = None
+
+        @property
+        def gate_cache_stats(self):
+            """Hit, miss and eviction counters and memory usage of the device gate cache.
+
+            Returns:
+                dict: with keys ``"hits"``, ``"misses"``, ``"evictions"``, ``"num_gates"``,
+                ``"allocated_bytes"`` and ``"capacity_bytes"``
+            """
+            return self._gpu_state.getGateCacheStats()
+
+        def _native_sparse_hamiltonian(self, observable):
+            """Return the native form of a ``SparseHamiltonian``, reusing the one built for the
+            previous measurement of the same sparse matrix. The native observable keeps its matrix
+            resident on the GPU, so repeated measurements do not transfer it again."""
+            sparse_matrix = observable.data[0]
+            if self._sparse_ham_cache is None or self._sparse_ham_cache[0] is not sparse_matrix:
+                self._sparse_ham_cache = (
+                    sparse_matrix,
+                    _serialize_ob(observable, self.wire_map, self.use_csingle),
+                )
+            return self._sparse_ham_cache[1]
 
         def reset(self):
             super().reset()
+            self._packed_samples = None
             # init the state vector to |00..0>
-            self._gpu_state.resetGPU(False)  # Sync reset
+            self._gpu_state.resetGPU(True)  # Enqueued on the device stream
 
         @property
         def state(self):
@@ -238,12 +319,15 @@ if CPP_BINARY_AVAILABLE:
             self.syncD2H(state)
             return state
 
-        def syncD2H(self, state_vector, use_async=False):
+        def syncD2H(self, state_vector, use_async=False, transfer_mode="auto"):
             """Copy the state vector data on device to a state vector on the host provided by the user
             Args:
                 state_vector(array[complex]): the state vector array on host
                 use_async(bool): indicates whether to use asynchronous memory copy from host to device or not.
                 Note: This function only supports synchronized memory copy.
+                transfer_mode(str): ``"direct"`` copies in a single call, ``"staged"`` pipelines
+                chunks through pinned buffers, and ``"registered"`` page-locks ``state_vector``
+                for the copy. ``"auto"`` stages large arrays and copies others directly.
 
             **Example**
             >>> dev = qml.device('lightning.gpu', wires=1)
@@ -253,14 +337,17 @@ if CPP_BINARY_AVAILABLE:
             >>> print(state_vector)
             [0.+0.j 1.+0.j]
             """
-            self._gpu_state.DeviceToHost(state_vector.ravel(order="C"), use_async)
+            self._gpu_state.DeviceToHost(state_vector.ravel(order="C"), use_async, transfer_mode)
 
-        def syncH2D(self, state_vector, use_async=False):
+        def syncH2D(self, state_vector, use_async=False, transfer_mode="auto"):
             """Copy the state vector data on host provided by the user to the state vector on the device
             Args:
                 state_vector(array[complex]): the state vector array on host.
                 use_async(bool): indicates whether to use asynchronous memory copy from host to device or not.
                 Note: This function only supports synchronized memory copy.
+                transfer_mode(str): ``"direct"`` copies in a single call, ``"staged"`` pipelines
+                chunks through pinned buffers, and ``"registered"`` page-locks ``state_vector``
+                for the copy. ``"auto"`` stages large arrays and copies others directly.
 
             **Example**
             >>> dev = qml.device('lightning.gpu', wires=3)
@@ -274,14 +361,78 @@ if CPP_BINARY_AVAILABLE:
             >>> print(res)
             1.0
             """
-            self._gpu_state.HostToDevice(state_vector.ravel(order="C"), use_async)
+            self._gpu_state.HostToDevice(state_vector.ravel(order="C"), use_async, transfer_mode)
+
+        def syncD2D(self, device_array):
+            """Copy a state vector held in device memory into the state vector of the device, without
+            staging through the host
+            Args:
+                device_array: a contiguous device array exposing ``__cuda_array_interface__``, such
+                as a CuPy array or a PyTorch CUDA tensor, with the precision of the device.
 
-        def _create_basis_state_GPU(self, index, use_async=False):
+            The copy is ordered after the pending work on the stream reported by ``device_array``,
+            and is complete on return.
+
+            **Example**
+            >>> dev = qml.device('lightning.gpu', wires=1)
+            >>> obj = cupy.array([0, 1], dtype=cupy.complex128)
+            >>> dev.syncD2D(obj)
+            >>> print(dev.state)
+            [0.+0.j 1.+0.j]
+            """
+            self._gpu_state.DeviceToDevice(device_array)
+
+        def synchronize(self):
+            """Block until the operations enqueued on the device have completed.
+
+            Gates are enqueued on the stream of the device and ``apply`` returns without waiting for
+            them. Results returned to the host, such as expectation values, probabilities, samples
+            or the state, wait for the enqueued operations, so an explicit synchronization is only
+            needed to time the device or to overlap host work with a circuit.
+
+            **Example**
+            >>> dev = qml.device('lightning.gpu', wires=20)
+            >>> dev.apply([qml.Hadamard(wires=i) for i in range(20)])
+            >>> dev.synchronize()
+            >>> dev.query()
+            True
+            """
+            self._gpu_state.synchronize()
+
+        def query(self):
+            """Check without blocking whether the operations enqueued on the device have completed.
+
+            Returns:
+                bool: ``True`` if the device is done with the enqueued operations
+            """
+            return self._gpu_state.query()
+
+        @property
+        def gpu_state(self):
+            """The native state vector, exposing its device buffer through the DLPack
+            (``__dlpack__``) and ``__cuda_array_interface__`` protocols.
+
+            Views created with ``cupy.asarray``, ``cupy.from_dlpack`` or ``torch.from_dlpack`` alias
+            the state vector without a copy, keep it alive, and see the operations applied to the
+            device afterwards. ``__dlpack__`` orders the pending work on the state vector before the
+            stream requested by the consumer. After writing to the state through such a view, call
+            ``markStateChanged()`` so that the next samples are not drawn from the previous state.
+
+            **Example**
+            >>> dev = qml.device('lightning.gpu', wires=2)
+            >>> dev.apply([qml.Hadamard(wires=0)])
+            >>> state = cupy.from_dlpack(dev.gpu_state)
+            >>> print(cupy.abs(state) ** 2)
+            [0.5 0.  0.5 0. ]
+            """
+            return self._gpu_state
+
+        def _create_basis_state_GPU(self, index, use_async=True):
             """Return a computational basis state over all wires.
             Args:
                 index (int): integer representing the computational basis state.
-                use_async(bool): indicates whether to use asynchronous memory copy from host to device or not.
-                Note: This function only supports synchronized memory copy.
+                use_async(bool): indicates whether to return without waiting for the state to be
+                written. The writes are ordered before the gates applied afterwards.
             """
             self._gpu_state.setBasisState(index, use_async)
 
@@ -293,7 +444,7 @@ if CPP_BINARY_AVAILABLE:
                  or broadcasted state of shape ``(batch_size, 2**len(wires))``
             device_wires (Wires): wires that get initialized in the state
             use_async(bool): indicates whether to use asynchronous memory copy from host to device or not.
-            Note: This function only supports synchronized memory copy from host to device.
+            Asynchronous copies are staged through pinned memory on the device stream.
             """
             # translate to wire labels used by device
             device_wires = self.map_wires(device_wires)
@@ -410,7 +561,11 @@ if CPP_BINARY_AVAILABLE:
             # Skip over identity operations instead of performing
             # matrix multiplication with the identity.
             skipped_ops = ["Identity"]
-            invert_param = False
+            matrix_opcode = self._gate_opcodes["Matrix"]
+            # The circuit is packed into flat arrays and applied by a single native call,
+            # which folds runs of diagonal gates and, if enabled, fuses gates
+            opcodes, wire_offsets, wires, params, inverses, matrices = [], [0], [], [], [], []
+            names = []
 
             for o in operations:
                 if o.base_name in skipped_ops:
@@ -418,14 +573,13 @@ if CPP_BINARY_AVAILABLE:
                 name = o.name.split(".")[
                     0
                 ]  # The split is because inverse gates have .inv appended. To be updated with upcoming deprecation.
+                inv = o.inverse
                 if "Adjoint" in name:
                     name = name.split("(")[1].split(")")[0]
-                    invert_param = True
-                method = getattr(self._gpu_state, name, None)
+                    inv = True  # Account for Adjoint
+                opcode = self._gate_opcodes.get(name, matrix_opcode)
 
-                wires = self.wires.indices(o.wires)
-
-                if method is None:
+                if opcode == matrix_opcode:
                     # Inverse can be set to False since qml.matrix(o) is already in inverted form
                     try:
                         mat = qml.matrix(o)
@@ -435,18 +589,65 @@ if CPP_BINARY_AVAILABLE:
 
                     if len(mat) == 0:
                         raise Exception("Unsupported operation")
-                    self._gpu_state.apply(
-                        name,
-                        wires,
-                        False,
-                        [],
-                        mat.ravel(order="C"),  # inv = False: Matrix already in correct form;
-                    )  # Parameters can be ignored for explicit matrices; F-order for cuQuantum
-
+                    matrices.append(np.ravel(mat, order="C"))
+                    inv = False
                 else:
-                    inv = o.inverse or invert_param  # Account for Adjoint
-                    param = o.parameters
-                    method(wires, inv, param)
+                    params.extend(o.parameters)
+
+                opcodes.append(opcode)
+                names.append(name)
+                wires.extend(self.wires.indices(o.wires))
+                wire_offsets.append(len(wires))
+                inverses.append(inv)
+
+            if not opcodes:
+                return
+            if self._compile_circuits:
+                self._apply_compiled(
+                    names, opcodes, wire_offsets, wires, params, inverses, matrices
+                )
+                return
+            self._gpu_state.apply_tape(
+                np.array(opcodes, dtype=np.uint8),
+                np.array(wire_offsets, dtype=np.uintp),
+                np.array(wires, dtype=np.uintp),
+                np.array(params, dtype=self.R_DTYPE),
+                np.array(inverses, dtype=bool),
+                np.concatenate(matrices) if matrices else np.empty(0, dtype=self.C_DTYPE),
+            )
+
+        def _apply_compiled(self, names, opcodes, wire_offsets, wires, params, inverses, matrices):
+            """Apply a circuit packed by ``apply_cq`` through a compiled circuit, compiling it only
+            when its structure differs from the previous circuit."""
+            matrix_opcode = self._gate_opcodes["Matrix"]
+            # Explicit matrices are fixed by the compilation, so they are part of the structure
+            structure = (
+                tuple(names),
+                tuple(wire_offsets),
+                tuple(wires),
+                tuple(inverses),
+                tuple(mat.tobytes() for mat in matrices),
+            )
+            if self._compiled_circuit is None or self._compiled_circuit[0] != structure:
+                op_matrices = iter(matrices)
+                empty_matrix = np.empty(0, dtype=self.C_DTYPE)
+                circuit = _compiled_circuit_dtype(self.C_DTYPE)(
+                    self.num_wires,
+                    names,
+                    [wires[start:end] for start, end in zip(wire_offsets[:-1], wire_offsets[1:])],
+                    inverses,
+                    [
+                        np.asarray(next(op_matrices), dtype=self.C_DTYPE)
+                        if opcode == matrix_opcode
+                        else empty_matrix
+                        for opcode in opcodes
+                    ],
+                    self._gate_fusion,
+                )
+                self._compiled_circuit = (structure, circuit)
+            circuit = self._compiled_circuit[1]
+            execute = circuit.executeGraph if self._cuda_graph else circuit.execute
+            execute(self._gpu_state, np.array(params, dtype=self.R_DTYPE))
 
         def apply(self, operations, **kwargs):
             # State preparation is currently done in Python
@@ -529,22 +730,14 @@ if CPP_BINARY_AVAILABLE:
                         'the "adjoint" differentiation method'
                     )
 
-        def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
-            if self.shots is not None:
-                warn(
-                    "Requested adjoint differentiation to be computed with finite shots."
-                    " The derivative is always exact when using the adjoint differentiation method.",
-                    UserWarning,
-                )
-
-            tape_return_type = self._check_adjdiff_supported_measurements(tape.measurements)
-
-            if len(tape.trainable_params) == 0:
-                return np.array(0)
-
-            # Check adjoint diff support
-            self._check_adjdiff_supported_operations(tape.operations)
+        def _adjoint_setup(self, tape, starting_state, use_device_state):
+            """Prepare the forward state and serialize a tape for the adjoint method.
 
+            Returns:
+                tuple: the C++ adjoint object, the serialized observables and their offsets, the
+                serialized operations, the trainable parameters of the serialized operations, the
+                output positions of these parameters, and the number of output parameters.
+            """
             # Initialization of state
             if starting_state is not None:
                 ket = np.ravel(starting_state, order="C")
@@ -558,6 +751,8 @@ if CPP_BINARY_AVAILABLE:
                 ket = ket.astype(np.complex64)
             else:
                 adj = AdjointJacobianGPU_C128()
+            if self._adjoint_memory_bytes is not None:
+                adj.setMemoryBudget(self._adjoint_memory_bytes)
 
             obs_serialized, obs_offsets = _serialize_observables(
                 tape, self.wire_map, use_csingle=self.use_csingle
@@ -589,6 +784,42 @@ if CPP_BINARY_AVAILABLE:
                 # whether there must be only one state preparation...
                 tp_shift = [i - 1 for i in tp_shift]
 
+            return (
+                adj,
+                obs_serialized,
+                obs_offsets,
+                ops_serialized,
+                tp_shift,
+                record_tp_rows,
+                all_params,
+            )
+
+        def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
+            if self.shots is not None:
+                warn(
+                    "Requested adjoint differentiation to be computed with finite shots."
+                    " The derivative is always exact when using the adjoint differentiation method.",
+                    UserWarning,
+                )
+
+            tape_return_type = self._check_adjdiff_supported_measurements(tape.measurements)
+
+            if len(tape.trainable_params) == 0:
+                return np.array(0)
+
+            # Check adjoint diff support
+            self._check_adjdiff_supported_operations(tape.operations)
+
+            (
+                adj,
+                obs_serialized,
+                obs_offsets,
+                ops_serialized,
+                tp_shift,
+                record_tp_rows,
+                all_params,
+            ) = self._adjoint_setup(tape, starting_state, use_device_state)
+
             """
             This path enables controlled batching over the requested observables, be they explicit, or part of a Hamiltonian.
             The traditional path will assume there exists enough free memory to preallocate all arrays and run through each observable iteratively.
@@ -661,32 +892,102 @@ if CPP_BINARY_AVAILABLE:
                         "The vjp method only works with a real-valued dy when the tape is returning an expectation value"
                     )
 
-                ham = qml.Hamiltonian(dy, [m.obs for m in measurements])
-
                 def processing_fn(tape):
-                    nonlocal ham
                     num_params = len(tape.trainable_params)
 
                     if num_params == 0:
-                        return np.array([], dtype=c_dtype)
+                        return np.array([], dtype=self.C_DTYPE)
+
+                    # Check adjoint diff support
+                    self._check_adjdiff_supported_operations(tape.operations)
 
                     new_tape = tape.copy()
-                    new_tape._measurements = [qml.expval(ham)]
+                    new_tape._measurements = list(measurements)
+
+                    (
+                        adj,
+                        obs_serialized,
+                        obs_offsets,
+                        ops_serialized,
+                        tp_shift,
+                        record_tp_rows,
+                        all_params,
+                    ) = self._adjoint_setup(new_tape, starting_state, use_device_state)
+
+                    # Hamiltonians are serialized term by term, with each term carrying its
+                    # coefficient, so their terms share the cotangent of the Hamiltonian
+                    dy_serialized = np.repeat(
+                        np.asarray(math.toarray(dy), dtype=self.R_DTYPE), np.diff(obs_offsets)
+                    )
+
+                    # The observables are contracted with dy on the device, so that a single
+                    # backward pass is run whatever the number of observables
+                    vjp = adj.vector_jacobian_product(
+                        self._gpu_state,
+                        obs_serialized,
+                        ops_serialized,
+                        tp_shift,
+                        dy_serialized,
+                    )
 
-                    return self.adjoint_jacobian(
-                        new_tape, starting_state, use_device_state
-                    ).reshape(-1)
+                    vjp_r = np.zeros(all_params)
+                    vjp_r[record_tp_rows] = vjp
+                    return vjp_r
 
                 return processing_fn
 
         def sample(self, observable, shot_range=None, bin_size=None, counts=False):
             if observable.name != "PauliZ":
                 self.apply_cq(observable.diagonalizing_gates())
+                if counts and shot_range is None and bin_size is None:
+                    # Counted on the device, without transferring one sample per shot
+                    outcomes, frequencies = self._gpu_state.GenerateCounts(self.shots)
+                    return self._counts_to_dict(observable, outcomes, frequencies)
                 self._samples = self.generate_samples()
+            elif counts and bin_size is None:
+                packed = self._current_packed_samples()
+                if packed is not None:
+                    sample_slice = Ellipsis if shot_range is None else slice(*shot_range)
+                    outcomes, frequencies = np.unique(packed[sample_slice], return_counts=True)
+                    return self._counts_to_dict(observable, outcomes, frequencies)
             return super().sample(
                 observable, shot_range=shot_range, bin_size=bin_size, counts=counts
             )
 
+        def _current_packed_samples(self):
+            """Packed form of ``self._samples``, or ``None`` if the samples were not drawn by
+            :meth:`generate_samples`."""
+            if self._packed_samples is None or self._packed_samples[0] is not self._samples:
+                return None
+            return self._packed_samples[1]
+
+        def _select_wires(self, packed, device_wires):
+            """Basis-state indices of the given device wires, from packed samples of all
+            wires."""
+            num_wires = len(self.wires)
+            indices = np.zeros_like(packed)
+            for wire in device_wires:
+                indices = (indices << 1) | ((packed >> (num_wires - 1 - wire)) & 1)
+            return indices
+
+        def _counts_to_dict(self, observable, outcomes, frequencies):
+            """Counts dictionary of an observable, from the distinct packed samples drawn and
+            their frequencies, keyed like :meth:`~.QubitDevice.sample` with ``counts=True``."""
+            device_wires = self.map_wires(observable.wires)
+            if isinstance(observable, MeasurementProcess):
+                # No observable provided: count the bitstrings of the measured wires
+                wires = device_wires if len(observable.wires) != 0 else range(len(self.wires))
+                indices = self._select_wires(outcomes, wires)
+                values = np.array([format(i, f"0{len(wires)}b") for i in indices])
+            elif observable.name in {"PauliX", "PauliY", "PauliZ", "Hadamard"}:
+                values = 1 - 2 * self._select_wires(outcomes, device_wires[:1])
+            else:
+                values = observable.eigvals()[self._select_wires(outcomes, device_wires)]
+
+            keys, inverse = np.unique(values, return_inverse=True)
+            totals = np.bincount(inverse, weights=frequencies).astype(np.int64)
+            return dict(zip(keys.tolist() if values.dtype.kind == "U" else keys, totals))
+
         def expval(self, observable, shot_range=None, bin_size=None):
             if observable.name in [
                 "Projector",
@@ -700,11 +1001,8 @@ if CPP_BINARY_AVAILABLE:
                 return np.squeeze(np.mean(samples, axis=0))
 
             if observable.name in ["SparseHamiltonian"]:
-                CSR_SparseHamiltonian = observable.sparse_matrix().tocsr()
                 return self._gpu_state.ExpectationValue(
-                    CSR_SparseHamiltonian.indptr,
-                    CSR_SparseHamiltonian.indices,
-                    CSR_SparseHamiltonian.data,
+                    self._native_sparse_hamiltonian(observable)
                 )
 
             if observable.name in ["Hamiltonian"]:
@@ -723,6 +1021,10 @@ if CPP_BINARY_AVAILABLE:
                             compressed_word.append(_name_map[word.name])
                         word_wires.append(word.wires.tolist())
                         pauli_words.append("".join(compressed_word))
+                    if self._pauli_grouping:
+                        return self._gpu_state.ExpectationValueGrouped(
+                            pauli_words, word_wires, coeffs
+                        )
                     return self._gpu_state.ExpectationValue(pauli_words, word_wires, coeffs)
 
                 else:
@@ -764,13 +1066,39 @@ if CPP_BINARY_AVAILABLE:
                 .reshape(-1)
             )
 
+        def estimate_probability(self, wires=None, shot_range=None, bin_size=None):
+            packed = self._current_packed_samples()
+            if packed is None or bin_size is not None:
+                return super().estimate_probability(
+                    wires=wires, shot_range=shot_range, bin_size=bin_size
+                )
+
+            wires = wires or self.wires
+            device_wires = self.map_wires(Wires(wires))
+            sample_slice = Ellipsis if shot_range is None else slice(*shot_range)
+            indices = self._select_wires(packed[sample_slice], device_wires)
+            if len(indices) == 0:
+                raise ValueError(
+                    f"Shot range {shot_range} selects no samples out of {len(packed)} shots."
+                )
+            histogram = np.bincount(indices, minlength=2 ** len(device_wires))
+            return self._asarray(histogram / len(indices), dtype=self.R_DTYPE)
+
         def generate_samples(self):
             """Generate samples
 
+            The samples are drawn as one basis-state index per shot, which is kept to estimate
+            probabilities and counts without the binary representation.
+
             Returns:
                 array[int]: array of samples in binary representation with shape ``(dev.shots, dev.num_wires)``
             """
-            return self._gpu_state.GenerateSamples(len(self.wires), self.shots).astype(int)
+            packed = self._gpu_state.GenerateSamplesPacked(self.shots)
+            num_wires = len(self.wires)
+            samples = (packed[:, None] >> np.arange(num_wires - 1, -1, -1)) & 1
+            samples = samples.astype(int)
+            self._packed_samples = (samples, packed)
+            return samples
 
         def var(self, observable, shot_range=None, bin_size=None):
             if self.shots is not None:
@@ -779,25 +1107,16 @@ if CPP_BINARY_AVAILABLE:
                 samples = self.sample(observable, shot_range=shot_range, bin_size=bin_size)
                 return np.squeeze(np.var(samples, axis=0))
 
-            adjoint_matrix = math.T(math.conj(qml.matrix(observable)))
-            sqr_matrix = np.matmul(adjoint_matrix, qml.matrix(observable))
+            if observable.name in ["SparseHamiltonian"]:
+                return self._gpu_state.Variance(self._native_sparse_hamiltonian(observable))
 
-            mean = self._gpu_state.ExpectationValue(
-                [i + "_var" for i in observable.name],
+            names = observable.name if isinstance(observable.name, list) else [observable.name]
+            return self._gpu_state.Variance(
+                names,
                 self.wires.indices(observable.wires),
-                observable.parameters,
                 qml.matrix(observable).ravel(order="C"),
             )
 
-            squared_mean = self._gpu_state.ExpectationValue(
-                [i + "_sqr" for i in observable.name],
-                self.wires.indices(observable.wires),
-                observable.parameters,
-                sqr_matrix.ravel(order="C"),
-            )
-
-            return squared_mean - (mean**2)
-
 else:  # CPP_BINARY_AVAILABLE:
 
     class LightningGPU(LightningQubit):
@@ -7,6 +7,7 @@
 #include <variant>
 
 #include "DevTag.hpp"
+#include "DeviceExecutor.hpp"
 #include "DevicePool.hpp"
 #include "JacobianTape.hpp"
 #include "ObservablesGPU.hpp"
@@ -205,31 +206,50 @@ template <class T = double> class AdjointJacobianGPU {
         {"MultiRZ", -static_cast<T>(0.5)}};
 
     /**
-     * @brief Utility method to update the Jacobian at a given index by
-     * calculating the overlap between two given states.
+     * @brief Utility method to update a column of the Jacobian by calculating
+     * the overlaps between all observable-applied states and a given state.
      *
-     * @param sv1 Statevector <sv1|. Data will be conjugated.
-     * @param sv2 Statevector |sv2>
+     * The overlaps are computed by a single GEMV against the contiguous
+     * observable matrix, and read back to the host at once.
+     *
+     * @param H_lambda_mat Column-major matrix of the observable-applied
+     * states <H_lambda|. Data will be conjugated.
+     * @param num_observables Number of columns of `H_lambda_mat`.
+     * @param sv Statevector |sv>
+     * @param overlaps Device buffer of `num_observables` values receiving the
+     * overlaps.
      * @param jac Jacobian receiving the values.
      * @param scaling_coeff Generator coefficient for given gate derivative.
-     * @param obs_index ObservableGPU index position of Jacobian to update.
+     * @param obs_offset ObservableGPU index of the first column.
      * @param param_index Parameter index position of Jacobian to update.
      */
-    inline void updateJacobian(const StateVectorCudaManaged<T> &sv1,
-                               const StateVectorCudaManaged<T> &sv2,
+    inline void updateJacobian(const DataBuffer<CFP_t> &H_lambda_mat,
+                               std::size_t num_observables,
+                               const StateVectorCudaManaged<T> &sv,
+                               DataBuffer<CFP_t> &overlaps,
                                std::vector<std::vector<T>> &jac,
-                               T scaling_coeff, size_t obs_index,
+                               T scaling_coeff, size_t obs_offset,
                                size_t param_index) {
-        PL_ABORT_IF_NOT(sv1.getDataBuffer().getDevTag().getDeviceID() ==
-                            sv2.getDataBuffer().getDevTag().getDeviceID(),
+        const auto &dev_tag = sv.getDevTag();
+        PL_ABORT_IF_NOT(H_lambda_mat.getDevTag().getDeviceID() ==
+                            dev_tag.getDeviceID(),
                         "Data exists on different GPUs. Aborting.");
 
-        jac[obs_index][param_index] =
-            -2 * scaling_coeff *
-            innerProdC_CUDA(sv1.getData(), sv2.getData(), sv1.getLength(),
-                            sv1.getDataBuffer().getDevTag().getDeviceID(),
-                            sv1.getDataBuffer().getDevTag().getStreamID())
-                .y;
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_tag.getDeviceID()));
+        innerProdsC_CUDA(cuUtil::CublasHandleRegistry::getInstance().getHandle(
+                             dev_tag.getDeviceID(), dev_tag.getStreamID()),
+                         H_lambda_mat.getData(), sv.getData(),
+                         overlaps.getData(), static_cast<int>(sv.getLength()),
+                         static_cast<int>(num_observables));
+
+        std::vector<CFP_t> host_overlaps(num_observables);
+        overlaps.CopyGpuDataToHost(host_overlaps.data(), num_observables,
+                                   true);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(dev_tag.getStreamID()));
+        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+            jac[obs_offset + obs_idx][param_index] =
+                -2 * scaling_coeff * host_overlaps[obs_idx].y;
+        }
     }
 
     /**
@@ -273,6 +293,19 @@ template <class T = double> class AdjointJacobianGPU {
                              operations.getOpsParams()[op_idx]);
     }
 
+    /**
+     * @brief Utility method to apply the adjoint indexed operation from a
+     * pre-decoded `%GateTape<T>` to `%StateVectorCudaManaged<T>`.
+     *
+     * @param state Statevector to be updated.
+     * @param tape Decoded operations to apply.
+     * @param op_idx Adjointed operation index to apply.
+     */
+    inline void applyOperationAdj(StateVectorCudaManaged<T> &state,
+                                  const GateTape<T> &tape, size_t op_idx) {
+        state.applyTapeOperation(tape, op_idx, true);
+    }
+
     /**
      * @brief Utility method to apply a given operations from given
      * `%ObservableGPU` object to
@@ -314,6 +347,8 @@ template <class T = double> class AdjointJacobianGPU {
                 try {
                     states[h_i].updateData(reference_state);
                     applyObservable(states[h_i], *observables[h_i]);
+                    // The states are kept for the backward sweep
+                    states[h_i].releaseScratch();
                 } catch (...) {
                     #if defined(_OPENMP)
                         #pragma omp critical
@@ -340,15 +375,16 @@ template <class T = double> class AdjointJacobianGPU {
      * @brief OpenMP accelerated application of adjoint operations to
      * statevectors.
      *
+     * @tparam OpsT `%Pennylane::Algorithms::OpsData<T>` or `%GateTape<T>`.
      * @param states Vector of all statevectors; 1 per observable
      * @param operations Operations list.
      * @param op_idx Index of given operation within operations list to take
      * adjoint of.
      */
+    template <class OpsT>
     inline void
     applyOperationsAdj(std::vector<StateVectorCudaManaged<T>> &states,
-                       const Pennylane::Algorithms::OpsData<T> &operations,
-                       size_t op_idx) {
+                       const OpsT &operations, size_t op_idx) {
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -417,9 +453,246 @@ template <class T = double> class AdjointJacobianGPU {
         return scaling_factors.at(op_name);
     }
 
+    /// Device memory budget of `adjointJacobian` in bytes; 0 is unbounded.
+    std::size_t memory_budget_{0};
+
+    /**
+     * @brief Backward pass of the adjoint method for a tile of observables,
+     * filling the Jacobian rows `obs_offset` to `obs_offset + obs.size() - 1`.
+     * The forward state `lambda` is consumed.
+     *
+     * @param lambda Forward state $U_{1:p}\vert \lambda \rangle$.
+     * @param tape Decoded operations.
+     * @param ops Operations used to create the forward state.
+     * @param jac Jacobian receiving the values.
+     * @param obs Observables of the tile.
+     * @param obs_offset Jacobian row of the first observable of the tile.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     */
+    void backwardPass(StateVectorCudaManaged<T> &lambda,
+                      const GateTape<T> &tape,
+                      const Pennylane::Algorithms::OpsData<T> &ops,
+                      std::vector<std::vector<T>> &jac,
+                      const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+                      std::size_t obs_offset,
+                      const std::vector<size_t> &trainableParams) {
+        const size_t num_observables = obs.size();
+        const auto &dt_local = lambda.getDevTag();
+
+        // Create observable-applied state-vectors, stored as the columns of
+        // one matrix so each Jacobian column is a single GEMV
+        const size_t length = lambda.getLength();
+        DataBuffer<CFP_t> H_lambda_mat(num_observables * length, dt_local);
+        std::vector<StateVectorCudaManaged<T>> H_lambda;
+        // The views must not be copied by a reallocation
+        H_lambda.reserve(num_observables);
+        for (size_t n = 0; n < num_observables; n++) {
+            H_lambda.emplace_back(std::make_unique<DataBuffer<CFP_t>>(
+                H_lambda_mat.getData() + n * length, length, dt_local));
+        }
+        applyObservables(H_lambda, lambda, obs);
+
+        backwardSweep(lambda, H_lambda, H_lambda_mat, tape, ops, jac,
+                      obs_offset, trainableParams);
+    }
+
+    /**
+     * @brief Sweep the operations backwards from prepared observable-applied
+     * states, filling the Jacobian rows `obs_offset` onwards. Both `lambda`
+     * and `H_lambda` are consumed.
+     *
+     * @param lambda Forward state $U_{1:p}\vert \lambda \rangle$.
+     * @param H_lambda Observable-applied states, viewing the columns of
+     * `H_lambda_mat`.
+     * @param H_lambda_mat Column-major matrix holding `H_lambda`.
+     * @param tape Decoded operations.
+     * @param ops Operations used to create the forward state.
+     * @param jac Jacobian receiving the values.
+     * @param obs_offset Jacobian row of the first observable-applied state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     */
+    void backwardSweep(StateVectorCudaManaged<T> &lambda,
+                       std::vector<StateVectorCudaManaged<T>> &H_lambda,
+                       const DataBuffer<CFP_t> &H_lambda_mat,
+                       const GateTape<T> &tape,
+                       const Pennylane::Algorithms::OpsData<T> &ops,
+                       std::vector<std::vector<T>> &jac, std::size_t obs_offset,
+                       const std::vector<size_t> &trainableParams) {
+        const std::vector<std::string> &ops_name = ops.getOpsName();
+        const size_t num_observables = H_lambda.size();
+
+        const size_t tp_size = trainableParams.size();
+        const size_t num_param_ops = ops.getNumParOps();
+
+        // Track positions within par and non-par operations
+        size_t trainableParamNumber = tp_size - 1;
+        size_t current_param_idx =
+            num_param_ops - 1; // total number of parametric ops
+        auto tp_it = trainableParams.rbegin();
+        const auto tp_rend = trainableParams.rend();
+
+        const auto &dt_local = lambda.getDevTag();
+
+        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local);
+        DataBuffer<CFP_t> overlaps(num_observables, dt_local);
+
+        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
+             op_idx--) {
+            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+            if ((ops_name[op_idx] == "QubitStateVector") ||
+                (ops_name[op_idx] == "BasisState")) {
+                continue;
+            }
+            if (tp_it == tp_rend) {
+                break; // All done
+            }
+            mu.updateData(lambda);
+            applyOperationAdj(lambda, tape, op_idx);
+
+            if (ops.hasParams(op_idx)) {
+                if (current_param_idx == *tp_it) {
+                    const T scalingFactor =
+                        applyGenerator(mu, ops.getOpsName()[op_idx],
+                                       ops.getOpsWires()[op_idx],
+                                       !ops.getOpsInverses()[op_idx]) *
+                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
+
+                    updateJacobian(H_lambda_mat, num_observables, mu,
+                                   overlaps, jac, scalingFactor, obs_offset,
+                                   trainableParamNumber);
+                    trainableParamNumber--;
+                    ++tp_it;
+                }
+                current_param_idx--;
+            }
+            applyOperationsAdj(H_lambda, tape, static_cast<size_t>(op_idx));
+        }
+    }
+
+    /**
+     * @brief Fill the Jacobian rows `obs_first` to `obs_last - 1`, in tiles of
+     * observables fitting the memory budget. The forward state is re-derived
+     * from the reference state for each tile.
+     *
+     * @param lambda State-vector receiving the forward state, which may live
+     * on another device than `ref_data`.
+     * @param tape Decoded operations.
+     * @param ref_data Pointer to the statevector data.
+     * @param length Length of the statevector data.
+     * @param jac Jacobian receiving the values.
+     * @param obs ObservableGPUs for which to calculate Jacobian.
+     * @param obs_first First observable of the range.
+     * @param obs_last Observable past the end of the range.
+     * @param ops Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     */
+    void adjointJacobianRows(
+        StateVectorCudaManaged<T> &lambda, const GateTape<T> &tape,
+        const CFP_t *ref_data, std::size_t length,
+        std::vector<std::vector<T>> &jac,
+        const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+        std::size_t obs_first, std::size_t obs_last,
+        const Pennylane::Algorithms::OpsData<T> &ops,
+        const std::vector<size_t> &trainableParams, bool apply_operations) {
+        std::size_t num_scratch_states = 0;
+        for (std::size_t i = obs_first; i < obs_last; i++) {
+            num_scratch_states =
+                std::max(num_scratch_states, obs[i]->getNumScratchStates());
+        }
+        const std::size_t tile_size =
+            getObservableTileSize(lambda.getNumQubits(), obs_last - obs_first,
+                                  memory_budget_, num_scratch_states);
+
+        for (std::size_t first = obs_first; first < obs_last;
+             first += tile_size) {
+            // Each tile consumes the forward state
+            lambda.CopyGpuDataToGpuIn(ref_data, length);
+            // Apply given operations to statevector if requested
+            if (apply_operations) {
+                lambda.applyTape(tape);
+            }
+            const std::size_t last = std::min(first + tile_size, obs_last);
+            backwardPass(lambda, tape, ops, jac,
+                         {obs.begin() + first, obs.begin() + last}, first,
+                         trainableParams);
+        }
+    }
+
+    /**
+     * @brief Forward state kept by each batch worker across calls, so that its
+     * device memory and gate cache are reused.
+     */
+    struct WarmState {
+        std::unique_ptr<StateVectorCudaManaged<T>> lambda;
+    };
+
   public:
+    /// Observable tiles queued per device by `batchAdjointJacobian`, so that
+    /// the devices finishing early take over the remaining work.
+    static constexpr std::size_t batch_tiles_per_device = 4;
+
+    /// State-vectors held besides the observable tile: lambda and mu.
+    static constexpr std::size_t num_fixed_states = 2;
+
     AdjointJacobianGPU() = default;
 
+    /**
+     * @brief Bound the device memory used by `adjointJacobian`. When the
+     * state-vectors of all observables do not fit in the budget, the
+     * observables are processed in tiles, and the forward state is re-derived
+     * from the reference state for each tile.
+     *
+     * @param budget_bytes Budget in bytes per device. 0 (default) processes all
+     * observables at once.
+     */
+    void setMemoryBudget(std::size_t budget_bytes) {
+        memory_budget_ = budget_bytes;
+    }
+
+    [[nodiscard]] auto getMemoryBudget() const -> std::size_t {
+        return memory_budget_;
+    }
+
+    /**
+     * @brief Get the number of observables processed together by
+     * `adjointJacobian` within a device memory budget.
+     *
+     * The observables of a tile are applied concurrently, so each one counts
+     * its own state-vector and the scratch buffers it allocates meanwhile.
+     *
+     * @param num_qubits Number of qubits of the state-vector.
+     * @param num_observables Total number of observables.
+     * @param budget_bytes Budget in bytes. 0 is unbounded.
+     * @param num_scratch_states Largest `getNumScratchStates` of the
+     * observables.
+     * @return std::size_t Observables per tile.
+     */
+    static auto getObservableTileSize(std::size_t num_qubits,
+                                      std::size_t num_observables,
+                                      std::size_t budget_bytes,
+                                      std::size_t num_scratch_states = 0)
+        -> std::size_t {
+        if (budget_bytes == 0) {
+            return num_observables;
+        }
+        const std::size_t sv_bytes =
+            sizeof(CFP_t) * Pennylane::Util::exp2(num_qubits);
+        const std::size_t num_states = budget_bytes / sv_bytes;
+        const std::size_t states_per_observable = 1 + num_scratch_states;
+        PL_ABORT_IF(num_states < num_fixed_states + states_per_observable,
+                    "The memory budget cannot hold the state-vectors of a "
+                    "single observable.");
+        return std::min((num_states - num_fixed_states) / states_per_observable,
+                        num_observables);
+    }
+
     /**
      * @brief Utility to create a given operations object.
      *
@@ -446,6 +719,12 @@ template <class T = double> class AdjointJacobianGPU {
      * Explicitly forbids OMP_NUM_THREADS>1 to avoid issues with std::thread
      * contention and state access issues.
      *
+     * The observables are split into `batch_tiles_per_device` tiles per
+     * device, queued on the process-wide `DeviceExecutor`. Each device takes
+     * the next tile when idle, so observables of uneven cost, such as
+     * Hamiltonian terms, do not leave devices waiting. The workers keep their
+     * forward state-vector, and its gate cache, from one call to the next.
+     *
      * @param ref_data Pointer to the statevector data.
      * @param length Length of the statevector data.
      * @param jac Preallocated vector for Jacobian data results.
@@ -456,7 +735,6 @@ template <class T = double> class AdjointJacobianGPU {
      * @param apply_operations Indicate whether to apply operations to psi prior
      * to calculation.
      */
-
     void batchAdjointJacobian(
         const CFP_t *ref_data, std::size_t length,
         std::vector<std::vector<T>> &jac,
@@ -464,79 +742,47 @@ template <class T = double> class AdjointJacobianGPU {
         const Pennylane::Algorithms::OpsData<T> &ops,
         const std::vector<size_t> &trainableParams,
         bool apply_operations = false) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
 
-        // Create a pool of available GPU devices
-        DevicePool<int> dp;
-        const auto num_gpus = dp.getTotalDevices();
-        const auto num_chunks = num_gpus;
-
-        // Create a vector of threads for separate GPU executions
-        using namespace std::chrono_literals;
-        std::vector<std::thread> threads;
-        threads.reserve(num_gpus);
-
-        // Hold results of threaded GPU executions
-        std::vector<std::future<std::vector<std::vector<T>>>> futures;
-
-        // Iterate over the chunked observables, and submit the Jacobian task
-        // for execution
-        for (std::size_t i = 0; i < num_chunks; i++) {
-            const auto first = static_cast<std::size_t>(
-                std::ceil(obs.size() * i / num_chunks));
-            const auto last = static_cast<std::size_t>(
-                std::ceil((obs.size() * (i + 1) / num_chunks) - 1));
-
-            std::promise<std::vector<std::vector<T>>> jac_subset_promise;
-            futures.emplace_back(jac_subset_promise.get_future());
-
-            auto adj_lambda =
-                [&](std::promise<std::vector<std::vector<T>>> j_promise,
-                    std::size_t offset_first, std::size_t offset_last) {
-                    // Ensure No OpenMP threads spawned;
-                    // to be resolved with streams in future releases
-                    omp_set_num_threads(1);
-
-                    // Grab a GPU index, and set a device tag
-                    const auto id = dp.acquireDevice();
-                    DevTag<int> dt_local(id, 0);
-                    dt_local.refresh();
-
-                    // Create a sv copy on this thread and device; may not be
-                    // necessary, could do in adjoint calculation directly
-                    StateVectorCudaManaged<T> local_sv(ref_data, length,
-                                                       dt_local);
-
-                    // Create local store for Jacobian subset
-                    std::vector<std::vector<T>> jac_local(
-                        (offset_last - offset_first + 1),
-                        std::vector<T>(trainableParams.size(), 0));
-
-                    adjointJacobian(local_sv.getData(), length, jac_local,
-                                    {obs.begin() + offset_first,
-                                     obs.begin() + offset_last + 1},
-                                    ops, trainableParams, apply_operations,
-                                    dt_local);
-
-                    j_promise.set_value(std::move(jac_local));
-                    dp.releaseDevice(id);
-                };
-            threads.emplace_back(adj_lambda, std::move(jac_subset_promise),
-                                 first, last);
+        auto &executor = DeviceExecutor<int>::getInstance();
+        const std::size_t num_qubits = Util::log2(length);
+        const std::size_t num_tiles =
+            executor.getNumWorkers() * batch_tiles_per_device;
+        const std::size_t tile_size =
+            std::max<std::size_t>(1, (obs.size() + num_tiles - 1) / num_tiles);
+
+        // Decode the operations once for all devices
+        const auto tape = GateTape<T>::fromOpsData(num_qubits, ops);
+
+        std::vector<std::future<void>> futures;
+        for (std::size_t first = 0; first < obs.size(); first += tile_size) {
+            const std::size_t last = std::min(first + tile_size, obs.size());
+            futures.emplace_back(executor.submit([&, first, last](int dev_id) {
+                // Ensure No OpenMP threads spawned;
+                // to be resolved with streams in future releases
+                omp_set_num_threads(1);
+
+                auto &warm = executor.getLocalState<WarmState>(dev_id);
+                if (!warm.lambda || warm.lambda->getNumQubits() != num_qubits) {
+                    warm.lambda.reset();
+                    warm.lambda = std::make_unique<StateVectorCudaManaged<T>>(
+                        num_qubits, DevTag<int>{dev_id, 0});
+                }
+                // Each task writes its own rows of the Jacobian
+                adjointJacobianRows(*warm.lambda, tape, ref_data, length, jac,
+                                    obs, first, last, ops, trainableParams,
+                                    apply_operations);
+            }));
         }
 
-        /// Ensure the new local jacs are inserted and
-        /// overwrite the 0 jacs values before returning
-        for (std::size_t i = 0; i < futures.size(); i++) {
-            const auto first = static_cast<std::size_t>(
-                std::ceil(obs.size() * i / num_chunks));
-
-            auto jac_rows = futures[i].get();
-            for (std::size_t j = 0; j < jac_rows.size(); j++) {
-                jac.at(first + j) = std::move(jac_rows[j]);
-            }
+        // The tasks refer to the arguments, so all must finish before any
+        // exception is rethrown
+        for (auto &future : futures) {
+            future.wait();
         }
-        for (std::size_t t = 0; t < threads.size(); t++) {
-            threads[t].join();
+        for (auto &future : futures) {
+            future.get();
         }
     }
 
@@ -554,6 +800,11 @@ template <class T = double> class AdjointJacobianGPU {
      * will be of size `trainableParams.size() * observables.size()`. OpenMP is
      * used to enable independent operations to be offloaded to threads.
      *
+     * If a memory budget is set with `setMemoryBudget`, the observables are
+     * processed in tiles of `getObservableTileSize` observables. `ref_data`
+     * must then remain valid and unchanged during the call, as the forward
+     * state of each tile is re-derived from it.
+     *
      * @param ref_data Pointer to the statevector data.
      * @param length Length of the statevector data.
      * @param jac Preallocated vector for Jacobian data results.
@@ -575,84 +826,96 @@ template <class T = double> class AdjointJacobianGPU {
         PL_ABORT_IF(trainableParams.empty(),
                     "No trainable parameters provided.");
 
-        const std::vector<std::string> &ops_name = ops.getOpsName();
-        const size_t num_observables = obs.size();
+        DevTag<int> dt_local(std::move(dev_tag));
+        dt_local.refresh();
+        // Holds $U_{1:p}\vert \lambda \rangle$
+        StateVectorCudaManaged<T> lambda(Util::log2(length), dt_local);
 
-        const size_t tp_size = trainableParams.size();
-        const size_t num_param_ops = ops.getNumParOps();
+        // Decode the operations once for all gate applications below
+        const auto tape = GateTape<T>::fromOpsData(lambda.getNumQubits(), ops);
 
-        // Track positions within par and non-par operations
-        size_t trainableParamNumber = tp_size - 1;
-        size_t current_param_idx =
-            num_param_ops - 1; // total number of parametric ops
-        auto tp_it = trainableParams.rbegin();
-        const auto tp_rend = trainableParams.rend();
+        adjointJacobianRows(lambda, tape, ref_data, length, jac, obs, 0,
+                            obs.size(), ops, trainableParams,
+                            apply_operations);
+    }
+
+    /**
+     * @brief Calculates the vector-Jacobian product of the statevector for the
+     * selected set of parametric gates, i.e. the gradient of
+     * $\sum_i dy_i \langle O_i \rangle$.
+     *
+     * Rather than computing the full Jacobian, the observables are contracted
+     * with `dy` into a single observable-applied state before the backward
+     * pass, which then holds three state-vectors only, whatever the number of
+     * observables.
+     *
+     * @param ref_data Pointer to the statevector data.
+     * @param length Length of the statevector data.
+     * @param vjp Preallocated vector of size `trainableParams.size()`
+     * receiving the vector-Jacobian product.
+     * @param dy Cotangent vector, with one value per observable.
+     * @param obs ObservableGPUs for which to calculate the product.
+     * @param ops Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     */
+    void vectorJacobianProduct(
+        const CFP_t *ref_data, std::size_t length, std::vector<T> &vjp,
+        const std::vector<T> &dy,
+        const std::vector<std::shared_ptr<ObservableGPU<T>>> &obs,
+        const Pennylane::Algorithms::OpsData<T> &ops,
+        const std::vector<size_t> &trainableParams,
+        bool apply_operations = false, CUDA::DevTag<int> dev_tag = {0, 0}) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF_NOT(dy.size() == obs.size(),
+                        "The cotangent vector must hold one value per "
+                        "observable.");
+        PL_ABORT_IF_NOT(vjp.size() == trainableParams.size(),
+                        "The vector-Jacobian product must hold one value per "
+                        "trainable parameter.");
 
         DevTag<int> dt_local(std::move(dev_tag));
         dt_local.refresh();
         // Create $U_{1:p}\vert \lambda \rangle$
         StateVectorCudaManaged<T> lambda(ref_data, length, dt_local);
 
-        // Apply given operations to statevector if requested
+        // Decode the operations once for all gate applications below
+        const auto tape = GateTape<T>::fromOpsData(lambda.getNumQubits(), ops);
         if (apply_operations) {
-            applyOperations(lambda, ops);
-        }
-
-        // Create observable-applied state-vectors
-        std::vector<StateVectorCudaManaged<T>> H_lambda;
-        for (size_t n = 0; n < num_observables; n++) {
-            H_lambda.emplace_back(lambda.getNumQubits(), dt_local);
+            lambda.applyTape(tape);
         }
-        applyObservables(H_lambda, lambda, obs);
-
-        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local);
-
-        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
-             op_idx--) {
-            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
-                        "The operation is not supported using the adjoint "
-                        "differentiation method");
-            if ((ops_name[op_idx] == "QubitStateVector") ||
-                (ops_name[op_idx] == "BasisState")) {
-                continue;
-            }
-            if (tp_it == tp_rend) {
-                break; // All done
-            }
-            mu.updateData(lambda);
-            applyOperationAdj(lambda, ops, op_idx);
-
-            if (ops.hasParams(op_idx)) {
-                if (current_param_idx == *tp_it) {
-                    const T scalingFactor =
-                        applyGenerator(mu, ops.getOpsName()[op_idx],
-                                       ops.getOpsWires()[op_idx],
-                                       !ops.getOpsInverses()[op_idx]) *
-                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
-
-                    // clang-format off
-
-                    #if defined(_OPENMP)
-                        #pragma omp parallel for default(none)   \
-                        shared(H_lambda, jac, mu, scalingFactor, \
-                            trainableParamNumber, tp_it,         \
-                            num_observables)
-                    #endif
 
-                    // clang-format on
-                    for (size_t obs_idx = 0; obs_idx < num_observables;
-                         obs_idx++) {
-                        updateJacobian(H_lambda[obs_idx], mu, jac,
-                                       scalingFactor, obs_idx,
-                                       trainableParamNumber);
-                    }
-                    trainableParamNumber--;
-                    ++tp_it;
+        // Contract the observables into $\sum_i dy_i O_i \vert \lambda
+        // \rangle$; the scratch state is freed before the backward sweep
+        DataBuffer<CFP_t> H_lambda_mat(length, dt_local);
+        H_lambda_mat.zeroInit();
+        {
+            StateVectorCudaManaged<T> scratch(lambda.getNumQubits(), dt_local);
+            cublasHandle_t handle =
+                cuUtil::CublasHandleRegistry::getInstance().getHandle(
+                    dt_local.getDeviceID(), dt_local.getStreamID());
+            for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+                if (dy[obs_idx] == 0) {
+                    continue;
                 }
-                current_param_idx--;
+                scratch.updateData(lambda);
+                applyObservable(scratch, *obs[obs_idx]);
+                scaleAndAddC_CUDA(handle, std::complex<T>{dy[obs_idx], 0.0},
+                                  scratch.getData(), H_lambda_mat.getData(),
+                                  static_cast<int>(length));
             }
-            applyOperationsAdj(H_lambda, ops, static_cast<size_t>(op_idx));
         }
+        std::vector<StateVectorCudaManaged<T>> H_lambda;
+        H_lambda.emplace_back(std::make_unique<DataBuffer<CFP_t>>(
+            H_lambda_mat.getData(), length, dt_local));
+
+        std::vector<std::vector<T>> jac{std::vector<T>(vjp.size(), 0)};
+        backwardSweep(lambda, H_lambda, H_lambda_mat, tape, ops, jac, 0,
+                      trainableParams);
+        vjp = std::move(jac.front());
     }
 };
 
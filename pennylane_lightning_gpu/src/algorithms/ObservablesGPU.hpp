@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "CSRMatrixGPU.hpp"
 #include "StateVectorCudaManaged.hpp"
 
 namespace Pennylane::Algorithms {
@@ -51,6 +56,30 @@ class ObservableGPU : public std::enable_shared_from_this<ObservableGPU<T>> {
      */
     [[nodiscard]] virtual auto getWires() const -> std::vector<size_t> = 0;
 
+    /**
+     * @brief Append the observable to a Pauli word, if it is a product of
+     * Pauli operators.
+     *
+     * @param pauli_word Pauli word, as a string of 'I', 'X', 'Y' and 'Z'.
+     * @param wires Wires of the word.
+     * @return true if the observable was appended. Otherwise the arguments
+     * may be partially appended to.
+     */
+    virtual bool appendPauliWord([[maybe_unused]] std::string &pauli_word,
+                                 [[maybe_unused]] std::vector<size_t> &wires)
+        const {
+        return false;
+    }
+
+    /**
+     * @brief Get the number of state-sized buffers, besides the state itself,
+     * that `applyInPlace` allocates on the state-vector it is applied to.
+     * They are freed by `StateVectorCudaManaged::releaseScratch`.
+     */
+    [[nodiscard]] virtual auto getNumScratchStates() const -> std::size_t {
+        return 0;
+    }
+
     /**
      * @brief Test whether this object is equal to another object
      */
@@ -111,6 +140,22 @@ template <typename T> class NamedObsGPU final : public ObservableGPU<T> {
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
         sv.applyOperation(obs_name_, wires_, false, params_);
     }
+
+    bool appendPauliWord(std::string &pauli_word,
+                         std::vector<size_t> &wires) const override {
+        static const std::unordered_map<std::string, char> paulis{
+            {"Identity", 'I'},
+            {"PauliX", 'X'},
+            {"PauliY", 'Y'},
+            {"PauliZ", 'Z'}};
+        const auto it = paulis.find(obs_name_);
+        if (it == paulis.end() || wires_.size() != 1 || !params_.empty()) {
+            return false;
+        }
+        pauli_word.push_back(it->second);
+        wires.push_back(wires_[0]);
+        return true;
+    }
 };
 
 /**
@@ -256,6 +301,21 @@ template <typename T> class TensorProdObsGPU final : public ObservableGPU<T> {
         }
     }
 
+    [[nodiscard]] auto getNumScratchStates() const -> std::size_t override {
+        std::size_t num_states = 0;
+        for (const auto &ob : obs_) {
+            num_states = std::max(num_states, ob->getNumScratchStates());
+        }
+        return num_states;
+    }
+
+    bool appendPauliWord(std::string &pauli_word,
+                         std::vector<size_t> &wires) const override {
+        return std::all_of(obs_.begin(), obs_.end(), [&](const auto &ob) {
+            return ob->appendPauliWord(pauli_word, wires);
+        });
+    }
+
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Pennylane::Util::operator<<;
         std::ostringstream obs_stream;
@@ -328,24 +388,62 @@ template <typename T> class HamiltonianGPU final : public ObservableGPU<T> {
             new HamiltonianGPU<T>{std::move(arg1), std::move(arg2)});
     }
 
-    // to work with
+    /**
+     * @brief Apply the Hamiltonian to the given statevector in place.
+     *
+     * The terms are accumulated in a buffer kept by the statevector. Pauli
+     * words are added to it by a single fused phase, permutation and
+     * scale-add pass that reads the statevector without modifying it. Other
+     * terms are applied to the scratch copy of the statevector before being
+     * added, so that no statevector is allocated per term.
+     */
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
-        using CFP_t = typename StateVectorCudaManaged<T>::CFP_t;
-        DataBuffer<CFP_t, int> buffer(sv.getDataBuffer().getLength(),
-                                      sv.getDataBuffer().getDevTag());
-        buffer.zeroInit();
+        auto &buffer = sv.getZeroedAccumulator();
+
+        const auto &dev_tag = sv.getDevTag();
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_tag.getDeviceID()));
+        cublasHandle_t handle = CublasHandleRegistry::getInstance().getHandle(
+            dev_tag.getDeviceID(), dev_tag.getStreamID());
 
+        std::string pauli_word;
+        std::vector<size_t> wires;
         for (size_t term_idx = 0; term_idx < coeffs_.size(); term_idx++) {
-            StateVectorCudaManaged<T> tmp(sv);
+            pauli_word.clear();
+            wires.clear();
+            if (obs_[term_idx]->appendPauliWord(pauli_word, wires)) {
+                sv.scaleAndAddPauliWord(
+                    std::complex<T>{coeffs_[term_idx], 0.0}, pauli_word, wires,
+                    buffer.getData());
+                continue;
+            }
+            auto &tmp = sv.copyToScratch();
             obs_[term_idx]->applyInPlace(tmp);
-            scaleAndAddC_CUDA(std::complex<T>{coeffs_[term_idx], 0.0},
-                              tmp.getData(), buffer.getData(), tmp.getLength(),
-                              tmp.getDataBuffer().getDevTag().getDeviceID(),
-                              tmp.getDataBuffer().getDevTag().getStreamID());
+            scaleAndAddC_CUDA(handle, std::complex<T>{coeffs_[term_idx], 0.0},
+                              tmp.getData(), buffer.getData(),
+                              static_cast<int>(tmp.getLength()));
         }
         sv.CopyGpuDataToGpuIn(buffer.getData(), buffer.getLength());
     }
 
+    /**
+     * @brief The accumulator, and for terms other than Pauli words the
+     * scratch state-vector with the buffers of the terms applied to it.
+     */
+    [[nodiscard]] auto getNumScratchStates() const -> std::size_t override {
+        std::size_t num_states = 1;
+        std::string pauli_word;
+        std::vector<size_t> wires;
+        for (const auto &ob : obs_) {
+            pauli_word.clear();
+            wires.clear();
+            if (!ob->appendPauliWord(pauli_word, wires)) {
+                num_states =
+                    std::max(num_states, 2 + ob->getNumScratchStates());
+            }
+        }
+        return num_states;
+    }
+
     [[nodiscard]] auto getWires() const -> std::vector<size_t> override {
         std::unordered_set<size_t> wires;
 
@@ -389,17 +487,20 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
                                            int32_t, int64_t>::type;
 
   private:
-    std::vector<std::complex<T>> data_;
-    std::vector<IdxT> indices_;
-    std::vector<IdxT> offsets_;
+    // Shared between copies, so the device copies of the matrix are too
+    std::shared_ptr<const CSRMatrixGPU<T, IdxT>> matrix_;
     std::vector<std::size_t> wires_;
 
     [[nodiscard]] bool isEqual(const ObservableGPU<T> &other) const override {
         const auto &other_cast =
             static_cast<const SparseHamiltonianGPU<T> &>(other);
 
-        if (data_ != other_cast.data_ || indices_ != other_cast.indices_ ||
-            offsets_ != other_cast.offsets_) {
+        if (matrix_ == other_cast.matrix_) {
+            return true;
+        }
+        if (matrix_->getData() != other_cast.matrix_->getData() ||
+            matrix_->getIndices() != other_cast.matrix_->getIndices() ||
+            matrix_->getOffsets() != other_cast.matrix_->getOffsets()) {
             return false;
         }
 
@@ -419,10 +520,11 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
     template <typename T1, typename T2, typename T3 = T2,
               typename T4 = std::vector<std::size_t>>
     SparseHamiltonianGPU(T1 &&arg1, T2 &&arg2, T3 &&arg3, T4 &&arg4)
-        : data_{std::forward<T1>(arg1)}, indices_{std::forward<T2>(arg2)},
-          offsets_{std::forward<T3>(arg3)}, wires_{std::forward<T4>(arg4)} {
-        PL_ASSERT(data_.size() == indices_.size());
-    }
+        : matrix_{std::make_shared<const CSRMatrixGPU<T, IdxT>>(
+              std::vector<std::complex<T>>(std::forward<T1>(arg1)),
+              std::vector<IdxT>(std::forward<T2>(arg2)),
+              std::vector<IdxT>(std::forward<T3>(arg3)))},
+          wires_{std::forward<T4>(arg4)} {}
 
     /**
      * @brief Convenient wrapper for the constructor as the constructor does not
@@ -436,7 +538,7 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
      * @param arg3 Argument to construct ofsets
      * @param arg4 Argument to construct wires
      */
-    static auto create(std::initializer_list<T> arg1,
+    static auto create(std::initializer_list<std::complex<T>> arg1,
                        std::initializer_list<IdxT> arg2,
                        std::initializer_list<IdxT> arg3,
                        std::initializer_list<std::size_t> arg4)
@@ -448,143 +550,46 @@ class SparseHamiltonianGPU final : public ObservableGPU<T> {
 
     /**
      * @brief Updates the statevector SV:->SV', where SV' = a*H*SV, and where H
-     * is a sparse Hamiltonian.
+     * is a sparse Hamiltonian. The matrix is uploaded to the device of `sv` on
+     * first use only. The product is written to the accumulator of `sv` and
+     * copied back, so no state-sized buffer is allocated per call.
      *
      */
     void applyInPlace(StateVectorCudaManaged<T> &sv) const override {
         PL_ABORT_IF_NOT(wires_.size() == sv.getNumQubits(),
                         "SparseH wire count does not match state-vector size");
-        using CFP_t = typename StateVectorCudaManaged<T>::CFP_t;
-
-        const std::size_t nIndexBits = sv.getNumQubits();
-        const std::size_t length = 1 << nIndexBits;
-        const int64_t num_rows = static_cast<int64_t>(
-            offsets_.size() -
-            1); // int64_t is required for num_rows by cusparseCreateCsr
-        const int64_t num_cols = static_cast<int64_t>(
-            num_rows); // int64_t is required for num_cols by cusparseCreateCsr
-        const int64_t nnz = static_cast<int64_t>(
-            data_.size()); // int64_t is required for nnz by cusparseCreateCsr
-
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
-
-        auto device_id = sv.getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = sv.getDataBuffer().getDevTag().getStreamID();
-
-        // clang-format off
-        DataBuffer<IdxT> H_csrOffsets  { offsets_.size(), device_id, stream_id, true};
-        DataBuffer<IdxT> H_columns     { indices_.size(), device_id, stream_id, true};
-        DataBuffer<CFP_t> H_values     { data_.size(),    device_id, stream_id, true};
-
-        // Transfer ownership after state update to StateVectorCudaManaged
-        std::unique_ptr<DataBuffer<CFP_t>> d_sv_prime = std::make_unique<DataBuffer<CFP_t>>(length, device_id, stream_id, true);
-
-        H_csrOffsets.CopyHostDataToGpu( offsets_.data(), H_csrOffsets.getLength(), false);
-        H_columns.CopyHostDataToGpu(    indices_.data(), H_columns.getLength(),    false);
-        H_values.CopyHostDataToGpu(     data_.data(),    H_values.getLength(),     false);
-        // clang-format on
-
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            data_type = CUDA_C_32F;
-            compute_type = CUSPARSE_INDEX_32I;
-        }
+        const auto &dev_tag = sv.getDevTag();
+
+        auto &buffer = sv.getAccumulator();
+        matrix_->SpMV(std::as_const(sv).getData(), buffer.getData(), dev_tag);
+        sv.CopyGpuDataToGpuIn(buffer.getData(), buffer.getLength());
+    }
 
-        // CUSPARSE APIs
-        cusparseHandle_t handle = nullptr;
-        cusparseSpMatDescr_t sparseH_descriptor;
-        cusparseDnVecDescr_t sv_descriptor, sv_prime_descriptor;
-
-        size_t bufferSize = 0;
-
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreate(&handle));
-
-        // Create sparse matrix descriptor for H in CSR format
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-            /* cusparseSpMatDescr_t* */ &sparseH_descriptor,
-            /* int64_t */ num_rows,
-            /* int64_t */ num_cols,
-            /* int64_t */ nnz,
-            /* void* */ H_csrOffsets.getData(),
-            /* void* */ H_columns.getData(),
-            /* void* */ H_values.getData(),
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
-            /* cudaDataType */ data_type));
-
-        // Create dense statevector descriptor
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &sv_descriptor,
-            /* int64_t */ num_cols,
-            /* void* */ sv.getData(),
-            /* cudaDataType */ data_type));
-
-        // Create dense statevector prime descriptor
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &sv_prime_descriptor,
-            /* int64_t */ num_rows,
-            /* void* */ d_sv_prime->getData(),
-            /* cudaDataType */ data_type));
-
-        // allocate an external buffer if needed
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ sparseH_descriptor,
-            /* cusparseDnVecDescr_t */ sv_descriptor,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ sv_prime_descriptor,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */
-            CUSPARSE_SPMV_CSR_ALG1, // Can also use CUSPARSE_MV_ALG_DEFAULT
-            /* size_t* */ &bufferSize));
-
-        DataBuffer<cudaDataType_t> dBuffer{bufferSize, device_id, stream_id,
-                                           true};
-
-        // execute SpMV
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ sparseH_descriptor,
-            /* cusparseDnVecDescr_t */ sv_descriptor,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ sv_prime_descriptor,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */
-            CUSPARSE_MV_ALG_DEFAULT,
-            /* void* */ reinterpret_cast<void *>(dBuffer.getData())));
-
-        // destroy matrix/vector descriptors
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(sparseH_descriptor));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(sv_descriptor));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(sv_prime_descriptor));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroy(handle));
-
-        sv.updateData(std::move(d_sv_prime));
+    /**
+     * @brief The accumulator receiving the product.
+     */
+    [[nodiscard]] auto getNumScratchStates() const -> std::size_t override {
+        return 1;
+    }
+
+    /**
+     * @brief Get the sparse matrix of the observable.
+     */
+    [[nodiscard]] auto getMatrix() const -> const CSRMatrixGPU<T, IdxT> & {
+        return *matrix_;
     }
 
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Pennylane::Util::operator<<;
         std::ostringstream ss;
         ss << "SparseHamiltonian: {\n'data' : ";
-        for (const auto &d : data_)
+        for (const auto &d : matrix_->getData())
             ss << d;
         ss << ",\n'indices' : ";
-        for (const auto &i : indices_)
+        for (const auto &i : matrix_->getIndices())
             ss << i;
         ss << ",\n'offsets' : ";
-        for (const auto &o : offsets_)
+        for (const auto &o : matrix_->getOffsets())
             ss << o;
         ss << "\n}";
         return ss.str();
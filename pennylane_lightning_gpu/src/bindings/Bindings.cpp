@@ -23,12 +23,18 @@
 #include "AdjointDiffGPU.hpp"
 #include "JacobianTape.hpp"
 
+#include "CompiledCircuit.hpp"
+#include "DLPack.hpp"
 #include "DevTag.hpp"
+#include "DeviceAllocator.hpp"
+#include "DeviceExecutor.hpp"
 #include "DevicePool.hpp"
 #include "Error.hpp"
+#include "GateTape.hpp"
 #include "StateVectorCudaManaged.hpp"
 #include "StateVectorManagedCPU.hpp"
 #include "StateVectorRawCPU.hpp"
+#include "TransferEngine.hpp"
 #include "cuGateCache.hpp"
 #include "cuda_helpers.hpp"
 
@@ -67,6 +73,13 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         std::is_same<ParamT, float>::value,
         py::array_t<int32_t, py::array::c_style | py::array::forcecast>,
         py::array_t<int64_t, py::array::c_style | py::array::forcecast>>::type;
+    using np_arr_opcode =
+        py::array_t<std::uint8_t, py::array::c_style | py::array::forcecast>;
+    using np_arr_size =
+        py::array_t<std::size_t, py::array::c_style | py::array::forcecast>;
+    using np_arr_bool =
+        py::array_t<bool, py::array::c_style | py::array::forcecast>;
+    using CFP_t = typename StateVectorCudaManaged<PrecisionT>::CFP_t;
     //  Enable module name to be based on size of complex datatype
     const std::string bitsize =
         std::to_string(sizeof(std::complex<PrecisionT>) * 8);
@@ -110,6 +123,11 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             },
             "Set State Vector on GPU with values and their corresponding "
             "indices for the state vector on device")
+        .def("synchronize", &StateVectorCudaManaged<PrecisionT>::synchronize,
+             "Block until the work enqueued on the state vector completes.")
+        .def("query", &StateVectorCudaManaged<PrecisionT>::query,
+             "Check without blocking whether the work enqueued on the state "
+             "vector has completed.")
         .def(
             "Identity",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -253,6 +271,94 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                                const std::vector<std::complex<PrecisionT>> &>(
                  &StateVectorCudaManaged<PrecisionT>::applyOperation_std))
 
+        .def(
+            "applyTape",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const GateTape<PrecisionT> &tape, bool adjoint) {
+                sv.applyTape(tape, adjoint);
+            },
+            py::arg("tape"), py::arg("adjoint") = false,
+            "Apply all gates of a pre-decoded gate tape.")
+
+        .def(
+            "apply_tape",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const np_arr_opcode &opcodes, const np_arr_size &wire_offsets,
+               const np_arr_size &wires, const np_arr_r &params,
+               const np_arr_bool &inverses, const np_arr_c &matrices) {
+                const auto num_ops = static_cast<std::size_t>(opcodes.size());
+                PL_ABORT_IF(static_cast<std::size_t>(wire_offsets.size()) !=
+                                num_ops + 1,
+                            "Wire offsets must hold one entry per gate, plus "
+                            "the total number of wires");
+                PL_ABORT_IF(static_cast<std::size_t>(inverses.size()) !=
+                                num_ops,
+                            "Incompatible number of ops and inverses");
+                PL_ABORT_IF(static_cast<std::size_t>(wires.size()) !=
+                                wire_offsets.at(num_ops),
+                            "Incompatible number of wires and wire offsets");
+
+                // The arrays are kept alive by the caller, so the whole
+                // circuit is decoded and applied without holding the GIL
+                py::gil_scoped_release release;
+                const auto tape = unpackOperations<PrecisionT>(
+                    sv.getNumQubits(), opcodes.data(), num_ops,
+                    wire_offsets.data(), wires.data(), inverses.data(),
+                    params.data(), static_cast<std::size_t>(params.size()),
+                    matrices.data(), static_cast<std::size_t>(matrices.size()));
+                sv.applyUnpackedOperations(tape);
+            },
+            py::arg("opcodes"), py::arg("wire_offsets"), py::arg("wires"),
+            py::arg("params"), py::arg("inverses"), py::arg("matrices"),
+            "Apply a whole circuit given as flat arrays of gate opcodes, "
+            "wires, parameters, inverses and explicit matrices.")
+
+        .def("setGateFusion",
+             &StateVectorCudaManaged<PrecisionT>::setGateFusion,
+             "Set the maximum number of wires of fused gate blocks in the "
+             "multi-op apply calls. A value of 0 disables fusion.")
+        .def("getGateFusion",
+             &StateVectorCudaManaged<PrecisionT>::getGateFusion,
+             "Get the maximum number of wires of fused gate blocks.")
+        .def("getWorkspaceHighWaterMark",
+             &StateVectorCudaManaged<PrecisionT>::getWorkspaceHighWaterMark,
+             "Get the largest cuStateVec workspace size in bytes requested "
+             "so far.")
+        .def("getWorkspaceCapacity",
+             &StateVectorCudaManaged<PrecisionT>::getWorkspaceCapacity,
+             "Get the size in bytes of the held cuStateVec workspace.")
+        .def("releaseWorkspace",
+             &StateVectorCudaManaged<PrecisionT>::releaseWorkspace,
+             "Free the held cuStateVec workspace.")
+        .def("setSeed", &StateVectorCudaManaged<PrecisionT>::setSeed,
+             "Seed the random numbers used for sampling.")
+        .def("getNumSamplerPreprocesses",
+             &StateVectorCudaManaged<PrecisionT>::getNumSamplerPreprocesses,
+             "Get the number of times the sampler was preprocessed.")
+        .def("markStateChanged",
+             &StateVectorCudaManaged<PrecisionT>::markStateChanged,
+             "Record a modification of the state made through an exported "
+             "device view, so that the sampler is preprocessed again.")
+        .def("setGateCacheCapacity",
+             &StateVectorCudaManaged<PrecisionT>::setGateCacheCapacity,
+             "Set the device memory budget in bytes of cached parametric "
+             "gates.")
+        .def(
+            "getGateCacheStats",
+            [](const StateVectorCudaManaged<PrecisionT> &sv) {
+                const auto &cache = sv.getGateCache();
+                py::dict stats;
+                stats["hits"] = cache.getNumHits();
+                stats["misses"] = cache.getNumMisses();
+                stats["evictions"] = cache.getNumEvictions();
+                stats["num_gates"] = cache.getNumGates();
+                stats["allocated_bytes"] = cache.getAllocatedBytes();
+                stats["capacity_bytes"] = cache.getCapacity();
+                return stats;
+            },
+            "Get the hit, miss and eviction counters and the memory usage "
+            "of the device gate cache.")
+
         .def(
             "ControlledPhaseShift",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -503,6 +609,41 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                     static_cast<index_type>(values.request().size)); // nnz
             },
             "Calculate the expectation value of a sparse Hamiltonian.")
+        .def(
+            "ExpectationValue",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const SparseHamiltonianGPU<PrecisionT> &sparse_ham) {
+                return sv.getExpectationValueOnSparseSpMV(
+                    sparse_ham.getMatrix());
+            },
+            "Calculate the expectation value of a sparse Hamiltonian, reusing "
+            "its device copy across calls.")
+        .def(
+            "Variance",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const SparseHamiltonianGPU<PrecisionT> &sparse_ham) {
+                return sv.getVarianceOnSparseSpMV(sparse_ham.getMatrix());
+            },
+            "Calculate the variance of a sparse Hamiltonian, reusing its "
+            "device copy across calls.")
+        .def(
+            "Variance",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const std::vector<std::string> &obsNames,
+               const std::vector<std::size_t> &wires,
+               const np_arr_c &gate_matrix) {
+                const auto m_buffer = gate_matrix.request();
+                std::vector<std::complex<ParamT>> conv_matrix;
+                if (m_buffer.size) {
+                    const auto m_ptr =
+                        static_cast<const std::complex<ParamT> *>(m_buffer.ptr);
+                    conv_matrix = std::vector<std::complex<ParamT>>{
+                        m_ptr, m_ptr + m_buffer.size};
+                }
+                return sv.variance(obsNames, wires, conv_matrix);
+            },
+            "Calculate the variance of the given observable from a single "
+            "pass computing both of its first two moments.")
 
         .def(
             "ExpectationValue",
@@ -518,6 +659,23 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             },
             "Calculate the expectation value of a Hamiltonian composed solely "
             "from sums of Pauli-words")
+        .def(
+            "ExpectationValueGrouped",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const std::vector<std::string> &pauli_words,
+               const std::vector<std::vector<std::size_t>> &target_wires,
+               const np_arr_c &coeffs, std::size_t max_group_wires) {
+                py::buffer_info numpyArrayInfo = coeffs.request();
+                auto *data_ptr =
+                    static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
+                return sv.getExpectationValuePauliWordsGrouped(
+                    pauli_words, target_wires, data_ptr, max_group_wires);
+            },
+            py::arg("pauli_words"), py::arg("target_wires"), py::arg("coeffs"),
+            py::arg("max_group_wires") = 20,
+            "Calculate the expectation value of a Hamiltonian composed solely "
+            "from sums of Pauli-words, measuring qubit-wise-commuting words "
+            "together from one probability pass per group.")
         .def(
             "Probability",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -544,6 +702,26 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      strides /* strides for each axis     */
                      ));
              })
+        .def(
+            "GenerateSamplesPacked",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_shots) {
+                auto &&result = sv.generate_samples_packed(num_shots);
+                return py::array_t<std::int64_t>(result.size(),
+                                                 result.data());
+            },
+            "Generate samples as one basis-state index per shot, in "
+            "ascending order, with wire 0 as the most significant bit.")
+        .def(
+            "GenerateCounts",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_shots) {
+                auto &&[outcomes, counts] = sv.generate_counts(num_shots);
+                return py::make_tuple(
+                    py::array_t<std::int64_t>(outcomes.size(),
+                                              outcomes.data()),
+                    py::array_t<std::size_t>(counts.size(), counts.data()));
+            },
+            "Generate samples and return the distinct basis-state indices "
+            "drawn, in ascending order, with the number of shots of each.")
         .def(
             "DeviceToDevice",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -563,14 +741,18 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         .def(
             "DeviceToHost",
             [](const StateVectorCudaManaged<PrecisionT> &gpu_sv,
-               np_arr_c &cpu_sv, bool) {
+               np_arr_c &cpu_sv, bool, const std::string &mode) {
                 py::buffer_info numpyArrayInfo = cpu_sv.request();
                 auto *data_ptr =
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
                 if (cpu_sv.size()) {
-                    gpu_sv.CopyGpuDataToHost(data_ptr, cpu_sv.size());
+                    gpu_sv.getDataBuffer().CopyGpuDataToHost(
+                        data_ptr, cpu_sv.size(), false,
+                        transferModeFromString(mode));
                 }
             },
+            py::arg("state"), py::arg("use_async") = false,
+            py::arg("mode") = "auto",
             "Synchronize data from the GPU device to host.")
         .def("HostToDevice",
              py::overload_cast<const std::complex<PrecisionT> *, size_t, bool>(
@@ -584,17 +766,130 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         .def(
             "HostToDevice",
             [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
-               const np_arr_c &cpu_sv, bool async) {
+               const np_arr_c &cpu_sv, bool async, const std::string &mode) {
                 const py::buffer_info numpyArrayInfo = cpu_sv.request();
                 const auto *data_ptr =
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
                 const auto length =
                     static_cast<size_t>(numpyArrayInfo.shape[0]);
                 if (length) {
-                    gpu_sv.CopyHostDataToGpu(data_ptr, length, async);
+                    gpu_sv.getDataBuffer().CopyHostDataToGpu(
+                        data_ptr, length, async, transferModeFromString(mode));
                 }
             },
+            py::arg("state"), py::arg("use_async") = false,
+            py::arg("mode") = "auto",
             "Synchronize data from the host device to GPU.")
+        .def(
+            "DeviceToDevice",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
+               const py::object &array) {
+                auto &buffer = gpu_sv.getDataBuffer();
+                const auto interface =
+                    array.attr("__cuda_array_interface__").cast<py::dict>();
+                PL_ABORT_IF(interface["typestr"].cast<std::string>() !=
+                                getCudaArrayTypestr<CFP_t>(),
+                            "The device array does not match the precision "
+                            "of the state vector");
+                std::size_t length = 1;
+                for (const auto dim : interface["shape"].cast<py::tuple>()) {
+                    length *= dim.cast<std::size_t>();
+                }
+                PL_ABORT_IF(length != buffer.getLength(),
+                            "The device array does not match the size of "
+                            "the state vector");
+                if (interface.contains("strides") &&
+                    !interface["strides"].is_none()) {
+                    const auto strides =
+                        interface["strides"].cast<py::tuple>();
+                    PL_ABORT_IF(strides.size() != 1 ||
+                                    strides[0].cast<std::size_t>() !=
+                                        sizeof(std::complex<PrecisionT>),
+                                "The device array must be contiguous");
+                }
+                const auto data_ptr = interface["data"]
+                                          .cast<py::tuple>()[0]
+                                          .cast<std::uintptr_t>();
+
+                // Read the source only once the work of its producer is done
+                if (interface.contains("stream") &&
+                    !interface["stream"].is_none()) {
+                    const auto producer =
+                        interface["stream"].cast<std::uintptr_t>();
+                    streamWaitFor(streamFromProtocol(producer),
+                                  buffer.getStream(), buffer.getDevice());
+                }
+                buffer.CopyGpuDataToGpu(
+                    reinterpret_cast<const CFP_t *>(data_ptr), length, true);
+                PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(buffer.getStream()));
+            },
+            py::arg("array"),
+            "Copy a device array exposing `__cuda_array_interface__`, such as "
+            "a CuPy array or a PyTorch tensor, into the state vector without "
+            "staging through the host.")
+        .def_property_readonly(
+            "__cuda_array_interface__",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv) {
+                const auto &buffer = gpu_sv.getDataBuffer();
+                py::dict interface;
+                interface["shape"] = py::make_tuple(buffer.getLength());
+                interface["typestr"] = getCudaArrayTypestr<CFP_t>();
+                interface["data"] = py::make_tuple(
+                    reinterpret_cast<std::uintptr_t>(buffer.getData()), false);
+                interface["strides"] = py::none();
+                interface["version"] = 3;
+                interface["stream"] = streamToProtocol(buffer.getStream());
+                return interface;
+            },
+            "View of the device buffer of the state vector, following the "
+            "CUDA Array Interface (version 3).")
+        .def("__dlpack_device__",
+             [](const StateVectorCudaManaged<PrecisionT> &gpu_sv) {
+                 return py::make_tuple(static_cast<int>(kDLCUDA),
+                                       gpu_sv.getDataBuffer().getDevice());
+             })
+        .def(
+            "__dlpack__",
+            [](const py::object &self, const py::object &stream) {
+                auto &buffer = self.cast<StateVectorCudaManaged<PrecisionT> &>()
+                                   .getDataBuffer();
+                // None requests the legacy default stream, -1 no ordering
+                const std::intptr_t consumer =
+                    stream.is_none() ? 1 : stream.cast<std::intptr_t>();
+                if (consumer != -1) {
+                    streamWaitFor(buffer.getStream(),
+                                  streamFromProtocol(
+                                      static_cast<std::uintptr_t>(consumer)),
+                                  buffer.getDevice());
+                }
+
+                // The tensor keeps the state vector alive until its deleter
+                self.inc_ref();
+                auto *tensor = makeDLManagedTensor(
+                    buffer.getData(), buffer.getLength(), buffer.getDevice(),
+                    self.ptr(), [](void *owner) {
+                        py::gil_scoped_acquire gil;
+                        Py_DECREF(static_cast<PyObject *>(owner));
+                    });
+                // Unconsumed capsules still own the tensor
+                auto *capsule =
+                    PyCapsule_New(tensor, "dltensor", [](PyObject *obj) {
+                        if (PyCapsule_IsValid(obj, "dltensor")) {
+                            auto *unused = static_cast<DLManagedTensor *>(
+                                PyCapsule_GetPointer(obj, "dltensor"));
+                            unused->deleter(unused);
+                        }
+                    });
+                if (capsule == nullptr) {
+                    tensor->deleter(tensor);
+                    throw py::error_already_set();
+                }
+                return py::reinterpret_steal<py::capsule>(capsule);
+            },
+            py::arg("stream") = py::none(),
+            "Export the device buffer of the state vector as a DLPack "
+            "capsule. Work on the state vector's stream is ordered before "
+            "work on `stream`.")
         .def("GetNumGPUs", &getGPUCount, "Get the number of available GPUs.")
         .def("getCurrentGPU", &getGPUIdx,
              "Get the GPU index for the statevector data.")
@@ -785,6 +1080,106 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             return "Operations: [" + ops_stream.str() + "]";
         });
 
+    class_name = "GateTapeGPU_C" + bitsize;
+    py::class_<GateTape<PrecisionT>>(m, class_name.c_str(), py::module_local())
+        .def(py::init([](std::size_t num_qubits,
+                         const std::vector<std::string> &ops_name,
+                         const std::vector<np_arr_r> &ops_params,
+                         const std::vector<std::vector<size_t>> &ops_wires,
+                         const std::vector<bool> &ops_inverses,
+                         const std::vector<np_arr_c> &ops_matrices) {
+            std::vector<std::vector<PrecisionT>> conv_params(ops_params.size());
+            std::vector<std::vector<std::complex<PrecisionT>>> conv_matrices(
+                ops_matrices.size());
+            for (size_t op = 0; op < ops_name.size(); op++) {
+                const auto p_buffer = ops_params[op].request();
+                const auto m_buffer = ops_matrices[op].request();
+                if (p_buffer.size) {
+                    const auto *const p_ptr =
+                        static_cast<const ParamT *>(p_buffer.ptr);
+                    conv_params[op] =
+                        std::vector<ParamT>{p_ptr, p_ptr + p_buffer.size};
+                }
+                if (m_buffer.size) {
+                    const auto m_ptr =
+                        static_cast<const std::complex<ParamT> *>(m_buffer.ptr);
+                    conv_matrices[op] = std::vector<std::complex<ParamT>>{
+                        m_ptr, m_ptr + m_buffer.size};
+                }
+            }
+            return GateTape<PrecisionT>(num_qubits, ops_name, ops_wires,
+                                        ops_inverses, conv_params,
+                                        conv_matrices);
+        }))
+        .def(py::init([](std::size_t num_qubits,
+                         const OpsData<PrecisionT> &ops) {
+            return GateTape<PrecisionT>::fromOpsData(num_qubits, ops);
+        }))
+        .def("setParameters", &GateTape<PrecisionT>::setParameters,
+             "Rebind all gate parameters from a flat list.")
+        .def("getParameters", &GateTape<PrecisionT>::getParameters)
+        .def("getNumQubits", &GateTape<PrecisionT>::getNumQubits)
+        .def("getNumOps", &GateTape<PrecisionT>::getNumOps)
+        .def("getNumParams", &GateTape<PrecisionT>::getNumParams);
+
+    class_name = "CompiledCircuitGPU_C" + bitsize;
+    py::class_<CompiledCircuit<PrecisionT>>(m, class_name.c_str(),
+                                            py::module_local())
+        .def(py::init([](std::size_t num_qubits,
+                         const std::vector<std::string> &ops_name,
+                         const std::vector<std::vector<size_t>> &ops_wires,
+                         const std::vector<bool> &ops_inverses,
+                         const std::vector<np_arr_c> &ops_matrices,
+                         std::size_t max_fused_wires) {
+                 std::vector<std::vector<std::complex<PrecisionT>>>
+                     conv_matrices(ops_matrices.size());
+                 for (size_t op = 0; op < ops_matrices.size(); op++) {
+                     const auto m_buffer = ops_matrices[op].request();
+                     if (m_buffer.size) {
+                         const auto m_ptr =
+                             static_cast<const std::complex<ParamT> *>(
+                                 m_buffer.ptr);
+                         conv_matrices[op] = std::vector<std::complex<ParamT>>{
+                             m_ptr, m_ptr + m_buffer.size};
+                     }
+                 }
+                 return CompiledCircuit<PrecisionT>(
+                     num_qubits, ops_name, ops_wires, ops_inverses,
+                     conv_matrices, max_fused_wires);
+             }),
+             py::arg("num_qubits"), py::arg("ops_name"), py::arg("ops_wires"),
+             py::arg("ops_inverses"), py::arg("ops_matrices"),
+             py::arg("max_fused_wires") = 0)
+        .def(
+            "execute",
+            [](CompiledCircuit<PrecisionT> &circuit,
+               StateVectorCudaManaged<PrecisionT> &sv, const np_arr_r &params) {
+                const auto p_buffer = params.request();
+                const auto *const p_ptr =
+                    static_cast<const ParamT *>(p_buffer.ptr);
+                circuit.execute(
+                    sv, std::vector<ParamT>{p_ptr, p_ptr + p_buffer.size});
+            },
+            "Rebind the gate parameters from a flat array and apply the "
+            "circuit to a state-vector.")
+        .def(
+            "executeGraph",
+            [](CompiledCircuit<PrecisionT> &circuit,
+               StateVectorCudaManaged<PrecisionT> &sv, const np_arr_r &params) {
+                const auto p_buffer = params.request();
+                const auto *const p_ptr =
+                    static_cast<const ParamT *>(p_buffer.ptr);
+                circuit.executeGraph(
+                    sv, std::vector<ParamT>{p_ptr, p_ptr + p_buffer.size});
+            },
+            "Rebind the gate parameters from a flat array and apply the "
+            "circuit to a state-vector by replaying a captured CUDA graph.")
+        .def("getNumQubits", &CompiledCircuit<PrecisionT>::getNumQubits)
+        .def("getNumOps", &CompiledCircuit<PrecisionT>::getNumOps)
+        .def("getNumCompiledOps",
+             &CompiledCircuit<PrecisionT>::getNumCompiledOps)
+        .def("getNumParams", &CompiledCircuit<PrecisionT>::getNumParams);
+
     //***********************************************************************//
     //                              Adj Jac
     //***********************************************************************//
@@ -827,6 +1222,19 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                  return OpsData<PrecisionT>{ops_name, conv_params, ops_wires,
                                             ops_inverses, conv_matrices};
              })
+        .def("setMemoryBudget",
+             &AdjointJacobianGPU<PrecisionT>::setMemoryBudget,
+             "Bound the device memory per GPU used by the adjoint Jacobian, "
+             "processing the observables in tiles. 0 disables tiling.")
+        .def("getMemoryBudget",
+             &AdjointJacobianGPU<PrecisionT>::getMemoryBudget)
+        .def_static("getObservableTileSize",
+                    &AdjointJacobianGPU<PrecisionT>::getObservableTileSize,
+                    "Number of observables processed together within a "
+                    "memory budget.",
+                    py::arg("num_qubits"), py::arg("num_observables"),
+                    py::arg("budget_bytes"),
+                    py::arg("num_scratch_states") = 0)
         .def("adjoint_jacobian",
              &AdjointJacobianGPU<PrecisionT>::adjointJacobian)
         .def("adjoint_jacobian",
@@ -860,6 +1268,22 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                                           observables, operations,
                                           trainableParams, false);
                  return py::array_t<ParamT>(py::cast(jac));
+             })
+        .def("vector_jacobian_product",
+             [](AdjointJacobianGPU<PrecisionT> &adj,
+                const StateVectorCudaManaged<PrecisionT> &sv,
+                const std::vector<std::shared_ptr<ObservableGPU<PrecisionT>>>
+                    &observables,
+                const Pennylane::Algorithms::OpsData<PrecisionT> &operations,
+                const std::vector<size_t> &trainableParams,
+                const std::vector<PrecisionT> &dy) {
+                 std::vector<PrecisionT> vjp(trainableParams.size(), 0);
+
+                 adj.vectorJacobianProduct(
+                     sv.getData(), sv.getLength(), vjp, dy, observables,
+                     operations, trainableParams, false,
+                     sv.getDataBuffer().getDevTag());
+                 return py::array_t<ParamT>(py::cast(vjp));
              });
 }
 
@@ -875,7 +1299,55 @@ PYBIND11_MODULE(lightning_gpu_qubit_ops, // NOLINT: No control over
     options.disable_function_signatures();
     py::register_exception<LightningException>(m, "PLException");
 
-    m.def("device_reset", &deviceReset, "Reset all GPU devices and contexts.");
+    m.def(
+        "device_reset",
+        []() {
+            DeviceExecutor<int>::getInstance().clearLocalState();
+            DeviceAllocator::getDefault()->releaseCached();
+            TransferEngine::releaseAll();
+            deviceReset();
+        },
+        "Reset all GPU devices and contexts.");
+    // Release the cached library handles and the device memory kept by the
+    // batch workers, the allocator and the transfer engines while the CUDA
+    // runtime is still alive
+    m.add_object("_cleanup", py::capsule([]() {
+                     DeviceExecutor<int>::getInstance().clearLocalState();
+                     DeviceAllocator::getDefault()->releaseCached();
+                     TransferEngine::releaseAll();
+                     clearHandleRegistries();
+                 }));
+    m.def(
+        "allocator_stats",
+        []() {
+            const auto stats = DeviceAllocator::getDefault()->getStats();
+            py::dict info;
+            info["num_requests"] = stats.num_requests;
+            info["num_cache_hits"] = stats.num_cache_hits;
+            info["num_device_allocations"] = stats.num_device_allocations;
+            info["num_device_frees"] = stats.num_device_frees;
+            info["bytes_in_use"] = stats.bytes_in_use;
+            info["peak_bytes_in_use"] = stats.peak_bytes_in_use;
+            info["bytes_cached"] = stats.bytes_cached;
+            return info;
+        },
+        "Get the statistics of the device memory allocator.");
+    m.def(
+        "release_cached_memory",
+        []() { DeviceAllocator::getDefault()->releaseCached(); },
+        "Free the device memory cached by the allocator.");
+    m.def(
+        "gate_opcodes",
+        []() {
+            py::dict opcodes;
+            for (const auto &[name, opcode] : getGateOps()) {
+                opcodes[py::str(name)] = static_cast<int>(opcode);
+            }
+            opcodes["Matrix"] = static_cast<int>(GateOp::Matrix);
+            return opcodes;
+        },
+        "Get the opcodes of the gates understood by `apply_tape`. Other gates "
+        "are passed with the \"Matrix\" opcode and an explicit matrix.");
     m.def("allToAllAccess", []() {
         for (int i = 0; i < static_cast<int>(getGPUCount()); i++) {
             cudaDeviceEnablePeerAccess(i, 0);
@@ -0,0 +1,273 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file CSRMatrixGPU.hpp
+ * Sparse CSR matrix kept resident on the devices it is used on.
+ */
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <cusparse_v2.h>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "Error.hpp"
+#include "WorkspaceArena.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+using namespace cuUtil;
+
+} // namespace
+/// @endcond
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Square sparse matrix in CSR format, with a device copy per GPU.
+ *
+ * The host arrays are uploaded to a device on the first product computed
+ * there. The device arrays, the cuSPARSE matrix and vector descriptors, and
+ * the SpMV workspace are then reused by all later products on that device,
+ * so repeated expectation values and adjoint passes only pay for the SpMV
+ * itself. The matrix is immutable after construction.
+ *
+ * @tparam PrecisionT Floating point precision of the matrix values.
+ * @tparam IdxT Integer type of the CSR indices, `int32_t` or `int64_t`.
+ */
+template <class PrecisionT, class IdxT> class CSRMatrixGPU {
+  public:
+    using CFP_t = decltype(cuUtil::getCudaType(PrecisionT{}));
+    static_assert(std::is_same_v<IdxT, int32_t> ||
+                      std::is_same_v<IdxT, int64_t>,
+                  "cuSPARSE supports 32 and 64-bit CSR indices only.");
+
+    /**
+     * @brief Create a matrix from CSR host data.
+     *
+     * @param data Non-zero values.
+     * @param indices Column index of each non-zero value.
+     * @param offsets Row offsets into `data`, of size num_rows + 1.
+     */
+    CSRMatrixGPU(std::vector<std::complex<PrecisionT>> data,
+                 std::vector<IdxT> indices, std::vector<IdxT> offsets)
+        : data_{std::move(data)}, indices_{std::move(indices)},
+          offsets_{std::move(offsets)} {
+        PL_ABORT_IF_NOT(data_.size() == indices_.size(),
+                        "CSR values and column indices differ in size.");
+        PL_ABORT_IF(offsets_.empty(), "CSR row offsets must not be empty.");
+    }
+    CSRMatrixGPU(const CSRMatrixGPU &) = delete;
+    CSRMatrixGPU(CSRMatrixGPU &&) = delete;
+    CSRMatrixGPU &operator=(const CSRMatrixGPU &) = delete;
+    CSRMatrixGPU &operator=(CSRMatrixGPU &&) = delete;
+    ~CSRMatrixGPU() = default;
+
+    /**
+     * @brief Compute y = A x on the device and stream of `dev_tag`.
+     *
+     * @param x Device pointer to the input vector, of size num_rows.
+     * @param y Device pointer to the output vector, of size num_rows. Must not
+     * alias `x`.
+     * @param dev_tag Device and stream the vectors live on.
+     */
+    void SpMV(const CFP_t *x, CFP_t *y, const DevTag<int> &dev_tag) const {
+        DeviceCopy &copy = getDeviceCopy(dev_tag);
+        std::lock_guard<std::mutex> lock(copy.mutex);
+
+        const int device_id = dev_tag.getDeviceID();
+        const cudaStream_t stream_id = dev_tag.getStreamID();
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id));
+        cusparseHandle_t handle =
+            cuUtil::CusparseHandleRegistry::getInstance().getHandle(
+                device_id, stream_id);
+
+        auto &workspace = copy.workspaces[stream_id];
+        if (!workspace) {
+            workspace = std::make_unique<WorkspaceArena<int>>(dev_tag);
+        }
+        void *buffer = workspace->acquire(copy.buffer_size);
+
+        PL_CUSPARSE_IS_SUCCESS(cusparseDnVecSetValues(
+            copy.vec_x, const_cast<void *>(static_cast<const void *>(x))));
+        PL_CUSPARSE_IS_SUCCESS(
+            cusparseDnVecSetValues(copy.vec_y, static_cast<void *>(y)));
+
+        const CFP_t alpha{1.0, 0.0};
+        const CFP_t beta{0.0, 0.0};
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
+            /* cusparseHandle_t */ handle,
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ copy.mat,
+            /* cusparseDnVecDescr_t */ copy.vec_x,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ copy.vec_y,
+            /* cudaDataType */ getDataType(),
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* void* */ buffer));
+    }
+
+    [[nodiscard]] auto getNumRows() const -> std::size_t {
+        return offsets_.size() - 1;
+    }
+    [[nodiscard]] auto getNumNonZeros() const -> std::size_t {
+        return data_.size();
+    }
+    [[nodiscard]] auto getData() const
+        -> const std::vector<std::complex<PrecisionT>> & {
+        return data_;
+    }
+    [[nodiscard]] auto getIndices() const -> const std::vector<IdxT> & {
+        return indices_;
+    }
+    [[nodiscard]] auto getOffsets() const -> const std::vector<IdxT> & {
+        return offsets_;
+    }
+
+    /**
+     * @brief Get the number of host to device uploads of the matrix so far.
+     */
+    [[nodiscard]] auto getNumUploads() const -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_uploads_;
+    }
+
+  private:
+    /**
+     * @brief Device arrays and cuSPARSE state of the matrix on one device.
+     */
+    struct DeviceCopy {
+        DataBuffer<IdxT, int> offsets;
+        DataBuffer<IdxT, int> columns;
+        DataBuffer<CFP_t, int> values;
+        cusparseSpMatDescr_t mat{nullptr};
+        cusparseDnVecDescr_t vec_x{nullptr};
+        cusparseDnVecDescr_t vec_y{nullptr};
+        std::size_t buffer_size{0};
+        std::map<cudaStream_t, std::unique_ptr<WorkspaceArena<int>>>
+            workspaces;
+        std::mutex mutex;
+
+        DeviceCopy(std::size_t num_offsets, std::size_t nnz,
+                   const DevTag<int> &dev_tag)
+            : offsets{num_offsets, dev_tag}, columns{nnz, dev_tag},
+              values{nnz, dev_tag} {}
+        DeviceCopy(const DeviceCopy &) = delete;
+        DeviceCopy(DeviceCopy &&) = delete;
+        ~DeviceCopy() {
+            cusparseDestroySpMat(mat);
+            cusparseDestroyDnVec(vec_x);
+            cusparseDestroyDnVec(vec_y);
+        }
+    };
+
+    std::vector<std::complex<PrecisionT>> data_;
+    std::vector<IdxT> indices_;
+    std::vector<IdxT> offsets_;
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<int, std::unique_ptr<DeviceCopy>>
+        device_copies_;
+    mutable std::size_t num_uploads_{0};
+
+    static constexpr auto getDataType() -> cudaDataType_t {
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            return CUDA_C_64F;
+        } else {
+            return CUDA_C_32F;
+        }
+    }
+
+    static constexpr auto getIndexType() -> cusparseIndexType_t {
+        if constexpr (std::is_same_v<IdxT, int64_t>) {
+            return CUSPARSE_INDEX_64I;
+        } else {
+            return CUSPARSE_INDEX_32I;
+        }
+    }
+
+    /**
+     * @brief Get the device copy for the device of `dev_tag`, uploading the
+     * matrix and creating its descriptors on first use.
+     */
+    auto getDeviceCopy(const DevTag<int> &dev_tag) const -> DeviceCopy & {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const int device_id = dev_tag.getDeviceID();
+        if (auto it = device_copies_.find(device_id);
+            it != device_copies_.end()) {
+            return *it->second;
+        }
+
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id));
+        auto copy = std::make_unique<DeviceCopy>(offsets_.size(), data_.size(),
+                                                 dev_tag);
+        copy->offsets.CopyHostDataToGpu(offsets_.data(), offsets_.size());
+        copy->columns.CopyHostDataToGpu(indices_.data(), indices_.size());
+        copy->values.CopyHostDataToGpu(data_.data(), data_.size());
+
+        const auto num_rows = static_cast<int64_t>(getNumRows());
+        const auto nnz = static_cast<int64_t>(data_.size());
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
+            /* cusparseSpMatDescr_t* */ &copy->mat,
+            /* int64_t */ num_rows,
+            /* int64_t */ num_rows,
+            /* int64_t */ nnz,
+            /* void* */ copy->offsets.getData(),
+            /* void* */ copy->columns.getData(),
+            /* void* */ copy->values.getData(),
+            /* cusparseIndexType_t */ getIndexType(),
+            /* cusparseIndexType_t */ getIndexType(),
+            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
+            /* cudaDataType */ getDataType()));
+        // The vector descriptors are rebound to the operands of each product
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            &copy->vec_x, num_rows, copy->values.getData(), getDataType()));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            &copy->vec_y, num_rows, copy->values.getData(), getDataType()));
+
+        const CFP_t alpha{1.0, 0.0};
+        const CFP_t beta{0.0, 0.0};
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
+            /* cusparseHandle_t */
+            cuUtil::CusparseHandleRegistry::getInstance().getHandle(
+                device_id, dev_tag.getStreamID()),
+            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
+            /* const void* */ &alpha,
+            /* cusparseSpMatDescr_t */ copy->mat,
+            /* cusparseDnVecDescr_t */ copy->vec_x,
+            /* const void* */ &beta,
+            /* cusparseDnVecDescr_t */ copy->vec_y,
+            /* cudaDataType */ getDataType(),
+            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
+            /* size_t* */ &copy->buffer_size));
+
+        num_uploads_++;
+        return *device_copies_.emplace(device_id, std::move(copy))
+                    .first->second;
+    }
+};
+
+} // namespace Pennylane::CUDA
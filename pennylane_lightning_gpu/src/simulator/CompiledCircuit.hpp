@@ -0,0 +1,295 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file CompiledCircuit.hpp
+ * Circuit structure compiled once and replayed with new parameters.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "Error.hpp"
+#include "GateFusion.hpp"
+#include "GateTape.hpp"
+#include "StagingPool.hpp"
+#include "TapeGraph.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief A circuit structure, given by its gate names, wires and adjoints,
+ * compiled once into a `GateTape` and replayed with new parameters.
+ *
+ * Compilation decodes the gates into opcodes and cuStateVec wire indices, and
+ * fuses runs of gates without parameters into dense matrices when
+ * `max_fused_wires` is non-zero. Gates with parameters are kept as separate
+ * tape operations, so that `execute` only rebinds the flat parameter array and
+ * replays the tape: no gate names are looked up, no matrices are fused and no
+ * gate cache is queried per call. The fused and explicit matrices of the tape
+ * are uploaded once into a device matrix table, of which each call only
+ * rewrites the slots of the excitation gates, through pinned memory.
+ * `executeGraph` replays the tape as a CUDA graph captured once per
+ * state-vector, laid out by a `TapeGraphPlan` built on first use.
+ *
+ * @tparam PrecisionT Floating point precision of the parameters.
+ */
+template <class PrecisionT> class CompiledCircuit {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = typename GateTape<PrecisionT>::CFP_t;
+
+    /**
+     * @brief Compile a circuit structure.
+     *
+     * @param num_qubits Number of qubits of the target state-vector.
+     * @param opNames Names of gates.
+     * @param wires Wires of each gate.
+     * @param adjoints Indicates whether to use the adjoint of each gate.
+     * @param matrices Optional host matrices in row-major order, used for
+     * gates without a dedicated opcode. They are fixed by the compilation.
+     * May be empty.
+     * @param max_fused_wires Maximum number of wires of a fused block of gates
+     * without parameters. A value of 0 disables fusion.
+     */
+    CompiledCircuit(std::size_t num_qubits,
+                    const std::vector<std::string> &opNames,
+                    const std::vector<std::vector<std::size_t>> &wires,
+                    const std::vector<bool> &adjoints,
+                    const std::vector<std::vector<ComplexT>> &matrices = {},
+                    std::size_t max_fused_wires = 0)
+        : num_ops_{opNames.size()},
+          tape_{compile(num_qubits, opNames, wires, adjoints, matrices,
+                        max_fused_wires)} {
+        for (const auto &op : tape_.getOps()) {
+            if (GateTape<PrecisionT>::hasParametricMatrix(op.opcode)) {
+                parametric_slots_.emplace_back(
+                    op.matrix_offset, Pennylane::Util::exp2(2 * op.num_tgts));
+            }
+        }
+    }
+
+    /**
+     * @brief Rebind the gate parameters and apply the circuit to a
+     * state-vector.
+     *
+     * The matrix table is uploaded on the first call for the device and
+     * stream of `sv`, and only its parametric slots on later calls.
+     *
+     * @tparam StateVectorT State-vector type providing `getDevTag` and
+     * `applyTape`.
+     * @param sv State-vector with the number of qubits of the circuit.
+     * @param params Flat parameter array of size `getNumParams()`, in the
+     * order in which the gates consume them.
+     */
+    template <class StateVectorT>
+    void execute(StateVectorT &sv, const std::vector<PrecisionT> &params) {
+        tape_.setParameters(params);
+        sv.applyTape(tape_, false, uploadMatrices(sv.getDevTag()));
+    }
+
+    /**
+     * @brief Rebind the gate parameters and apply the circuit to a
+     * state-vector by launching a captured CUDA graph.
+     *
+     * @tparam StateVectorT State-vector type providing `applyTapeGraph`.
+     * @param sv State-vector with the number of qubits of the circuit.
+     * @param params Flat parameter array of size `getNumParams()`, in the
+     * order in which the gates consume them.
+     */
+    template <class StateVectorT>
+    void executeGraph(StateVectorT &sv, const std::vector<PrecisionT> &params) {
+        tape_.setParameters(params);
+        sv.applyTapeGraph(tape_, getGraphPlan());
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return tape_.getNumQubits();
+    }
+    /// Number of gates of the circuit before compilation.
+    [[nodiscard]] auto getNumOps() const -> std::size_t { return num_ops_; }
+    /// Number of operations applied per execution.
+    [[nodiscard]] auto getNumCompiledOps() const -> std::size_t {
+        return tape_.getNumOps();
+    }
+    [[nodiscard]] auto getNumParams() const -> std::size_t {
+        return tape_.getNumParams();
+    }
+    [[nodiscard]] auto getTape() const -> const GateTape<PrecisionT> & {
+        return tape_;
+    }
+    /// Counters of the uploads to the device matrix table used by `execute`.
+    [[nodiscard]] auto getMatrixStagingStats() const -> StagingPool::Stats {
+        return device_matrices_ ? device_matrices_->staging.getStats()
+                                : StagingPool::Stats{};
+    }
+    /// Graph plan of the compiled tape, shared by all `executeGraph` calls.
+    auto getGraphPlan() -> const TapeGraphPlan<PrecisionT> & {
+        if (!plan_) {
+            plan_.emplace(tape_);
+        }
+        return *plan_;
+    }
+
+  private:
+    /// Device copy of the matrices of the tape, for a device and stream.
+    struct DeviceMatrices {
+        DeviceMatrices(std::size_t size, const DevTag<int> &dev_tag)
+            : table{size, dev_tag, true}, staging{dev_tag.getStreamID()} {}
+
+        DataBuffer<CFP_t, int> table;
+        StagingPool staging;
+    };
+
+    std::size_t num_ops_;
+    GateTape<PrecisionT> tape_;
+    /// Offsets and sizes of the matrices rewritten by `setParameters`
+    std::vector<std::pair<std::size_t, std::size_t>> parametric_slots_;
+    std::unique_ptr<DeviceMatrices> device_matrices_;
+    std::optional<TapeGraphPlan<PrecisionT>> plan_;
+
+    /**
+     * @brief Bring the device matrix table up to date with the tape. The whole
+     * table is uploaded when it is first used on a device and stream, and
+     * afterwards only the parametric slots.
+     *
+     * @param dev_tag Device and stream of the target state-vector.
+     * @return const CFP_t* Device matrix table, or nullptr if the tape holds
+     * no matrix.
+     */
+    auto uploadMatrices(const DevTag<int> &dev_tag) -> const CFP_t * {
+        const auto &matrices = tape_.getMatrices();
+        if (matrices.empty()) {
+            return nullptr;
+        }
+        if (!device_matrices_ ||
+            device_matrices_->table.getDevTag().getDeviceID() !=
+                dev_tag.getDeviceID() ||
+            device_matrices_->table.getDevTag().getStreamID() !=
+                dev_tag.getStreamID()) {
+            device_matrices_.reset();
+            device_matrices_ =
+                std::make_unique<DeviceMatrices>(matrices.size(), dev_tag);
+            device_matrices_->staging.copyHostToDevice(
+                device_matrices_->table.getData(), matrices.data(),
+                sizeof(CFP_t) * matrices.size());
+        } else {
+            for (const auto &[offset, size] : parametric_slots_) {
+                device_matrices_->staging.copyHostToDevice(
+                    device_matrices_->table.getData() + offset,
+                    matrices.data() + offset, sizeof(CFP_t) * size);
+            }
+        }
+        return device_matrices_->table.getData();
+    }
+
+    static auto compile(std::size_t num_qubits,
+                        const std::vector<std::string> &opNames,
+                        const std::vector<std::vector<std::size_t>> &wires,
+                        const std::vector<bool> &adjoints,
+                        const std::vector<std::vector<ComplexT>> &matrices,
+                        std::size_t max_fused_wires) -> GateTape<PrecisionT> {
+        PL_ABORT_IF(opNames.size() != wires.size(),
+                    "Incompatible number of ops and wires");
+        PL_ABORT_IF(opNames.size() != adjoints.size(),
+                    "Incompatible number of ops and adjoints");
+        PL_ABORT_IF(!matrices.empty() && matrices.size() != opNames.size(),
+                    "Incompatible number of ops and matrices");
+
+        std::vector<std::string> tape_names;
+        std::vector<std::vector<std::size_t>> tape_wires;
+        std::vector<bool> tape_adjoints;
+        std::vector<std::vector<PrecisionT>> tape_params;
+        std::vector<std::vector<ComplexT>> tape_matrices;
+
+        const auto emit = [&](std::size_t op_idx) {
+            const GateOp opcode = lookupGateOp(opNames[op_idx]);
+            tape_names.push_back(opNames[op_idx]);
+            tape_wires.push_back(wires[op_idx]);
+            tape_adjoints.push_back(adjoints[op_idx]);
+            // Placeholders, rebound by each execution
+            tape_params.emplace_back(getGateOpNumParams(opcode), 0);
+            tape_matrices.push_back(matrices.empty() ? std::vector<ComplexT>{}
+                                                     : matrices[op_idx]);
+        };
+
+        if (max_fused_wires == 0) {
+            for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+                emit(op_idx);
+            }
+            return GateTape<PrecisionT>(num_qubits, tape_names, tape_wires,
+                                        tape_adjoints, tape_params,
+                                        tape_matrices);
+        }
+
+        GateFusion<PrecisionT> fusion(max_fused_wires);
+        std::size_t block_start = 0;
+        const auto flush = [&]() {
+            if (fusion.getNumGates() == 1) {
+                emit(block_start);
+            } else if (!fusion.empty()) {
+                tape_names.push_back(getGateOpName(GateOp::Matrix));
+                tape_wires.push_back(fusion.getWires());
+                tape_adjoints.push_back(false);
+                tape_params.emplace_back();
+                tape_matrices.push_back(fusion.getMatrix());
+            }
+            fusion.clear();
+        };
+
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            const GateOp opcode = lookupGateOp(opNames[op_idx]);
+            if (opcode == GateOp::Identity) {
+                continue;
+            }
+            std::vector<ComplexT> matrix;
+            if (getGateOpNumParams(opcode) == 0 &&
+                wires[op_idx].size() <= max_fused_wires) {
+                if (opcode != GateOp::Matrix) {
+                    matrix = GateFusion<PrecisionT>::getGateMatrix(
+                        opNames[op_idx], wires[op_idx].size(), {},
+                        adjoints[op_idx]);
+                } else if (!matrices.empty() && !adjoints[op_idx]) {
+                    matrix = matrices[op_idx];
+                }
+            }
+            if (matrix.empty()) {
+                flush();
+                emit(op_idx);
+                continue;
+            }
+            if (!fusion.empty() && !fusion.tryFuse(matrix, wires[op_idx])) {
+                flush();
+            }
+            if (fusion.empty()) {
+                block_start = op_idx;
+                fusion.tryFuse(matrix, wires[op_idx]);
+            }
+        }
+        flush();
+
+        return GateTape<PrecisionT>(num_qubits, tape_names, tape_wires,
+                                    tape_adjoints, tape_params, tape_matrices);
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,237 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file DiagonalFusion.hpp
+ * Host-side representation and folding of diagonal gates.
+ */
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Error.hpp"
+#include "Util.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Accumulates a run of diagonal gates into a single diagonal over the
+ * union of their wires. Diagonal gates commute, so any run of them can be
+ * folded regardless of the wires they act upon, and applied to the
+ * state-vector without a dense matrix.
+ *
+ * The wire ordering follows the PennyLane convention: the first wire returned
+ * by `getWires()` is the most significant bit of the diagonal index.
+ *
+ * @tparam PrecisionT Floating point precision of the diagonal.
+ */
+template <class PrecisionT> class DiagonalFusion {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+
+    /// Largest folded diagonal accepted, bounding the host buffer size.
+    static constexpr std::size_t max_supported_wires = 20;
+
+    explicit DiagonalFusion(std::size_t max_wires) : max_wires_{max_wires} {
+        PL_ABORT_IF(max_wires == 0 || max_wires > max_supported_wires,
+                    "Diagonal folding supports blocks of 1 to 20 wires.");
+    }
+
+    /**
+     * @brief Check whether the named gate is diagonal in the computational
+     * basis.
+     *
+     * @param opName Name of gate.
+     */
+    static bool isDiagonal(const std::string &opName) {
+        return diagonal_gates_.find(opName) != diagonal_gates_.end();
+    }
+
+    /**
+     * @brief Return the diagonal of a named gate, or an empty vector if the
+     * gate is not diagonal, or if the wire or parameter counts do not match.
+     *
+     * @param opName Name of gate.
+     * @param num_wires Number of wires the gate acts upon.
+     * @param params Gate parameters.
+     * @param adjoint Return the diagonal of the adjoint gate.
+     */
+    static auto getGateDiagonal(const std::string &opName,
+                                std::size_t num_wires,
+                                const std::vector<PrecisionT> &params,
+                                bool adjoint) -> std::vector<ComplexT> {
+        std::vector<ComplexT> diag =
+            getNamedDiagonal(opName, num_wires, params);
+        if (adjoint) {
+            std::transform(diag.begin(), diag.end(), diag.begin(),
+                           [](const ComplexT &x) { return std::conj(x); });
+        }
+        return diag;
+    }
+
+    /**
+     * @brief Attempt to fold the given diagonal gate into the current block.
+     *
+     * @param diagonal Diagonal of the gate over `wires`.
+     * @param wires Wires the gate acts upon.
+     * @return true The gate was folded.
+     * @return false Folding would exceed `max_wires`; block unchanged.
+     */
+    bool tryFuse(const std::vector<ComplexT> &diagonal,
+                 const std::vector<std::size_t> &wires) {
+        std::size_t new_wires = 0;
+        for (const auto w : wires) {
+            if (std::find(wires_.begin(), wires_.end(), w) == wires_.end()) {
+                new_wires++;
+            }
+        }
+        if (wires_.size() + new_wires > max_wires_) {
+            return false;
+        }
+        PL_ABORT_IF(diagonal.size() != Pennylane::Util::exp2(wires.size()),
+                    "Gate diagonal size does not match the number of wires.");
+
+        for (const auto w : wires) {
+            if (std::find(wires_.begin(), wires_.end(), w) == wires_.end()) {
+                expandBlock(w);
+            }
+        }
+
+        const std::size_t num_block = wires_.size();
+        std::vector<std::size_t> shifts(wires.size());
+        for (std::size_t j = 0; j < wires.size(); j++) {
+            const auto pos = static_cast<std::size_t>(
+                std::find(wires_.begin(), wires_.end(), wires[j]) -
+                wires_.begin());
+            shifts[j] = num_block - 1 - pos;
+        }
+        for (std::size_t i = 0; i < diagonal_.size(); i++) {
+            std::size_t sub_idx = 0;
+            for (const auto shift : shifts) {
+                sub_idx = (sub_idx << 1U) | ((i >> shift) & 1U);
+            }
+            diagonal_[i] *= diagonal[sub_idx];
+        }
+        num_gates_++;
+        return true;
+    }
+
+    /**
+     * @brief Reset the block to an empty run.
+     */
+    void clear() {
+        wires_.clear();
+        diagonal_.clear();
+        num_gates_ = 0;
+    }
+
+    [[nodiscard]] bool empty() const { return num_gates_ == 0; }
+    [[nodiscard]] std::size_t getNumGates() const { return num_gates_; }
+    [[nodiscard]] std::size_t getMaxWires() const { return max_wires_; }
+    [[nodiscard]] auto getWires() const -> const std::vector<std::size_t> & {
+        return wires_;
+    }
+    [[nodiscard]] auto getDiagonal() const -> const std::vector<ComplexT> & {
+        return diagonal_;
+    }
+
+  private:
+    std::size_t max_wires_;
+    std::size_t num_gates_{0};
+    std::vector<std::size_t> wires_;
+    std::vector<ComplexT> diagonal_;
+
+    inline static const std::unordered_set<std::string> diagonal_gates_{
+        "Identity", "I",       "PauliZ",     "S",
+        "T",        "RZ",      "PhaseShift", "CZ",
+        "CRZ",      "IsingZZ", "MultiRZ",    "ControlledPhaseShift"};
+
+    static auto getNamedDiagonal(const std::string &opName,
+                                 std::size_t num_wires,
+                                 const std::vector<PrecisionT> &params)
+        -> std::vector<ComplexT> {
+        const std::size_t dim = Pennylane::Util::exp2(num_wires);
+        const ComplexT one{1, 0};
+        const auto phase = [](PrecisionT angle) {
+            return ComplexT{std::cos(angle), std::sin(angle)};
+        };
+
+        if (opName == "Identity" || opName == "I") {
+            return std::vector<ComplexT>(dim, one);
+        }
+        if (opName == "PauliZ" && num_wires == 1) {
+            return {one, -one};
+        }
+        if (opName == "S" && num_wires == 1) {
+            return {one, {0, 1}};
+        }
+        if (opName == "T" && num_wires == 1) {
+            return {one, phase(static_cast<PrecisionT>(M_PI / 4))};
+        }
+        if (opName == "CZ" && num_wires == 2) {
+            return {one, one, one, -one};
+        }
+        if (params.empty()) {
+            return {};
+        }
+        const PrecisionT angle = params.front();
+        if (opName == "RZ" && num_wires == 1) {
+            return {phase(-angle / 2), phase(angle / 2)};
+        }
+        if (opName == "PhaseShift" && num_wires == 1) {
+            return {one, phase(angle)};
+        }
+        if (opName == "CRZ" && num_wires == 2) {
+            return {one, one, phase(-angle / 2), phase(angle / 2)};
+        }
+        if (opName == "ControlledPhaseShift" && num_wires == 2) {
+            return {one, one, one, phase(angle)};
+        }
+        if ((opName == "IsingZZ" && num_wires == 2) || opName == "MultiRZ") {
+            // exp(-i angle/2 (-1)^parity) over all wires
+            std::vector<ComplexT> diag(dim);
+            for (std::size_t i = 0; i < dim; i++) {
+                const bool odd = std::bitset<64>(i).count() % 2;
+                diag[i] = phase(odd ? angle / 2 : -angle / 2);
+            }
+            return diag;
+        }
+        return {};
+    }
+
+    /**
+     * @brief Append `wire` as the new least-significant wire of the block,
+     * repeating each diagonal entry for both values of the new bit.
+     */
+    void expandBlock(std::size_t wire) {
+        if (wires_.empty()) {
+            wires_.push_back(wire);
+            diagonal_ = {{1, 0}, {1, 0}};
+            return;
+        }
+        std::vector<ComplexT> expanded(2 * diagonal_.size());
+        for (std::size_t i = 0; i < expanded.size(); i++) {
+            expanded[i] = diagonal_[i >> 1U];
+        }
+        diagonal_ = std::move(expanded);
+        wires_.push_back(wire);
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,377 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GateFusion.hpp
+ * Host-side fusion of consecutive gates into a single dense matrix.
+ */
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+#include "Util.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Accumulates a run of gates acting on at most `max_fused_wires` wires
+ * into a single dense row-major matrix, so that the run can be applied to the
+ * state-vector with a single full-vector pass.
+ *
+ * The wire ordering follows the PennyLane convention: the first wire returned
+ * by `getWires()` is the most significant bit of the fused matrix index.
+ *
+ * @tparam PrecisionT Floating point precision of the fused matrix.
+ */
+template <class PrecisionT> class GateFusion {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = decltype(Util::getCudaType(PrecisionT{}));
+
+    /// Largest block size accepted, beyond which host matmuls dominate.
+    static constexpr std::size_t max_supported_wires = 6;
+
+    explicit GateFusion(std::size_t max_fused_wires)
+        : max_fused_wires_{max_fused_wires} {
+        PL_ABORT_IF(max_fused_wires == 0 ||
+                        max_fused_wires > max_supported_wires,
+                    "Gate fusion supports blocks of 1 to 6 wires.");
+    }
+
+    /**
+     * @brief Return the host matrix of a named gate in row-major order, or an
+     * empty vector if the gate has no known host representation.
+     *
+     * @param opName Name of gate.
+     * @param num_wires Number of wires the gate acts upon.
+     * @param params Gate parameters.
+     * @param adjoint Return the adjoint of the gate matrix.
+     */
+    static auto getGateMatrix(const std::string &opName, std::size_t num_wires,
+                              const std::vector<PrecisionT> &params,
+                              bool adjoint) -> std::vector<ComplexT> {
+        std::vector<ComplexT> mat = getNamedMatrix(opName, num_wires, params);
+        if (adjoint && !mat.empty()) {
+            const std::size_t dim = Pennylane::Util::exp2(num_wires);
+            for (std::size_t r = 0; r < dim; r++) {
+                mat[r * dim + r] = std::conj(mat[r * dim + r]);
+                for (std::size_t c = r + 1; c < dim; c++) {
+                    const ComplexT tmp = std::conj(mat[r * dim + c]);
+                    mat[r * dim + c] = std::conj(mat[c * dim + r]);
+                    mat[c * dim + r] = tmp;
+                }
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Attempt to merge the given gate into the current block. The gate
+     * is left-multiplied onto the block, i.e. it is applied after all gates
+     * fused so far.
+     *
+     * @param matrix Row-major gate matrix over `wires`.
+     * @param wires Wires the gate acts upon.
+     * @return true The gate was merged.
+     * @return false Merging would exceed `max_fused_wires`; block unchanged.
+     */
+    bool tryFuse(const std::vector<ComplexT> &matrix,
+                 const std::vector<std::size_t> &wires) {
+        std::size_t new_wires = 0;
+        for (const auto w : wires) {
+            if (std::find(wires_.begin(), wires_.end(), w) == wires_.end()) {
+                new_wires++;
+            }
+        }
+        if (wires_.size() + new_wires > max_fused_wires_) {
+            return false;
+        }
+        PL_ABORT_IF(matrix.size() !=
+                        Pennylane::Util::exp2(2 * wires.size()),
+                    "Gate matrix size does not match the number of wires.");
+
+        for (const auto w : wires) {
+            if (std::find(wires_.begin(), wires_.end(), w) == wires_.end()) {
+                expandBlock(w);
+            }
+        }
+        applyToBlock(matrix, wires);
+        num_gates_++;
+        return true;
+    }
+
+    /**
+     * @brief Reset the block to an empty run.
+     */
+    void clear() {
+        wires_.clear();
+        matrix_.clear();
+        num_gates_ = 0;
+    }
+
+    [[nodiscard]] bool empty() const { return num_gates_ == 0; }
+    [[nodiscard]] std::size_t getNumGates() const { return num_gates_; }
+    [[nodiscard]] std::size_t getMaxFusedWires() const {
+        return max_fused_wires_;
+    }
+    [[nodiscard]] auto getWires() const -> const std::vector<std::size_t> & {
+        return wires_;
+    }
+    [[nodiscard]] auto getMatrix() const -> const std::vector<ComplexT> & {
+        return matrix_;
+    }
+
+  private:
+    std::size_t max_fused_wires_;
+    std::size_t num_gates_{0};
+    std::vector<std::size_t> wires_;
+    std::vector<ComplexT> matrix_;
+
+    static auto getNamedMatrix(const std::string &opName,
+                               std::size_t num_wires,
+                               const std::vector<PrecisionT> &params)
+        -> std::vector<ComplexT> {
+        const std::size_t dim = Pennylane::Util::exp2(num_wires);
+        if (opName == "Identity" || opName == "I") {
+            std::vector<ComplexT> mat(dim * dim, {0, 0});
+            for (std::size_t i = 0; i < dim; i++) {
+                mat[i * dim + i] = {1, 0};
+            }
+            return mat;
+        }
+        if (opName == "MultiRZ" && !params.empty()) {
+            // diagonal exp(-i theta/2 (-1)^parity) over all wires
+            std::vector<ComplexT> mat(dim * dim, {0, 0});
+            const PrecisionT half = params.front() / 2;
+            for (std::size_t i = 0; i < dim; i++) {
+                const bool odd = std::bitset<64>(i).count() % 2;
+                mat[i * dim + i] = {std::cos(half), odd ? std::sin(half)
+                                                        : -std::sin(half)};
+            }
+            return mat;
+        }
+        std::vector<CFP_t> mat_cu;
+        const auto fixed_it = fixed_gates_.find(opName);
+        const auto par_it = par_gates_.find(opName);
+        if (fixed_it != fixed_gates_.end()) {
+            mat_cu = fixed_it->second();
+        } else if (par_it != par_gates_.end() &&
+                   params.size() >= par_it->second.first) {
+            mat_cu = par_it->second.second(params);
+        }
+        std::vector<ComplexT> mat(mat_cu.size());
+        std::transform(mat_cu.begin(), mat_cu.end(), mat.begin(),
+                       [](const CFP_t &x) { return Util::cuToComplex(x); });
+        if (!mat.empty() &&
+            reversed_gates_.find(opName) != reversed_gates_.end()) {
+            return reverseWireOrder(mat, num_wires);
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Reverse the wire ordering of a row-major gate matrix, such that
+     * the first wire becomes the least significant bit of the matrix index.
+     */
+    static auto reverseWireOrder(const std::vector<ComplexT> &mat,
+                                 std::size_t num_wires)
+        -> std::vector<ComplexT> {
+        const std::size_t dim = Pennylane::Util::exp2(num_wires);
+        const auto reverse_bits = [num_wires](std::size_t idx) {
+            std::size_t rev = 0;
+            for (std::size_t b = 0; b < num_wires; b++) {
+                rev = (rev << 1U) | ((idx >> b) & 1U);
+            }
+            return rev;
+        };
+        std::vector<ComplexT> reversed(mat.size());
+        for (std::size_t r = 0; r < dim; r++) {
+            for (std::size_t c = 0; c < dim; c++) {
+                reversed[reverse_bits(r) * dim + reverse_bits(c)] =
+                    mat[r * dim + c];
+            }
+        }
+        return reversed;
+    }
+
+    using FixedFunc = std::function<std::vector<CFP_t>()>;
+    using ParFunc =
+        std::function<std::vector<CFP_t>(const std::vector<PrecisionT> &)>;
+
+    inline static const std::unordered_map<std::string, FixedFunc>
+        fixed_gates_{{"PauliX", cuGates::getPauliX<CFP_t>},
+                     {"PauliY", cuGates::getPauliY<CFP_t>},
+                     {"PauliZ", cuGates::getPauliZ<CFP_t>},
+                     {"Hadamard", cuGates::getHadamard<CFP_t>},
+                     {"S", cuGates::getS<CFP_t>},
+                     {"T", cuGates::getT<CFP_t>},
+                     {"CNOT", cuGates::getCNOT<CFP_t>},
+                     {"SWAP", cuGates::getSWAP<CFP_t>},
+                     {"CY", cuGates::getCY<CFP_t>},
+                     {"CZ", cuGates::getCZ<CFP_t>},
+                     {"CSWAP", cuGates::getCSWAP<CFP_t>},
+                     {"Toffoli", cuGates::getToffoli<CFP_t>}};
+
+    /// Gates whose cuGates matrices are stored with the first wire as the
+    /// least significant bit, matching how the state-vector applies them.
+    inline static const std::unordered_set<std::string> reversed_gates_{
+        "SingleExcitation",      "SingleExcitationMinus",
+        "SingleExcitationPlus",  "DoubleExcitation",
+        "DoubleExcitationMinus", "DoubleExcitationPlus"};
+
+    /// Parametric gates, keyed by name, with their minimum parameter count.
+    inline static const std::unordered_map<std::string,
+                                           std::pair<std::size_t, ParFunc>>
+        par_gates_{
+            {"RX", {1, [](const auto &p) { return cuGates::getRX<CFP_t>(p); }}},
+            {"RY", {1, [](const auto &p) { return cuGates::getRY<CFP_t>(p); }}},
+            {"RZ", {1, [](const auto &p) { return cuGates::getRZ<CFP_t>(p); }}},
+            {"PhaseShift",
+             {1,
+              [](const auto &p) { return cuGates::getPhaseShift<CFP_t>(p); }}},
+            {"CRX",
+             {1, [](const auto &p) { return cuGates::getCRX<CFP_t>(p); }}},
+            {"CRY",
+             {1, [](const auto &p) { return cuGates::getCRY<CFP_t>(p); }}},
+            {"CRZ",
+             {1, [](const auto &p) { return cuGates::getCRZ<CFP_t>(p); }}},
+            {"ControlledPhaseShift",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getControlledPhaseShift<CFP_t>(p);
+              }}},
+            {"IsingXX",
+             {1, [](const auto &p) { return cuGates::getIsingXX<CFP_t>(p); }}},
+            {"IsingYY",
+             {1, [](const auto &p) { return cuGates::getIsingYY<CFP_t>(p); }}},
+            {"IsingZZ",
+             {1, [](const auto &p) { return cuGates::getIsingZZ<CFP_t>(p); }}},
+            {"SingleExcitation",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getSingleExcitation<CFP_t>(p);
+              }}},
+            {"SingleExcitationMinus",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getSingleExcitationMinus<CFP_t>(p);
+              }}},
+            {"SingleExcitationPlus",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getSingleExcitationPlus<CFP_t>(p);
+              }}},
+            {"DoubleExcitation",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getDoubleExcitation<CFP_t>(p);
+              }}},
+            {"DoubleExcitationMinus",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getDoubleExcitationMinus<CFP_t>(p);
+              }}},
+            {"DoubleExcitationPlus",
+             {1,
+              [](const auto &p) {
+                  return cuGates::getDoubleExcitationPlus<CFP_t>(p);
+              }}},
+            {"Rot",
+             {3, [](const auto &p) { return cuGates::getRot<CFP_t>(p); }}},
+            {"CRot",
+             {3, [](const auto &p) { return cuGates::getCRot<CFP_t>(p); }}}};
+
+    /**
+     * @brief Append `wire` as the new least-significant wire of the block,
+     * tensoring the current block matrix with the identity.
+     */
+    void expandBlock(std::size_t wire) {
+        if (wires_.empty()) {
+            wires_.push_back(wire);
+            matrix_ = {{1, 0}, {0, 0}, {0, 0}, {1, 0}};
+            return;
+        }
+        const std::size_t dim = Pennylane::Util::exp2(wires_.size());
+        std::vector<ComplexT> expanded(4 * dim * dim, {0, 0});
+        for (std::size_t r = 0; r < dim; r++) {
+            for (std::size_t c = 0; c < dim; c++) {
+                for (std::size_t b = 0; b < 2; b++) {
+                    expanded[((r << 1U) | b) * 2 * dim + ((c << 1U) | b)] =
+                        matrix_[r * dim + c];
+                }
+            }
+        }
+        matrix_ = std::move(expanded);
+        wires_.push_back(wire);
+    }
+
+    /**
+     * @brief Left-multiply the block by `matrix` acting on `wires`, which are
+     * all already part of the block.
+     */
+    void applyToBlock(const std::vector<ComplexT> &matrix,
+                      const std::vector<std::size_t> &wires) {
+        const std::size_t num_block = wires_.size();
+        const std::size_t dim = Pennylane::Util::exp2(num_block);
+        const std::size_t sub_dim = Pennylane::Util::exp2(wires.size());
+
+        // offsets[s] maps a gate-local index onto the block index space
+        std::vector<std::size_t> offsets(sub_dim, 0);
+        std::size_t gate_mask = 0;
+        for (std::size_t j = 0; j < wires.size(); j++) {
+            const auto pos = static_cast<std::size_t>(
+                std::find(wires_.begin(), wires_.end(), wires[j]) -
+                wires_.begin());
+            const std::size_t bit = std::size_t{1} << (num_block - 1 - pos);
+            gate_mask |= bit;
+            for (std::size_t s = 0; s < sub_dim; s++) {
+                if ((s >> (wires.size() - 1 - j)) & 1U) {
+                    offsets[s] |= bit;
+                }
+            }
+        }
+
+        std::vector<ComplexT> gathered(sub_dim);
+        for (std::size_t col = 0; col < dim; col++) {
+            for (std::size_t base = 0; base < dim; base++) {
+                if (base & gate_mask) {
+                    continue;
+                }
+                for (std::size_t s = 0; s < sub_dim; s++) {
+                    gathered[s] = matrix_[(base | offsets[s]) * dim + col];
+                }
+                for (std::size_t r = 0; r < sub_dim; r++) {
+                    ComplexT acc{0, 0};
+                    for (std::size_t s = 0; s < sub_dim; s++) {
+                        acc += matrix[r * sub_dim + s] * gathered[s];
+                    }
+                    matrix_[(base | offsets[r]) * dim + col] = acc;
+                }
+            }
+        }
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,616 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GateTape.hpp
+ * Pre-decoded gate sequence with integer opcodes, for dispatch without string
+ * lookups.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Error.hpp"
+#include "Util.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Integer opcodes of the gates understood by `GateTape`.
+ */
+enum class GateOp : std::uint8_t {
+    Identity,
+    PauliX,
+    PauliY,
+    PauliZ,
+    Hadamard,
+    S,
+    T,
+    RX,
+    RY,
+    RZ,
+    Rot,
+    PhaseShift,
+    CNOT,
+    CY,
+    CZ,
+    SWAP,
+    IsingXX,
+    IsingYY,
+    IsingZZ,
+    CRX,
+    CRY,
+    CRZ,
+    CRot,
+    ControlledPhaseShift,
+    SingleExcitation,
+    SingleExcitationMinus,
+    SingleExcitationPlus,
+    Toffoli,
+    CSWAP,
+    DoubleExcitation,
+    DoubleExcitationMinus,
+    DoubleExcitationPlus,
+    MultiRZ,
+    /// Gate given by an explicit host matrix.
+    Matrix,
+};
+
+/**
+ * @brief Opcodes of the gate names understood by `GateTape`.
+ */
+inline auto getGateOps() -> const std::unordered_map<std::string, GateOp> & {
+    static const std::unordered_map<std::string, GateOp> gate_ops{
+        {"Identity", GateOp::Identity},
+        {"I", GateOp::Identity},
+        {"PauliX", GateOp::PauliX},
+        {"PauliY", GateOp::PauliY},
+        {"PauliZ", GateOp::PauliZ},
+        {"Hadamard", GateOp::Hadamard},
+        {"S", GateOp::S},
+        {"T", GateOp::T},
+        {"RX", GateOp::RX},
+        {"RY", GateOp::RY},
+        {"RZ", GateOp::RZ},
+        {"Rot", GateOp::Rot},
+        {"PhaseShift", GateOp::PhaseShift},
+        {"CNOT", GateOp::CNOT},
+        {"CY", GateOp::CY},
+        {"CZ", GateOp::CZ},
+        {"SWAP", GateOp::SWAP},
+        {"IsingXX", GateOp::IsingXX},
+        {"IsingYY", GateOp::IsingYY},
+        {"IsingZZ", GateOp::IsingZZ},
+        {"CRX", GateOp::CRX},
+        {"CRY", GateOp::CRY},
+        {"CRZ", GateOp::CRZ},
+        {"CRot", GateOp::CRot},
+        {"ControlledPhaseShift", GateOp::ControlledPhaseShift},
+        {"SingleExcitation", GateOp::SingleExcitation},
+        {"SingleExcitationMinus", GateOp::SingleExcitationMinus},
+        {"SingleExcitationPlus", GateOp::SingleExcitationPlus},
+        {"Toffoli", GateOp::Toffoli},
+        {"CSWAP", GateOp::CSWAP},
+        {"DoubleExcitation", GateOp::DoubleExcitation},
+        {"DoubleExcitationMinus", GateOp::DoubleExcitationMinus},
+        {"DoubleExcitationPlus", GateOp::DoubleExcitationPlus},
+        {"MultiRZ", GateOp::MultiRZ}};
+    return gate_ops;
+}
+
+/**
+ * @brief Map a gate name onto its opcode, returning `GateOp::Matrix` for names
+ * without a dedicated opcode.
+ *
+ * @param opName Name of gate.
+ */
+inline auto lookupGateOp(const std::string &opName) -> GateOp {
+    const auto &gate_ops = getGateOps();
+    const auto it = gate_ops.find(opName);
+    return (it != gate_ops.end()) ? it->second : GateOp::Matrix;
+}
+
+/**
+ * @brief Map an opcode back onto its gate name. `GateOp::Matrix` maps onto
+ * "Matrix".
+ *
+ * @param op Gate opcode.
+ */
+inline auto getGateOpName(GateOp op) -> const std::string & {
+    static const std::vector<std::string> names = [] {
+        std::vector<std::string> result(
+            static_cast<std::size_t>(GateOp::Matrix) + 1, "Matrix");
+        for (const auto &[name, opcode] : getGateOps()) {
+            if (name != "I") {
+                result[static_cast<std::size_t>(opcode)] = name;
+            }
+        }
+        return result;
+    }();
+    return names[static_cast<std::size_t>(op)];
+}
+
+/**
+ * @brief Number of wires expected by a gate opcode, or 0 if the gate accepts
+ * any number of wires.
+ */
+constexpr auto getGateOpNumWires(GateOp op) -> std::size_t {
+    switch (op) {
+    case GateOp::CNOT:
+    case GateOp::CY:
+    case GateOp::CZ:
+    case GateOp::SWAP:
+    case GateOp::IsingXX:
+    case GateOp::IsingYY:
+    case GateOp::IsingZZ:
+    case GateOp::CRX:
+    case GateOp::CRY:
+    case GateOp::CRZ:
+    case GateOp::CRot:
+    case GateOp::ControlledPhaseShift:
+    case GateOp::SingleExcitation:
+    case GateOp::SingleExcitationMinus:
+    case GateOp::SingleExcitationPlus:
+        return 2;
+    case GateOp::Toffoli:
+    case GateOp::CSWAP:
+        return 3;
+    case GateOp::DoubleExcitation:
+    case GateOp::DoubleExcitationMinus:
+    case GateOp::DoubleExcitationPlus:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Check whether a gate opcode acts on its last wire only, with all
+ * preceding wires used as control wires.
+ */
+constexpr auto isSingleTargetGateOp(GateOp op) -> bool {
+    switch (op) {
+    case GateOp::PauliX:
+    case GateOp::PauliY:
+    case GateOp::PauliZ:
+    case GateOp::Hadamard:
+    case GateOp::S:
+    case GateOp::T:
+    case GateOp::RX:
+    case GateOp::RY:
+    case GateOp::RZ:
+    case GateOp::Rot:
+    case GateOp::PhaseShift:
+    case GateOp::CNOT:
+    case GateOp::CY:
+    case GateOp::CZ:
+    case GateOp::CRX:
+    case GateOp::CRY:
+    case GateOp::CRZ:
+    case GateOp::CRot:
+    case GateOp::ControlledPhaseShift:
+    case GateOp::Toffoli:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Number of parameters read by a gate opcode.
+ */
+constexpr auto getGateOpNumParams(GateOp op) -> std::size_t {
+    switch (op) {
+    case GateOp::RX:
+    case GateOp::RY:
+    case GateOp::RZ:
+    case GateOp::PhaseShift:
+    case GateOp::IsingXX:
+    case GateOp::IsingYY:
+    case GateOp::IsingZZ:
+    case GateOp::CRX:
+    case GateOp::CRY:
+    case GateOp::CRZ:
+    case GateOp::ControlledPhaseShift:
+    case GateOp::SingleExcitation:
+    case GateOp::SingleExcitationMinus:
+    case GateOp::SingleExcitationPlus:
+    case GateOp::DoubleExcitation:
+    case GateOp::DoubleExcitationMinus:
+    case GateOp::DoubleExcitationPlus:
+    case GateOp::MultiRZ:
+        return 1;
+    case GateOp::Rot:
+    case GateOp::CRot:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief A gate sequence decoded once into opcodes, flat wire arrays and
+ * parameter slots, so that it can be applied repeatedly to a state-vector
+ * without string hashing or per-gate heap allocations.
+ *
+ * Wires are stored as cuStateVec index bits (`num_qubits - 1 - wire`), with the
+ * control wires of each gate first, followed by its targets in the order
+ * expected by the dispatching kernel. Parameters of all gates are stored in a
+ * single flat array and can be rebound with `setParameters` without
+ * re-decoding the tape.
+ *
+ * @tparam PrecisionT Floating point precision of the parameters.
+ */
+template <class PrecisionT> class GateTape {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = decltype(Util::getCudaType(PrecisionT{}));
+
+    /**
+     * @brief A single decoded gate.
+     */
+    struct Op {
+        GateOp opcode;
+        bool adjoint;
+        std::uint32_t num_ctrls;
+        std::uint32_t num_tgts;
+        std::size_t wire_offset;
+        std::size_t param_offset;
+        std::size_t matrix_offset;
+    };
+
+    /**
+     * @brief Decode a gate sequence.
+     *
+     * @param num_qubits Number of qubits of the target state-vector.
+     * @param opNames Names of gates.
+     * @param wires Wires of each gate.
+     * @param adjoints Indicates whether to use the adjoint of each gate.
+     * @param params Parameters of each gate.
+     * @param matrices Optional host matrices in row-major order, used for
+     * gates without a dedicated opcode. May be empty.
+     */
+    GateTape(std::size_t num_qubits, const std::vector<std::string> &opNames,
+             const std::vector<std::vector<std::size_t>> &wires,
+             const std::vector<bool> &adjoints,
+             const std::vector<std::vector<PrecisionT>> &params,
+             const std::vector<std::vector<ComplexT>> &matrices = {})
+        : num_qubits_{num_qubits} {
+        PL_ABORT_IF(opNames.size() != wires.size(),
+                    "Incompatible number of ops and wires");
+        PL_ABORT_IF(opNames.size() != adjoints.size(),
+                    "Incompatible number of ops and adjoints");
+        PL_ABORT_IF(opNames.size() != params.size(),
+                    "Incompatible number of ops and params");
+        PL_ABORT_IF(!matrices.empty() && matrices.size() != opNames.size(),
+                    "Incompatible number of ops and matrices");
+        ops_.reserve(opNames.size());
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            static const std::vector<ComplexT> no_matrix{};
+            addOp(opNames[op_idx], wires[op_idx], adjoints[op_idx],
+                  params[op_idx],
+                  matrices.empty() ? no_matrix : matrices[op_idx]);
+        }
+    }
+
+    /**
+     * @brief Create an empty tape, to which gates are appended with
+     * `addOperation`.
+     *
+     * @param num_qubits Number of qubits of the target state-vector.
+     */
+    explicit GateTape(std::size_t num_qubits) : num_qubits_{num_qubits} {}
+
+    /**
+     * @brief Append a gate given by its opcode.
+     *
+     * @param opcode Gate opcode.
+     * @param wires Wires of the gate.
+     * @param num_wires Number of wires.
+     * @param adjoint Indicates whether to use the adjoint of the gate.
+     * @param params `getGateOpNumParams(opcode)` gate parameters.
+     * @param matrix Row-major matrix of `4^num_wires` entries for
+     * `GateOp::Matrix`, ignored otherwise.
+     */
+    void addOperation(GateOp opcode, const std::size_t *wires,
+                      std::size_t num_wires, bool adjoint,
+                      const PrecisionT *params, const ComplexT *matrix) {
+        PL_ABORT_IF(num_wires == 0 && opcode != GateOp::Identity,
+                    "Gates must act on at least one wire");
+        for (std::size_t i = 0; i < num_wires; i++) {
+            PL_ABORT_IF(wires[i] >= num_qubits_,
+                        "Gate wire index out of range");
+        }
+        const std::size_t op_num_wires = getGateOpNumWires(opcode);
+        PL_ABORT_IF(op_num_wires != 0 && num_wires != op_num_wires,
+                    "Invalid number of wires for gate");
+
+        std::size_t num_ctrls = 0;
+        if (isSingleTargetGateOp(opcode)) {
+            num_ctrls = num_wires - 1;
+        } else if (opcode == GateOp::CSWAP) {
+            num_ctrls = 1;
+        }
+        const std::size_t num_params = getGateOpNumParams(opcode);
+        const Op op{opcode,
+                    adjoint,
+                    static_cast<std::uint32_t>(num_ctrls),
+                    static_cast<std::uint32_t>(num_wires - num_ctrls),
+                    wires_.size(),
+                    params_.size(),
+                    matrices_.size()};
+
+        const auto to_index = [this](std::size_t w) {
+            return static_cast<std::int32_t>(num_qubits_ - 1 - w);
+        };
+        std::transform(wires, wires + num_ctrls, std::back_inserter(wires_),
+                       to_index);
+        if (opcode == GateOp::Matrix) {
+            // matrices follow the PennyLane ordering: first wire is the MSB
+            std::transform(std::reverse_iterator(wires + num_wires),
+                           std::reverse_iterator(wires + num_ctrls),
+                           std::back_inserter(wires_), to_index);
+        } else {
+            std::transform(wires + num_ctrls, wires + num_wires,
+                           std::back_inserter(wires_), to_index);
+        }
+
+        params_.insert(params_.end(), params, params + num_params);
+
+        if (opcode == GateOp::Matrix) {
+            std::transform(matrix,
+                           matrix + Pennylane::Util::exp2(2 * num_wires),
+                           std::back_inserter(matrices_),
+                           [](const ComplexT &x) {
+                               return Util::complexToCu<ComplexT>(x);
+                           });
+        } else if (hasParametricMatrix(opcode)) {
+            const auto mat = getParametricMatrix(opcode, params[0]);
+            matrices_.insert(matrices_.end(), mat.begin(), mat.end());
+        }
+        ops_.push_back(op);
+    }
+
+    /**
+     * @brief Get the wires of a gate, in the order they were given.
+     *
+     * @param op_idx Index of the gate.
+     */
+    [[nodiscard]] auto getOpWires(std::size_t op_idx) const
+        -> std::vector<std::size_t> {
+        const auto &op = ops_[op_idx];
+        const auto first = wires_.begin() + op.wire_offset;
+        std::vector<std::size_t> wires;
+        wires.reserve(op.num_ctrls + op.num_tgts);
+        const auto to_wire = [this](std::int32_t index) {
+            return num_qubits_ - 1 - static_cast<std::size_t>(index);
+        };
+        std::transform(first, first + op.num_ctrls, std::back_inserter(wires),
+                       to_wire);
+        if (op.opcode == GateOp::Matrix) {
+            std::transform(std::reverse_iterator(first + op.num_ctrls +
+                                                 op.num_tgts),
+                           std::reverse_iterator(first + op.num_ctrls),
+                           std::back_inserter(wires), to_wire);
+        } else {
+            std::transform(first + op.num_ctrls,
+                           first + op.num_ctrls + op.num_tgts,
+                           std::back_inserter(wires), to_wire);
+        }
+        return wires;
+    }
+
+    /**
+     * @brief Decode the operations held by an `OpsData` object. State
+     * preparation operations are recorded as identities, as they are handled
+     * separately by the callers of `OpsData`.
+     *
+     * @tparam OpsDataT `Pennylane::Algorithms::OpsData` type.
+     * @param num_qubits Number of qubits of the target state-vector.
+     * @param ops Operations to decode.
+     */
+    template <class OpsDataT>
+    static auto fromOpsData(std::size_t num_qubits, const OpsDataT &ops)
+        -> GateTape {
+        std::vector<std::string> names = ops.getOpsName();
+        for (auto &name : names) {
+            if (name == "QubitStateVector" || name == "BasisState") {
+                name = "Identity";
+            }
+        }
+        return GateTape(num_qubits, names, ops.getOpsWires(),
+                        ops.getOpsInverses(), ops.getOpsParams(),
+                        ops.getOpsMatrices());
+    }
+
+    /**
+     * @brief Rebind all gate parameters, in the order in which the gates
+     * consume them.
+     *
+     * @param params Flat parameter array of size `getNumParams()`.
+     */
+    void setParameters(const std::vector<PrecisionT> &params) {
+        PL_ABORT_IF(params.size() != params_.size(),
+                    "Incompatible number of tape parameters");
+        params_ = params;
+        for (const auto &op : ops_) {
+            if (hasParametricMatrix(op.opcode)) {
+                const auto mat =
+                    getParametricMatrix(op.opcode, params_[op.param_offset]);
+                std::copy(mat.begin(), mat.end(),
+                          matrices_.begin() + op.matrix_offset);
+            }
+        }
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    [[nodiscard]] auto getNumOps() const -> std::size_t { return ops_.size(); }
+    [[nodiscard]] auto getNumParams() const -> std::size_t {
+        return params_.size();
+    }
+    [[nodiscard]] auto getOps() const -> const std::vector<Op> & {
+        return ops_;
+    }
+    [[nodiscard]] auto getWires() const -> const std::vector<std::int32_t> & {
+        return wires_;
+    }
+    [[nodiscard]] auto getParameters() const
+        -> const std::vector<PrecisionT> & {
+        return params_;
+    }
+    [[nodiscard]] auto getMatrices() const -> const std::vector<CFP_t> & {
+        return matrices_;
+    }
+
+    /**
+     * @brief Indicate whether a gate stores a matrix rewritten by
+     * `setParameters`.
+     */
+    static constexpr bool hasParametricMatrix(GateOp op) {
+        switch (op) {
+        case GateOp::SingleExcitation:
+        case GateOp::SingleExcitationMinus:
+        case GateOp::SingleExcitationPlus:
+        case GateOp::DoubleExcitation:
+        case GateOp::DoubleExcitationMinus:
+        case GateOp::DoubleExcitationPlus:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+  private:
+    std::size_t num_qubits_;
+    std::vector<Op> ops_;
+    std::vector<std::int32_t> wires_;
+    std::vector<PrecisionT> params_;
+    std::vector<CFP_t> matrices_;
+
+    static auto getParametricMatrix(GateOp op, PrecisionT param)
+        -> std::vector<CFP_t> {
+        switch (op) {
+        case GateOp::SingleExcitation:
+            return cuGates::getSingleExcitation<CFP_t>(param);
+        case GateOp::SingleExcitationMinus:
+            return cuGates::getSingleExcitationMinus<CFP_t>(param);
+        case GateOp::SingleExcitationPlus:
+            return cuGates::getSingleExcitationPlus<CFP_t>(param);
+        case GateOp::DoubleExcitation:
+            return cuGates::getDoubleExcitation<CFP_t>(param);
+        case GateOp::DoubleExcitationMinus:
+            return cuGates::getDoubleExcitationMinus<CFP_t>(param);
+        case GateOp::DoubleExcitationPlus:
+            return cuGates::getDoubleExcitationPlus<CFP_t>(param);
+        default:
+            return {};
+        }
+    }
+
+    void addOp(const std::string &opName, const std::vector<std::size_t> &wires,
+               bool adjoint, const std::vector<PrecisionT> &params,
+               const std::vector<ComplexT> &matrix) {
+        const GateOp opcode = lookupGateOp(opName);
+        PL_ABORT_IF(params.size() < getGateOpNumParams(opcode),
+                    "Insufficient number of gate parameters");
+        if (opcode == GateOp::Matrix) {
+            if (matrix.empty()) {
+                throw LightningException("Currently unsupported gate: " +
+                                         opName);
+            }
+            PL_ABORT_IF(matrix.size() !=
+                            Pennylane::Util::exp2(2 * wires.size()),
+                        "Gate matrix size does not match the number of wires.");
+        }
+        addOperation(opcode, wires.data(), wires.size(), adjoint,
+                     params.data(), matrix.data());
+    }
+};
+
+/**
+ * @brief Unpack a circuit given as flat arrays, as passed in a single call
+ * from Python, into a gate tape, decoding the gates by opcode.
+ *
+ * The wires of gate `i` are `wires[wire_offsets[i]:wire_offsets[i + 1]]`.
+ * Named gates consume `getGateOpNumParams` entries of `params` in order, and
+ * `GateOp::Matrix` gates consume a row-major matrix of `4^num_wires` entries
+ * of `matrices`. The whole circuit is validated before returning.
+ *
+ * @param num_qubits Number of qubits of the target state-vector.
+ * @param opcodes `GateOp` value of each gate.
+ * @param num_ops Number of gates.
+ * @param wire_offsets Offsets of the wires of each gate, of size
+ * `num_ops + 1`.
+ * @param wires Flat wires of all gates.
+ * @param adjoints Indicates whether to use the adjoint of each gate.
+ * @param params Flat parameters of all gates.
+ * @param num_params Size of `params`.
+ * @param matrices Flat matrices of all explicit-matrix gates.
+ * @param num_matrix_elements Size of `matrices`.
+ */
+template <class PrecisionT>
+auto unpackOperations(std::size_t num_qubits, const std::uint8_t *opcodes,
+                      std::size_t num_ops, const std::size_t *wire_offsets,
+                      const std::size_t *wires, const bool *adjoints,
+                      const PrecisionT *params, std::size_t num_params,
+                      const std::complex<PrecisionT> *matrices,
+                      std::size_t num_matrix_elements)
+    -> GateTape<PrecisionT> {
+    GateTape<PrecisionT> tape(num_qubits);
+    std::size_t param_offset = 0;
+    std::size_t matrix_offset = 0;
+    PL_ABORT_IF(wire_offsets[0] != 0, "Wire offsets must start at 0");
+
+    for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+        PL_ABORT_IF(opcodes[op_idx] > static_cast<std::uint8_t>(GateOp::Matrix),
+                    "Invalid gate opcode");
+        const auto opcode = static_cast<GateOp>(opcodes[op_idx]);
+        PL_ABORT_IF(wire_offsets[op_idx + 1] < wire_offsets[op_idx],
+                    "Wire offsets must be non-decreasing");
+        const std::size_t num_wires =
+            wire_offsets[op_idx + 1] - wire_offsets[op_idx];
+
+        const std::size_t op_num_params = getGateOpNumParams(opcode);
+        PL_ABORT_IF(param_offset + op_num_params > num_params,
+                    "Insufficient number of gate parameters");
+        std::size_t op_num_matrix_elements = 0;
+        if (opcode == GateOp::Matrix) {
+            op_num_matrix_elements = Pennylane::Util::exp2(2 * num_wires);
+            PL_ABORT_IF(matrix_offset + op_num_matrix_elements >
+                            num_matrix_elements,
+                        "Insufficient number of gate matrix entries");
+        }
+        tape.addOperation(opcode, wires + wire_offsets[op_idx], num_wires,
+                          adjoints[op_idx], params + param_offset,
+                          matrices + matrix_offset);
+        param_offset += op_num_params;
+        matrix_offset += op_num_matrix_elements;
+    }
+    PL_ABORT_IF(param_offset != num_params,
+                "Incompatible number of gate parameters");
+    PL_ABORT_IF(matrix_offset != num_matrix_elements,
+                "Incompatible number of gate matrix entries");
+    return tape;
+}
+
+} // namespace Pennylane::CUDA
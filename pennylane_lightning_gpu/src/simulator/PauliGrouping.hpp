@@ -0,0 +1,247 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file PauliGrouping.hpp
+ * Partition of Pauli words into qubit-wise-commuting groups, and action of
+ * Pauli words on basis states.
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Pauli words measurable in a common single-qubit basis.
+ */
+struct PauliWordGroup {
+    /// Indices of the words of the group
+    std::vector<std::size_t> terms;
+    /// Wires acted on by at least one word of the group, in ascending order
+    std::vector<std::size_t> wires;
+    /// Pauli basis ('X', 'Y' or 'Z') of each wire of the group
+    std::vector<char> bases;
+    /// For each word, bit i is set if the word acts on `wires[i]`
+    std::vector<std::size_t> masks;
+};
+
+/**
+ * @brief Partition Pauli words into groups of qubit-wise-commuting words,
+ * which act with the same Pauli operator on every wire they share.
+ *
+ * Rotating each wire of a group into the Z basis diagonalizes all its words
+ * at once, so that the expectation value of each word is the parity of the
+ * marginal distribution over the wires of the group. Words are placed
+ * greedily into the first compatible group, heaviest first. Groups are
+ * closed once they span `max_group_wires` wires, so that their marginal
+ * stays small; a word acting on more wires forms a group of its own.
+ * Identity factors are ignored, and words acting trivially on every wire
+ * form a group without wires.
+ *
+ * @param pauli_words Pauli words, as strings of 'I', 'X', 'Y' and 'Z'.
+ * @param tgts Wires of each Pauli word.
+ * @param max_group_wires Maximum number of wires spanned by a group of
+ * several words.
+ * @return Groups covering every word exactly once.
+ */
+inline auto
+groupQubitWiseCommuting(const std::vector<std::string> &pauli_words,
+                        const std::vector<std::vector<std::size_t>> &tgts,
+                        std::size_t max_group_wires)
+    -> std::vector<PauliWordGroup> {
+    PL_ABORT_IF_NOT(pauli_words.size() == tgts.size(),
+                    "Incompatible number of Pauli words and wires");
+
+    // Non-identity factors of each word
+    std::vector<std::unordered_map<std::size_t, char>> factors(
+        pauli_words.size());
+    for (std::size_t term = 0; term < pauli_words.size(); term++) {
+        const auto &word = pauli_words[term];
+        PL_ABORT_IF_NOT(word.size() == tgts[term].size(),
+                        "Pauli word and wires have different lengths");
+        for (std::size_t i = 0; i < word.size(); i++) {
+            const char pauli = word[i];
+            if (pauli != 'I' && pauli != 'X' && pauli != 'Y' && pauli != 'Z') {
+                std::string message = "Invalid Pauli operator " +
+                                      std::string(1, pauli) + " in word " +
+                                      word;
+                throw Pennylane::Util::LightningException(message);
+            }
+            PL_ABORT_IF_NOT(std::count(tgts[term].begin(), tgts[term].end(),
+                                       tgts[term][i]) == 1,
+                            "Pauli word acts more than once on a wire");
+            if (pauli != 'I') {
+                factors[term][tgts[term][i]] = pauli;
+            }
+        }
+    }
+
+    std::vector<std::size_t> order(pauli_words.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) {
+                         return factors[a].size() > factors[b].size();
+                     });
+
+    std::vector<std::unordered_map<std::size_t, char>> group_bases;
+    std::vector<std::vector<std::size_t>> group_terms;
+    std::vector<std::size_t> identity_terms;
+    for (const auto term : order) {
+        if (factors[term].empty()) {
+            identity_terms.push_back(term);
+            continue;
+        }
+        std::size_t group = 0;
+        for (; group < group_terms.size(); group++) {
+            auto &bases = group_bases[group];
+            std::size_t new_wires = 0;
+            bool compatible = true;
+            for (const auto &[wire, pauli] : factors[term]) {
+                const auto it = bases.find(wire);
+                if (it == bases.end()) {
+                    new_wires++;
+                } else if (it->second != pauli) {
+                    compatible = false;
+                    break;
+                }
+            }
+            if (compatible && bases.size() + new_wires <= max_group_wires) {
+                break;
+            }
+        }
+        if (group == group_terms.size()) {
+            group_bases.emplace_back();
+            group_terms.emplace_back();
+        }
+        group_bases[group].insert(factors[term].begin(), factors[term].end());
+        group_terms[group].push_back(term);
+    }
+
+    std::vector<PauliWordGroup> groups(group_terms.size());
+    for (std::size_t group = 0; group < groups.size(); group++) {
+        auto &result = groups[group];
+        for (const auto &[wire, pauli] : group_bases[group]) {
+            result.wires.push_back(wire);
+        }
+        std::sort(result.wires.begin(), result.wires.end());
+        for (const auto wire : result.wires) {
+            result.bases.push_back(group_bases[group].at(wire));
+        }
+        result.terms = std::move(group_terms[group]);
+        for (const auto term : result.terms) {
+            std::size_t mask = 0;
+            for (std::size_t i = 0; i < result.wires.size(); i++) {
+                if (factors[term].count(result.wires[i]) != 0) {
+                    mask |= std::size_t{1} << i;
+                }
+            }
+            result.masks.push_back(mask);
+        }
+    }
+    if (!identity_terms.empty()) {
+        PauliWordGroup identity;
+        identity.masks.assign(identity_terms.size(), 0);
+        identity.terms = std::move(identity_terms);
+        groups.push_back(std::move(identity));
+    }
+    return groups;
+}
+
+/**
+ * @brief Expectation value of a product of Z operators over a marginal
+ * distribution.
+ *
+ * @param probabilities Probabilities of the basis states of the marginal.
+ * @param mask Bit i is set if the product acts on bit i of the basis states.
+ * @return Sum of the probabilities weighted by the parity of the masked bits.
+ */
+inline auto parityExpectation(const std::vector<double> &probabilities,
+                              std::size_t mask) -> double {
+    double result = 0;
+    for (std::size_t i = 0; i < probabilities.size(); i++) {
+        result += (std::popcount(i & mask) % 2 == 0) ? probabilities[i]
+                                                     : -probabilities[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Action of a Pauli word on the basis states of a state-vector.
+ *
+ * The word maps the basis state `|i>` to
+ * `i^num_y (-1)^popcount(i & z_mask) |i ^ x_mask>`.
+ */
+struct PauliWordMasks {
+    /// Bits flipped by the X and Y factors of the word
+    std::size_t x_mask;
+    /// Bits of the Y and Z factors of the word, whose parity gives the sign
+    std::size_t z_mask;
+    /// Number of Y factors of the word
+    std::size_t num_y;
+};
+
+/**
+ * @brief Get the bit masks of a Pauli word acting on a state-vector, where
+ * wire `w` is bit `num_qubits - 1 - w` of the basis states.
+ *
+ * @param pauli_word Pauli word, as a string of 'I', 'X', 'Y' and 'Z'.
+ * @param wires Wires of the word.
+ * @param num_qubits Number of qubits of the state-vector.
+ */
+inline auto getPauliWordMasks(const std::string &pauli_word,
+                              const std::vector<std::size_t> &wires,
+                              std::size_t num_qubits) -> PauliWordMasks {
+    PL_ABORT_IF_NOT(pauli_word.size() == wires.size(),
+                    "Pauli word and wires have different lengths");
+
+    PauliWordMasks masks{0, 0, 0};
+    for (std::size_t i = 0; i < pauli_word.size(); i++) {
+        PL_ABORT_IF_NOT(wires[i] < num_qubits,
+                        "Pauli word acts on a wire out of range");
+        const std::size_t bit = std::size_t{1} << (num_qubits - 1 - wires[i]);
+        PL_ABORT_IF((masks.x_mask | masks.z_mask) & bit,
+                    "Pauli word acts more than once on a wire");
+        switch (pauli_word[i]) {
+        case 'I':
+            break;
+        case 'X':
+            masks.x_mask |= bit;
+            break;
+        case 'Y':
+            masks.x_mask |= bit;
+            masks.z_mask |= bit;
+            masks.num_y++;
+            break;
+        case 'Z':
+            masks.z_mask |= bit;
+            break;
+        default:
+            std::string message = "Invalid Pauli operator " +
+                                  std::string(1, pauli_word[i]) + " in word " +
+                                  pauli_word;
+            throw Pennylane::Util::LightningException(message);
+        }
+    }
+    return masks;
+}
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,88 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file SampleCounts.hpp
+ * Reduction of packed samples into counts and per-qubit bits.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Count the occurrences of each packed sample.
+ *
+ * Samples drawn in ascending order, as requested from the cuStateVec sampler,
+ * are reduced by a single pass over runs of equal indices. Unsorted samples
+ * are sorted first.
+ *
+ * @tparam IndexT Integer type of the packed samples.
+ * @param samples Packed samples, one basis-state index per shot.
+ * @return Pair of the distinct basis-state indices, in ascending order, and
+ * the number of times each was drawn.
+ */
+template <class IndexT>
+auto countSamples(std::vector<IndexT> samples)
+    -> std::pair<std::vector<IndexT>, std::vector<std::size_t>> {
+    if (!std::is_sorted(samples.begin(), samples.end())) {
+        std::sort(samples.begin(), samples.end());
+    }
+    std::vector<IndexT> outcomes;
+    std::vector<std::size_t> counts;
+    for (std::size_t begin = 0; begin < samples.size();) {
+        std::size_t end = begin + 1;
+        while (end < samples.size() && samples[end] == samples[begin]) {
+            end++;
+        }
+        outcomes.push_back(samples[begin]);
+        counts.push_back(end - begin);
+        begin = end;
+    }
+    return {std::move(outcomes), std::move(counts)};
+}
+
+/**
+ * @brief Expand packed samples into one entry per qubit.
+ *
+ * Qubit 0 is stored first and corresponds to the most significant bit of the
+ * packed index. Runs of equal samples reuse the row expanded last.
+ *
+ * @tparam IndexT Integer type of the packed samples.
+ * @param samples Packed samples, one basis-state index per shot.
+ * @param num_qubits Number of qubits of each sample.
+ * @return Row-major array of shape (samples.size(), num_qubits).
+ */
+template <class IndexT>
+auto unpackSamples(const std::vector<IndexT> &samples, std::size_t num_qubits)
+    -> std::vector<std::size_t> {
+    std::vector<std::size_t> bits(samples.size() * num_qubits);
+    for (std::size_t i = 0; i < samples.size(); i++) {
+        auto row = bits.begin() + i * num_qubits;
+        if (i > 0 && samples[i] == samples[i - 1]) {
+            std::copy(row - num_qubits, row, row);
+            continue;
+        }
+        const auto idx = static_cast<std::size_t>(samples[i]);
+        for (std::size_t j = 0; j < num_qubits; j++) {
+            row[num_qubits - 1 - j] = (idx >> j) & 1U;
+        }
+    }
+    return bits;
+}
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,311 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file ShardLayout.hpp
+ * Placement of the index bits of a state-vector sharded across devices.
+ */
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Placement of the index bits of a state-vector sharded across
+ * devices.
+ *
+ * The 2^n amplitudes are split into 2^g equal shards, one per device. Of the
+ * n physical index bits, the lower n - g are local and address an amplitude
+ * within a shard, while the upper g are global and select the shard. A gate
+ * can only be applied shard by shard once the index bits of all its qubits
+ * sit in local positions, so `localize` plans the swaps of index bits between
+ * shards that bring them there, and records the new placement. Local bits
+ * used least recently are swapped out first.
+ *
+ * Index bits follow the cuStateVec convention, bit 0 being the least
+ * significant. The layout holds no amplitudes and runs on the host only.
+ */
+class ShardLayout {
+  public:
+    /// Swap of a local physical index bit with a global one.
+    using BitSwap = std::pair<std::size_t, std::size_t>;
+
+    /**
+     * @brief Create the identity placement of `num_qubits` index bits over
+     * `num_shards` shards.
+     *
+     * @param num_qubits Number of qubits of the state-vector.
+     * @param num_shards Number of shards, a power of 2.
+     */
+    ShardLayout(std::size_t num_qubits, std::size_t num_shards)
+        : num_qubits_{num_qubits},
+          num_global_{static_cast<std::size_t>(std::countr_zero(num_shards))},
+          physical_of_logical_(num_qubits), logical_of_physical_(num_qubits),
+          last_use_(num_qubits, 0) {
+        PL_ABORT_IF_NOT(std::has_single_bit(num_shards),
+                        "The number of shards must be a power of 2.");
+        PL_ABORT_IF_NOT(num_global_ < num_qubits_,
+                        "Each shard must hold at least one qubit.");
+        for (std::size_t bit = 0; bit < num_qubits_; bit++) {
+            physical_of_logical_[bit] = bit;
+            logical_of_physical_[bit] = bit;
+        }
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    [[nodiscard]] auto getNumShards() const -> std::size_t {
+        return std::size_t{1} << num_global_;
+    }
+    [[nodiscard]] auto getNumGlobalQubits() const -> std::size_t {
+        return num_global_;
+    }
+    [[nodiscard]] auto getNumLocalQubits() const -> std::size_t {
+        return num_qubits_ - num_global_;
+    }
+
+    /**
+     * @brief Get the physical position of a logical index bit.
+     */
+    [[nodiscard]] auto getPhysicalBit(std::size_t logical_bit) const
+        -> std::size_t {
+        return physical_of_logical_.at(logical_bit);
+    }
+
+    /**
+     * @brief Check whether a logical index bit currently addresses amplitudes
+     * within a shard.
+     */
+    [[nodiscard]] auto isLocal(std::size_t logical_bit) const -> bool {
+        return getPhysicalBit(logical_bit) < getNumLocalQubits();
+    }
+
+    /**
+     * @brief Get the number of index bit swaps planned so far.
+     */
+    [[nodiscard]] auto getNumSwaps() const -> std::size_t {
+        return num_swaps_;
+    }
+
+    /**
+     * @brief Plan the swaps making all given logical index bits local, and
+     * update the placement as if they were applied.
+     *
+     * @param logical_bits Index bits of the qubits of a gate.
+     * @return std::vector<BitSwap> Disjoint (local, global) pairs of physical
+     * bits to swap, empty if all bits are already local.
+     */
+    auto localize(const std::vector<std::size_t> &logical_bits)
+        -> std::vector<BitSwap> {
+        const std::size_t num_local = getNumLocalQubits();
+        PL_ABORT_IF(logical_bits.size() > num_local,
+                    "The gate acts on more qubits than a shard holds.");
+
+        // Mark the targets as used now, so none of them is swapped out
+        tick_++;
+        for (const auto bit : logical_bits) {
+            PL_ABORT_IF_NOT(bit < num_qubits_, "Invalid index bit.");
+            last_use_[bit] = tick_;
+        }
+
+        std::vector<BitSwap> swaps;
+        for (const auto bit : logical_bits) {
+            const std::size_t global = physical_of_logical_[bit];
+            if (global < num_local) {
+                continue;
+            }
+            std::size_t victim = num_local;
+            for (std::size_t local = 0; local < num_local; local++) {
+                const std::size_t use = last_use_[logical_of_physical_[local]];
+                if (use != tick_ &&
+                    (victim == num_local ||
+                     use < last_use_[logical_of_physical_[victim]])) {
+                    victim = local;
+                }
+            }
+            swaps.emplace_back(victim, global);
+            swapPhysical(victim, global);
+        }
+        num_swaps_ += swaps.size();
+        return swaps;
+    }
+
+    /**
+     * @brief Locate an amplitude of the logical state-vector.
+     *
+     * @param logical_index Index of the amplitude in the logical state-vector.
+     * @return std::pair<std::size_t, std::size_t> Shard holding the amplitude,
+     * and offset within the shard.
+     */
+    [[nodiscard]] auto locate(std::size_t logical_index) const
+        -> std::pair<std::size_t, std::size_t> {
+        std::size_t physical_index = 0;
+        for (std::size_t bit = 0; bit < num_qubits_; bit++) {
+            if ((logical_index >> bit) & 1U) {
+                physical_index |= std::size_t{1} << physical_of_logical_[bit];
+            }
+        }
+        const std::size_t num_local = getNumLocalQubits();
+        return {physical_index >> num_local,
+                physical_index & ((std::size_t{1} << num_local) - 1)};
+    }
+
+    /**
+     * @brief Get the physical positions of the local bits among the given
+     * logical bits, keeping their order.
+     */
+    [[nodiscard]] auto
+    getLocalPositions(const std::vector<std::size_t> &logical_bits) const
+        -> std::vector<std::size_t> {
+        std::vector<std::size_t> positions;
+        for (const auto bit : logical_bits) {
+            if (isLocal(bit)) {
+                positions.push_back(physical_of_logical_[bit]);
+            }
+        }
+        return positions;
+    }
+
+    /**
+     * @brief Get the wires of the shards, wire 0 being the most significant
+     * local qubit, addressed by the local bits among the given logical bits,
+     * keeping their order.
+     */
+    [[nodiscard]] auto
+    getLocalWires(const std::vector<std::size_t> &logical_bits) const
+        -> std::vector<std::size_t> {
+        const std::size_t num_local = getNumLocalQubits();
+        std::vector<std::size_t> wires;
+        for (const auto position : getLocalPositions(logical_bits)) {
+            wires.push_back(num_local - 1 - position);
+        }
+        return wires;
+    }
+
+    /**
+     * @brief Combine probabilities computed on each shard into the
+     * probabilities of a set of logical bits.
+     *
+     * @param logical_bits Index bits, the first being the most significant
+     * bit of the outcome.
+     * @param shard_probs Probabilities computed by each shard over the local
+     * bits among `logical_bits`, in the same order, the first being the most
+     * significant.
+     * @return std::vector<double> Probabilities of the 2^k outcomes.
+     */
+    [[nodiscard]] auto
+    reduceProbabilities(const std::vector<std::size_t> &logical_bits,
+                        const std::vector<std::vector<double>> &shard_probs)
+        const -> std::vector<double> {
+        PL_ABORT_IF_NOT(shard_probs.size() == getNumShards(),
+                        "Expected probabilities from every shard.");
+        const std::size_t num_bits = logical_bits.size();
+        const std::size_t num_local = getNumLocalQubits();
+
+        // Outcome bit of each local bit, and (outcome bit, shard bit) of each
+        // global bit
+        std::vector<std::size_t> local_outcome_bits;
+        std::vector<std::pair<std::size_t, std::size_t>> global_outcome_bits;
+        for (std::size_t i = 0; i < num_bits; i++) {
+            const std::size_t outcome_bit = num_bits - 1 - i;
+            const std::size_t physical = getPhysicalBit(logical_bits[i]);
+            if (physical < num_local) {
+                local_outcome_bits.push_back(outcome_bit);
+            } else {
+                global_outcome_bits.emplace_back(outcome_bit,
+                                                 physical - num_local);
+            }
+        }
+        const std::size_t num_local_bits = local_outcome_bits.size();
+
+        std::vector<double> probs(std::size_t{1} << num_bits, 0.0);
+        for (std::size_t shard = 0; shard < shard_probs.size(); shard++) {
+            PL_ABORT_IF_NOT(shard_probs[shard].size() ==
+                                (std::size_t{1} << num_local_bits),
+                            "Unexpected number of shard probabilities.");
+            std::size_t base = 0;
+            for (const auto &[outcome_bit, shard_bit] : global_outcome_bits) {
+                if ((shard >> shard_bit) & 1U) {
+                    base |= std::size_t{1} << outcome_bit;
+                }
+            }
+            for (std::size_t q = 0; q < shard_probs[shard].size(); q++) {
+                std::size_t outcome = base;
+                for (std::size_t j = 0; j < num_local_bits; j++) {
+                    if ((q >> (num_local_bits - 1 - j)) & 1U) {
+                        outcome |= std::size_t{1} << local_outcome_bits[j];
+                    }
+                }
+                probs[outcome] += shard_probs[shard][q];
+            }
+        }
+        return probs;
+    }
+
+  private:
+    std::size_t num_qubits_;
+    std::size_t num_global_;
+    std::vector<std::size_t> physical_of_logical_;
+    std::vector<std::size_t> logical_of_physical_;
+    std::vector<std::size_t> last_use_;
+    std::size_t tick_{0};
+    std::size_t num_swaps_{0};
+
+    void swapPhysical(std::size_t phys_a, std::size_t phys_b) {
+        std::swap(logical_of_physical_[phys_a], logical_of_physical_[phys_b]);
+        physical_of_logical_[logical_of_physical_[phys_a]] = phys_a;
+        physical_of_logical_[logical_of_physical_[phys_b]] = phys_b;
+    }
+};
+
+/**
+ * @brief Host reference of the index bit swaps between shards, with the
+ * shards held as memory slices. Mirrors custatevecMultiDeviceSwapIndexBits,
+ * so that swap schedules can be checked without devices.
+ *
+ * @tparam T Amplitude type.
+ * @param shards Amplitudes of each shard.
+ * @param swaps Disjoint (local, global) pairs of physical bits.
+ * @param num_local Number of local index bits.
+ */
+template <class T>
+void swapIndexBitsHost(std::vector<std::vector<T>> &shards,
+                       const std::vector<ShardLayout::BitSwap> &swaps,
+                       std::size_t num_local) {
+    for (const auto &[local, global] : swaps) {
+        const std::size_t shard_bit = std::size_t{1} << (global - num_local);
+        const std::size_t local_bit = std::size_t{1} << local;
+        for (std::size_t shard = 0; shard < shards.size(); shard++) {
+            if ((shard & shard_bit) != 0) {
+                continue;
+            }
+            auto &low = shards[shard];
+            auto &high = shards[shard | shard_bit];
+            // Exchange the amplitudes whose two swapped bits differ
+            for (std::size_t offset = 0; offset < low.size(); offset++) {
+                if ((offset & local_bit) != 0) {
+                    std::swap(low[offset], high[offset ^ local_bit]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace Pennylane::CUDA
@@ -71,11 +71,30 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         return data_buffer_->getData();
     }
     /**
-     * @brief Return a pointer to the GPU data.
+     * @brief Return a pointer to the GPU data. The state is assumed to be
+     * modified through it.
      *
      * @return CFP_t* Complex device pointer.
      */
-    [[nodiscard]] auto getData() -> CFP_t * { return data_buffer_->getData(); }
+    [[nodiscard]] auto getData() -> CFP_t * {
+        markStateChanged();
+        return data_buffer_->getData();
+    }
+
+    /**
+     * @brief Get a counter incremented whenever the state may have changed,
+     * through any non-const access to the device data. Results derived from
+     * the state can be cached as long as the counter is unchanged.
+     */
+    [[nodiscard]] auto getStateVersion() const -> std::size_t {
+        return state_version_;
+    }
+
+    /**
+     * @brief Record a modification of the device data made without going
+     * through this object, such as writes through an exported pointer.
+     */
+    void markStateChanged() { state_version_++; }
 
     /**
      * @brief Get the CUDA stream for the given object.
@@ -95,6 +114,36 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     }
     void setStream(const cudaStream_t &s) { data_buffer_->setStream(s); }
 
+    /**
+     * @brief Block the host until the work enqueued on the state-vector has
+     * completed.
+     *
+     * Gate applications and host uploads are enqueued on the stream of the
+     * state-vector and return without waiting for the device. Calls returning
+     * a result to the host (expectation values, probabilities, samples or the
+     * state itself) wait for it, so an explicit synchronization is only
+     * needed to time the device or to overlap host work with a circuit.
+     */
+    void synchronize() {
+        cudaEvent_t event = recordEvent();
+        PL_CUDA_IS_SUCCESS(cudaEventSynchronize(event));
+    }
+
+    /**
+     * @brief Check without blocking whether the work enqueued on the
+     * state-vector has completed.
+     *
+     * @return true if the device is done with the state-vector.
+     */
+    [[nodiscard]] auto query() -> bool {
+        const cudaError_t status = cudaEventQuery(recordEvent());
+        if (status == cudaErrorNotReady) {
+            return false;
+        }
+        PL_CUDA_IS_SUCCESS(status);
+        return true;
+    }
+
     /**
      * @brief Explicitly copy data from host memory to GPU device.
      *
@@ -104,6 +153,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                   bool async = false) {
         PL_ABORT_IF_NOT(BaseType::getNumQubits() == sv.getNumQubits(),
                         "Sizes do not match for Host and GPU data");
+        markStateChanged();
         data_buffer_->CopyHostDataToGpu(sv.getData(), sv.getLength(), async);
     }
 
@@ -117,6 +167,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                       bool async = false) {
         PL_ABORT_IF_NOT(BaseType::getLength() == sv.size(),
                         "Sizes do not match for Host and GPU data");
+        markStateChanged();
         data_buffer_->CopyHostDataToGpu(sv.data(), sv.size(), async);
     }
 
@@ -130,6 +181,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                    bool async = false) {
         PL_ABORT_IF_NOT(BaseType::getLength() == length,
                         "Sizes do not match for Host and GPU data");
+        markStateChanged();
         data_buffer_->CopyGpuDataToGpu(gpu_sv, length, async);
     }
     /**
@@ -148,6 +200,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                decltype(sv.getData())>>>;
         PL_ABORT_IF_NOT(same,
                         "Data types are incompatible for GPU-GPU transfer");
+        markStateChanged();
         data_buffer_->CopyGpuDataToGpu(sv.getData(), sv.getLength(), async);
     }
 
@@ -161,6 +214,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                   std::size_t length, bool async = false) {
         PL_ABORT_IF_NOT(BaseType::getLength() == length,
                         "Sizes do not match for Host and GPU data");
+        markStateChanged();
         data_buffer_->CopyHostDataToGpu(
             reinterpret_cast<const CFP_t *>(host_sv), length, async);
     }
@@ -205,7 +259,22 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         return *data_buffer_;
     }
 
-    CUDA::DataBuffer<CFP_t> &getDataBuffer() { return *data_buffer_; }
+    /**
+     * @brief Get the data buffer for modification. The state is assumed to be
+     * modified through it.
+     */
+    CUDA::DataBuffer<CFP_t> &getDataBuffer() {
+        markStateChanged();
+        return *data_buffer_;
+    }
+
+    /**
+     * @brief Get the device and stream of the state-vector, without marking
+     * the state as changed.
+     */
+    [[nodiscard]] auto getDevTag() const -> const CUDA::DevTag<int> & {
+        return data_buffer_->getDevTag();
+    }
 
     /**
      * @brief Update GPU device data from given derived object.
@@ -218,11 +287,18 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     }
 
     /**
-     * @brief Move and replace DataBuffer for statevector.
+     * @brief Move and replace DataBuffer for statevector. If the statevector
+     * is a view of memory it does not own, the data is copied into the view
+     * instead, so that the viewed memory stays up to date.
      *
      * @param other Source data to copy from.
      */
     void updateData(std::unique_ptr<CUDA::DataBuffer<CFP_t>> &&other) {
+        markStateChanged();
+        if (!data_buffer_->ownsMemory()) {
+            data_buffer_->CopyGpuDataToGpu(*other);
+            return;
+        }
         data_buffer_ = std::move(other);
     }
 
@@ -233,6 +309,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     void initSV(bool async = false) {
         size_t index = 0;
         CFP_t value = {1, 0};
+        markStateChanged();
         data_buffer_->zeroInit();
         setBasisState_CUDA(data_buffer_->getData(), value, index, async,
                            data_buffer_->getStream());
@@ -254,11 +331,20 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         : StateVectorBase<Precision, Derived>(num_qubits),
           data_buffer_{std::make_unique<CUDA::DataBuffer<CFP_t>>(
               Util::exp2(num_qubits), dev_tag, device_alloc)} {}
+
+    StateVectorCudaBase(std::unique_ptr<CUDA::DataBuffer<CFP_t>> &&data_buffer)
+        : StateVectorBase<Precision, Derived>(
+              Util::log2(data_buffer->getLength())),
+          data_buffer_{std::move(data_buffer)} {}
     StateVectorCudaBase() = delete;
     StateVectorCudaBase(const StateVectorCudaBase &other) = delete;
     StateVectorCudaBase(StateVectorCudaBase &&other) = delete;
 
-    virtual ~StateVectorCudaBase(){};
+    virtual ~StateVectorCudaBase() {
+        if (event_ != nullptr) {
+            cudaEventDestroy(event_);
+        }
+    };
 
     /**
      * @brief Return the mapping of named gates to amount of control wires they
@@ -280,7 +366,22 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     }
 
   private:
+    /**
+     * @brief Record the completion event on the stream of the state-vector.
+     */
+    auto recordEvent() -> cudaEvent_t {
+        if (event_ == nullptr) {
+            PL_CUDA_IS_SUCCESS(cudaEventCreateWithFlags(
+                &event_, cudaEventDisableTiming | cudaEventBlockingSync));
+        }
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(event_, data_buffer_->getStream()));
+        return event_;
+    }
+
     std::unique_ptr<CUDA::DataBuffer<CFP_t>> data_buffer_;
+    std::size_t state_version_{0};
+    /// Event marking the completion of the enqueued work, created on first use
+    cudaEvent_t event_{nullptr};
     const std::unordered_set<std::string> const_gates_{
         "Identity", "PauliX", "PauliY", "PauliZ", "Hadamard", "T",      "S",
         "CNOT",     "SWAP",   "CY",     "CZ",     "CSWAP",    "Toffoli"};
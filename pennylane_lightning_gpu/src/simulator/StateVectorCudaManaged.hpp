@@ -16,9 +16,13 @@
  */
 #pragma once
 
+#include <array>
+#include <memory>
 #include <random>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <cuComplex.h> // cuDoubleComplex
@@ -26,8 +30,18 @@
 #include <custatevec.h> // custatevecApplyMatrix
 
 #include "Constant.hpp"
+#include "CSRMatrixGPU.hpp"
+#include "DiagonalFusion.hpp"
 #include "Error.hpp"
+#include "GateFusion.hpp"
+#include "GateTape.hpp"
+#include "PauliGrouping.hpp"
+#include "Philox.hpp"
+#include "SampleCounts.hpp"
+#include "StagingPool.hpp"
 #include "StateVectorCudaBase.hpp"
+#include "TapeGraph.hpp"
+#include "WorkspaceArena.hpp"
 #include "cuGateCache.hpp"
 #include "cuGates_host.hpp"
 #include "cuda_helpers.hpp"
@@ -39,11 +53,15 @@ using namespace Pennylane::CUDA;
 using namespace Pennylane::Util;
 
 /**
- * @brief RAII wrapper class for custatevec handles.
+ * @brief RAII wrapper class for custatevec handles, bound to the stream of
+ * the state-vector they act on.
  */
 class CSVHandle {
   public:
-    CSVHandle() { PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(&handle)); }
+    explicit CSVHandle(cudaStream_t stream_id = 0) {
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(&handle));
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSetStream(handle, stream_id));
+    }
     ~CSVHandle() { PL_CUSTATEVEC_IS_SUCCESS(custatevecDestroy(handle)); }
 
     const custatevecHandle_t &ref() const { return handle; }
@@ -75,6 +93,19 @@ extern void setBasisState_CUDA(cuDoubleComplex *sv, cuDoubleComplex &value,
                                const size_t index, bool async,
                                cudaStream_t stream_id);
 
+// declarations of external functions (defined in pauliWord.cu).
+extern void scaleAndAddPauliWord_CUDA(const cuComplex *sv, cuComplex *acc,
+                                      size_t length, size_t x_mask,
+                                      size_t z_mask, cuComplex coeff,
+                                      size_t thread_per_block,
+                                      cudaStream_t stream_id);
+extern void scaleAndAddPauliWord_CUDA(const cuDoubleComplex *sv,
+                                      cuDoubleComplex *acc, size_t length,
+                                      size_t x_mask, size_t z_mask,
+                                      cuDoubleComplex coeff,
+                                      size_t thread_per_block,
+                                      cudaStream_t stream_id);
+
 /**
  * @brief Managed memory CUDA state-vector class using custateVec backed
  * gate-calls.
@@ -97,7 +128,9 @@ class StateVectorCudaManaged
     StateVectorCudaManaged(size_t num_qubits)
         : StateVectorCudaBase<Precision, StateVectorCudaManaged<Precision>>(
               num_qubits),
-          gate_cache_(true){};
+          gate_cache_(true) {
+        initTapeGates();
+    };
 
     StateVectorCudaManaged(size_t num_qubits, const DevTag<int> &dev_tag,
                            bool alloc = true)
@@ -105,8 +138,24 @@ class StateVectorCudaManaged
               num_qubits, dev_tag, alloc),
           gate_cache_(true, dev_tag) {
         BaseType::initSV();
+        initTapeGates();
     };
 
+    /**
+     * @brief Create a state-vector over a given data buffer, without
+     * initializing the data. With a non-owning buffer, the state-vector is a
+     * view of memory allocated elsewhere, e.g. a column of a larger matrix.
+     *
+     * @param data_buffer Buffer holding the state-vector data.
+     */
+    explicit StateVectorCudaManaged(
+        std::unique_ptr<DataBuffer<CFP_t>> &&data_buffer)
+        : StateVectorCudaBase<Precision, StateVectorCudaManaged<Precision>>(
+              std::move(data_buffer)),
+          gate_cache_(true, BaseType::getDevTag()) {
+        initTapeGates();
+    }
+
     StateVectorCudaManaged(const CFP_t *gpu_data, size_t length)
         : StateVectorCudaManaged(Util::log2(length)) {
         BaseType::CopyGpuDataToGpuIn(gpu_data, length, false);
@@ -126,26 +175,26 @@ class StateVectorCudaManaged
 
     StateVectorCudaManaged(const StateVectorCudaManaged &other)
         : StateVectorCudaManaged(other.getNumQubits(),
-                                 other.getDataBuffer().getDevTag()) {
+                                 other.getDevTag()) {
         BaseType::CopyGpuDataToGpuIn(other);
     }
 
     ~StateVectorCudaManaged() = default;
 
     /**
-     * @brief Set value for a single element of the state-vector on device. This
-     * method is implemented by cudaMemcpy.
+     * @brief Set the state-vector to zero except for a single element. Both
+     * writes are enqueued on the stream of the state-vector.
      *
      * @param value Value to be set for the target element.
      * @param index Index of the target element.
-     * @param async Use an asynchronous memory copy.
+     * @param async Return without waiting for the writes to complete.
      */
     void setBasisState(const std::complex<Precision> &value, const size_t index,
                        const bool async = false) {
         BaseType::getDataBuffer().zeroInit();
 
         CFP_t value_cu = cuUtil::complexToCu<std::complex<Precision>>(value);
-        auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
+        auto stream_id = BaseType::getDevTag().getStreamID();
         setBasisState_CUDA(BaseType::getData(), value_cu, index, async,
                            stream_id);
     }
@@ -158,7 +207,8 @@ class StateVectorCudaManaged
      * @param num_indices Number of elements to be passed to the state vector.
      * @param values Pointer to values to be set for the target elements.
      * @param indices Pointer to indices of the target elements.
-     * @param async Use an asynchronous memory copy.
+     * @param async Use an asynchronous memory copy. The host arrays are
+     * staged through pinned memory and may be reused once the call returns.
      */
     template <class index_type, size_t thread_per_block = 256>
     void setStateVector(const index_type num_indices,
@@ -166,8 +216,8 @@ class StateVectorCudaManaged
                         const index_type *indices, const bool async = false) {
         BaseType::getDataBuffer().zeroInit();
 
-        auto device_id = BaseType::getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
+        auto device_id = BaseType::getDevTag().getDeviceID();
+        auto stream_id = BaseType::getDevTag().getStreamID();
 
         index_type num_elements = num_indices;
         DataBuffer<index_type, int> d_indices{
@@ -175,8 +225,15 @@ class StateVectorCudaManaged
         DataBuffer<CFP_t, int> d_values{static_cast<std::size_t>(num_elements),
                                         device_id, stream_id, true};
 
-        d_indices.CopyHostDataToGpu(indices, d_indices.getLength(), async);
-        d_values.CopyHostDataToGpu(values, d_values.getLength(), async);
+        if (async) {
+            staging_.copyHostToDevice(d_indices.getData(), indices,
+                                      sizeof(index_type) * num_elements);
+            staging_.copyHostToDevice(d_values.getData(), values,
+                                      sizeof(CFP_t) * num_elements);
+        } else {
+            d_indices.CopyHostDataToGpu(indices, d_indices.getLength());
+            d_values.CopyHostDataToGpu(values, d_values.getLength());
+        }
 
         setStateVector_CUDA(BaseType::getData(), num_elements,
                             d_values.getData(), d_indices.getData(),
@@ -208,6 +265,16 @@ class StateVectorCudaManaged
                                             wires.end()};
         if (opName == "Identity") {
             return;
+        } else if (DiagonalFusion<Precision>::isDiagonal(opName) &&
+                   wires.size() <= max_diagonal_wires_) {
+            const auto diagonal = DiagonalFusion<Precision>::getGateDiagonal(
+                opName, wires.size(), params, adjoint);
+            if (diagonal.empty()) {
+                std::string message =
+                    "Invalid wires or parameters for gate: " + opName;
+                throw LightningException(message);
+            }
+            applyDiagonalGate(diagonal, {}, wires);
         } else if (native_gates_.find(opName) != native_gates_.end()) {
             applyParametricPauliGate({opName}, ctrls, tgts, params.front(),
                                      adjoint);
@@ -283,11 +350,13 @@ class StateVectorCudaManaged
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
-                           params[op_idx]);
+        PL_ABORT_IF(opNames.size() != params.size(),
+                    "Incompatible number of ops and params");
+        if (max_fused_wires_ > 0) {
+            applyOperationsFused(opNames, wires, adjoints, params);
+            return;
         }
+        applyOperationsDiagonalFolded(opNames, wires, adjoints, params);
     }
 
     /**
@@ -307,10 +376,351 @@ class StateVectorCudaManaged
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
-        const auto num_ops = opNames.size();
-        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
-            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx]);
+        applyOperation(
+            opNames, wires, adjoints,
+            std::vector<std::vector<Precision>>(opNames.size(), {0.0}));
+    }
+
+    /**
+     * @brief Apply a circuit unpacked by `unpackOperations`. Runs of
+     * consecutive gates that can be fused, or diagonal gates that can be
+     * folded when fusion is disabled, go through the multi-op
+     * `applyOperation`. All other gates are dispatched by opcode.
+     *
+     * @param tape Gate tape built for this number of qubits.
+     */
+    void applyUnpackedOperations(const GateTape<Precision> &tape) {
+        PL_ABORT_IF(tape.getNumQubits() != BaseType::getNumQubits(),
+                    "Gate tape does not match the number of qubits");
+        const auto &ops = tape.getOps();
+        std::size_t op_idx = 0;
+        while (op_idx < ops.size()) {
+            std::size_t run_end = op_idx;
+            while (run_end < ops.size() && isFoldable(ops[run_end])) {
+                run_end++;
+            }
+            if (run_end - op_idx < 2) {
+                applyTapeOperation(tape, op_idx);
+                op_idx++;
+                continue;
+            }
+
+            const std::size_t num_run_ops = run_end - op_idx;
+            std::vector<std::string> names(num_run_ops);
+            std::vector<std::vector<std::size_t>> wires(num_run_ops);
+            std::vector<bool> adjoints(num_run_ops);
+            std::vector<std::vector<Precision>> params(num_run_ops);
+            for (std::size_t i = 0; i < num_run_ops; i++) {
+                const auto &op = ops[op_idx + i];
+                const auto *op_params =
+                    tape.getParameters().data() + op.param_offset;
+                names[i] = getGateOpName(op.opcode);
+                wires[i] = tape.getOpWires(op_idx + i);
+                adjoints[i] = op.adjoint;
+                params[i].assign(op_params,
+                                 op_params + getGateOpNumParams(op.opcode));
+            }
+            applyOperation(names, wires, adjoints, params);
+            op_idx = run_end;
+        }
+    }
+
+    /**
+     * @brief Apply all gates of a pre-decoded tape to the state-vector.
+     *
+     * @param tape Gate tape built for this number of qubits.
+     * @param adjoint Apply the adjoint of the whole tape, i.e. the adjoint of
+     * each gate in reverse order.
+     * @param device_matrices Optional device copy of the tape's matrices, on
+     * the device and stream of the state-vector. When given, the matrices are
+     * read from it instead of being uploaded from the tape.
+     */
+    void applyTape(const GateTape<Precision> &tape, bool adjoint = false,
+                   const CFP_t *device_matrices = nullptr) {
+        PL_ABORT_IF(tape.getNumQubits() != BaseType::getNumQubits(),
+                    "Gate tape does not match the number of qubits");
+        const std::size_t num_ops = tape.getNumOps();
+        for (std::size_t i = 0; i < num_ops; i++) {
+            applyTapeOperation(tape, adjoint ? num_ops - 1 - i : i, adjoint,
+                               device_matrices);
+        }
+    }
+
+    /**
+     * @brief Apply a single gate of a pre-decoded tape to the state-vector.
+     * Gates are dispatched on their opcode, and use the tape's wire,
+     * parameter and matrix storage directly.
+     *
+     * @param tape Gate tape built for this number of qubits.
+     * @param op_idx Index of the gate in the tape.
+     * @param adjoint Apply the adjoint of the gate, in addition to any adjoint
+     * recorded in the tape.
+     * @param device_matrices Optional device copy of the tape's matrices.
+     */
+    void applyTapeOperation(const GateTape<Precision> &tape,
+                            std::size_t op_idx, bool adjoint = false,
+                            const CFP_t *device_matrices = nullptr) {
+        using Pauli = std::array<custatevecPauli_t, 64>;
+        const auto filled = [](custatevecPauli_t pauli) {
+            Pauli paulis{};
+            paulis.fill(pauli);
+            return paulis;
+        };
+        static const Pauli pauli_x = filled(CUSTATEVEC_PAULI_X);
+        static const Pauli pauli_y = filled(CUSTATEVEC_PAULI_Y);
+        static const Pauli pauli_z = filled(CUSTATEVEC_PAULI_Z);
+
+        const auto &op = tape.getOps()[op_idx];
+        const bool adj = (op.adjoint != adjoint);
+        const int *ctrls = tape.getWires().data() + op.wire_offset;
+        const int *tgts = ctrls + op.num_ctrls;
+        const std::size_t num_ctrls = op.num_ctrls;
+        const std::size_t num_tgts = op.num_tgts;
+        const Precision *params = tape.getParameters().data() + op.param_offset;
+        const CFP_t *matrix = tape.getMatrices().data() + op.matrix_offset;
+
+        const auto rotation = [&](const Pauli &paulis, Precision param) {
+            applyParametricPauliGate(paulis.data(), ctrls, num_ctrls, tgts,
+                                     num_tgts, param, adj);
+        };
+        const auto phase = [&](std::complex<Precision> value) {
+            const std::array<CFP_t, 2> diagonal{
+                cuUtil::ONE<CFP_t>(),
+                cuUtil::complexToCu<std::complex<Precision>>(
+                    adj ? std::conj(value) : value)};
+            applyDiagonalGate(diagonal.data(), ctrls, num_ctrls, tgts,
+                              num_tgts);
+        };
+        const auto fixed = [&](const CFP_t *gate) {
+            applyDeviceMatrixGate(gate, ctrls, num_ctrls, tgts, num_tgts, adj);
+        };
+
+        switch (op.opcode) {
+        case GateOp::Identity:
+            break;
+        case GateOp::PauliX:
+        case GateOp::CNOT:
+        case GateOp::Toffoli:
+            fixed(tape_gates_.pauli_x);
+            break;
+        case GateOp::PauliY:
+        case GateOp::CY:
+            fixed(tape_gates_.pauli_y);
+            break;
+        case GateOp::Hadamard:
+            fixed(tape_gates_.hadamard);
+            break;
+        case GateOp::SWAP:
+        case GateOp::CSWAP:
+            fixed(tape_gates_.swap);
+            break;
+        case GateOp::PauliZ:
+        case GateOp::CZ:
+            phase({-1, 0});
+            break;
+        case GateOp::S:
+            phase({0, 1});
+            break;
+        case GateOp::T:
+            phase(std::exp(
+                std::complex<Precision>{0, static_cast<Precision>(M_PI / 4)}));
+            break;
+        case GateOp::PhaseShift:
+        case GateOp::ControlledPhaseShift:
+            phase(std::exp(std::complex<Precision>{0, params[0]}));
+            break;
+        case GateOp::RX:
+        case GateOp::CRX:
+        case GateOp::IsingXX:
+            rotation(pauli_x, params[0]);
+            break;
+        case GateOp::RY:
+        case GateOp::CRY:
+        case GateOp::IsingYY:
+            rotation(pauli_y, params[0]);
+            break;
+        case GateOp::RZ:
+        case GateOp::CRZ:
+        case GateOp::IsingZZ:
+        case GateOp::MultiRZ:
+            rotation(pauli_z, params[0]);
+            break;
+        case GateOp::Rot:
+        case GateOp::CRot:
+            if (adj) {
+                rotation(pauli_z, params[2]);
+                rotation(pauli_y, params[1]);
+                rotation(pauli_z, params[0]);
+            } else {
+                rotation(pauli_z, params[0]);
+                rotation(pauli_y, params[1]);
+                rotation(pauli_z, params[2]);
+            }
+            break;
+        default: // excitations and explicit matrices
+            if (device_matrices != nullptr) {
+                fixed(device_matrices + op.matrix_offset);
+            } else {
+                applyHostMatrixGate(matrix,
+                                    Pennylane::Util::exp2(2 * num_tgts), ctrls,
+                                    num_ctrls, tgts, num_tgts, adj);
+            }
+            break;
+        }
+    }
+
+    /**
+     * @brief Apply all gates of a pre-decoded tape by launching a CUDA graph.
+     *
+     * The gates of the plan are captured once into a graph of matrix gates,
+     * reading their matrices from a device matrix table and using a static
+     * workspace. Later calls with the same plan only upload the matrices for
+     * the current tape parameters and launch the graph, which replaces one
+     * kernel launch per gate by a single launch. The graph is captured again
+     * when the plan or the state-vector's device buffer changes.
+     *
+     * @param tape Gate tape built for this number of qubits.
+     * @param plan Graph plan built from `tape`, or from a tape with the same
+     * gates and wires.
+     */
+    void applyTapeGraph(const GateTape<Precision> &tape,
+                        const TapeGraphPlan<Precision> &plan) {
+        PL_ABORT_IF(plan.getNumQubits() != BaseType::getNumQubits(),
+                    "Graph plan does not match the number of qubits");
+        if (plan.getNodes().empty()) {
+            return;
+        }
+        CFP_t *data = BaseType::getData();
+        if (!tape_graph_ || tape_graph_->plan_id != plan.getId() ||
+            tape_graph_->data != data) {
+            captureTapeGraph(plan, data);
         }
+        auto &graph = *tape_graph_;
+        plan.fillMatrixTable(tape, graph.host_table);
+
+        // Order the graph stream after the pending work on the state-vector
+        const cudaStream_t sv_stream =
+            BaseType::getDevTag().getStreamID();
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(graph.ready, sv_stream));
+        PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(graph.stream, graph.ready, 0));
+        graph.staging.copyHostToDevice(graph.table.getData(),
+                                       graph.host_table.data(),
+                                       sizeof(CFP_t) * graph.host_table.size());
+        PL_CUDA_IS_SUCCESS(cudaGraphLaunch(graph.exec, graph.stream));
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(graph.done, graph.stream));
+        PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(sv_stream, graph.done, 0));
+    }
+
+    /**
+     * @brief Get the number of CUDA graph captures made by `applyTapeGraph`.
+     */
+    [[nodiscard]] auto getNumTapeGraphCaptures() const -> std::size_t {
+        return num_tape_graph_captures_;
+    }
+
+    /**
+     * @brief Enable fusion of consecutive gates in the multi-op
+     * `applyOperation` calls. Runs of gates acting on at most
+     * `max_fused_wires` wires are multiplied into a single dense matrix on the
+     * host and applied with one pass over the state-vector.
+     *
+     * @param max_fused_wires Maximum number of wires of a fused block. A value
+     * of 0 disables fusion.
+     */
+    void setGateFusion(std::size_t max_fused_wires) {
+        PL_ABORT_IF(max_fused_wires >
+                        GateFusion<Precision>::max_supported_wires,
+                    "Requested gate fusion block exceeds the supported size");
+        max_fused_wires_ = max_fused_wires;
+    }
+
+    /**
+     * @brief Get the maximum number of wires of a fused gate block, with 0
+     * indicating that fusion is disabled.
+     */
+    [[nodiscard]] auto getGateFusion() const -> std::size_t {
+        return max_fused_wires_;
+    }
+
+    /**
+     * @brief Get the largest external workspace size in bytes requested by
+     * cuStateVec calls on this state-vector.
+     */
+    [[nodiscard]] auto getWorkspaceHighWaterMark() const -> std::size_t {
+        return workspace_.getHighWaterMark();
+    }
+
+    /**
+     * @brief Get the size in bytes of the device workspace currently held by
+     * this state-vector.
+     */
+    [[nodiscard]] auto getWorkspaceCapacity() const -> std::size_t {
+        return workspace_.getCapacity();
+    }
+
+    /**
+     * @brief Free the device workspace held by this state-vector. It is
+     * re-allocated on the next call requiring a workspace. A graph captured
+     * by `applyTapeGraph` is freed too, and captured again on its next use.
+     */
+    void releaseWorkspace() {
+        workspace_.release();
+        matrix_workspace_.release();
+        sampler_.reset();
+        sampler_workspace_.release();
+        tape_graph_.reset();
+        releaseScratch();
+    }
+
+    /**
+     * @brief Free the scratch state-vector and the accumulator held by this
+     * state-vector. They are re-allocated on their next use.
+     */
+    void releaseScratch() {
+        scratch_.reset();
+        accumulator_.reset();
+    }
+
+    /**
+     * @brief Seed the generator of the random numbers used for sampling, and
+     * restart its stream. Two state-vectors with the same seed and the same
+     * sequence of sampling calls draw the same samples.
+     */
+    void setSeed(std::uint64_t seed) { rng_.setSeed(seed); }
+
+    /**
+     * @brief Get the number of times the sampler was preprocessed. The
+     * sampler is only preprocessed again once the state has changed, or once
+     * more samples are requested at once than it was created for.
+     */
+    [[nodiscard]] auto getNumSamplerPreprocesses() const -> std::size_t {
+        return num_sampler_preprocesses_;
+    }
+
+    /**
+     * @brief Get the cuStateVec handle of this state-vector, bound to its
+     * device.
+     */
+    [[nodiscard]] auto getCusvHandle() -> custatevecHandle_t {
+        return handle.ref();
+    }
+
+    /**
+     * @brief Get the device gate cache of this state-vector.
+     */
+    [[nodiscard]] auto getGateCache() const -> const GateCache<Precision> & {
+        return gate_cache_;
+    }
+
+    /**
+     * @brief Set the device memory budget in bytes of the parametric and
+     * user-provided gates cached by this state-vector. Least recently used
+     * gates are evicted once it is exceeded.
+     *
+     * @param capacity_bytes Capacity in bytes.
+     */
+    void setGateCacheCapacity(std::size_t capacity_bytes) {
+        gate_cache_.setCapacity(capacity_bytes);
     }
 
     //****************************************************************************//
@@ -340,11 +750,9 @@ class StateVectorCudaManaged
     }
     inline void applyPauliZ(const std::vector<std::size_t> &wires,
                             bool adjoint) {
-        static const std::string name{"PauliZ"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param),
-                              {wires.begin(), wires.end() - 1}, {wires.back()},
-                              adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "PauliZ", 1, {}, adjoint),
+                          {wires.begin(), wires.end() - 1}, {wires.back()});
     }
     inline void applyHadamard(const std::vector<std::size_t> &wires,
                               bool adjoint) {
@@ -355,18 +763,14 @@ class StateVectorCudaManaged
                               adjoint);
     }
     inline void applyS(const std::vector<std::size_t> &wires, bool adjoint) {
-        static const std::string name{"S"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param),
-                              {wires.begin(), wires.end() - 1}, {wires.back()},
-                              adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "S", 1, {}, adjoint),
+                          {wires.begin(), wires.end() - 1}, {wires.back()});
     }
     inline void applyT(const std::vector<std::size_t> &wires, bool adjoint) {
-        static const std::string name{"T"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param),
-                              {wires.begin(), wires.end() - 1}, {wires.back()},
-                              adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "T", 1, {}, adjoint),
+                          {wires.begin(), wires.end() - 1}, {wires.back()});
     }
     inline void applyRX(const std::vector<std::size_t> &wires, bool adjoint,
                         Precision param) {
@@ -404,15 +808,9 @@ class StateVectorCudaManaged
     }
     inline void applyPhaseShift(const std::vector<std::size_t> &wires,
                                 bool adjoint, Precision param) {
-        static const std::string name{"PhaseShift"};
-        const auto gate_key = std::make_pair(name, param);
-        if (!gate_cache_.gateExists(gate_key)) {
-            gate_cache_.add_gate(gate_key,
-                                 cuGates::getPhaseShift<CFP_t>(param));
-        }
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(gate_key),
-                              {wires.begin(), wires.end() - 1}, {wires.back()},
-                              adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "PhaseShift", 1, {param}, adjoint),
+                          {wires.begin(), wires.end() - 1}, {wires.back()});
     }
 
     /* two-qubit gates */
@@ -431,11 +829,9 @@ class StateVectorCudaManaged
                               adjoint);
     }
     inline void applyCZ(const std::vector<std::size_t> &wires, bool adjoint) {
-        static const std::string name{"CZ"};
-        static const Precision param = 0.0;
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param),
-                              {wires.begin(), wires.end() - 1}, {wires.back()},
-                              adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "PauliZ", 1, {}, adjoint),
+                          {wires.begin(), wires.end() - 1}, {wires.back()});
     }
     inline void applySWAP(const std::vector<std::size_t> &wires, bool adjoint) {
         static const std::string name{"SWAP"};
@@ -455,8 +851,9 @@ class StateVectorCudaManaged
     }
     inline void applyIsingZZ(const std::vector<std::size_t> &wires,
                              bool adjoint, Precision param) {
-        static const std::vector<std::string> names(wires.size(), {"RZ"});
-        applyParametricPauliGate(names, {}, wires, param, adjoint);
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "IsingZZ", wires.size(), {param}, adjoint),
+                          {}, wires);
     }
     inline void applyCRot(const std::vector<std::size_t> &wires, bool adjoint,
                           const std::vector<Precision> &params) {
@@ -549,25 +946,32 @@ class StateVectorCudaManaged
     inline void applyDoubleExcitation(const std::vector<std::size_t> &wires,
                                       bool adjoint, Precision param) {
         auto &&mat = cuGates::getDoubleExcitation<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyHostMatrixGate(mat, {}, wires, adjoint);
     }
     inline void
     applyDoubleExcitationMinus(const std::vector<std::size_t> &wires,
                                bool adjoint, Precision param) {
         auto &&mat = cuGates::getDoubleExcitationMinus<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyHostMatrixGate(mat, {}, wires, adjoint);
     }
     inline void applyDoubleExcitationPlus(const std::vector<std::size_t> &wires,
                                           bool adjoint, Precision param) {
         auto &&mat = cuGates::getDoubleExcitationPlus<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyHostMatrixGate(mat, {}, wires, adjoint);
     }
 
     /* Multi-qubit gates */
     inline void applyMultiRZ(const std::vector<std::size_t> &wires,
                              bool adjoint, Precision param) {
-        const std::vector<std::string> names(wires.size(), {"RZ"});
-        applyParametricPauliGate(names, {}, wires, param, adjoint);
+        if (wires.size() > max_diagonal_wires_) {
+            // avoid materializing an exponentially large diagonal
+            const std::vector<std::string> names(wires.size(), {"RZ"});
+            applyParametricPauliGate(names, {}, wires, param, adjoint);
+            return;
+        }
+        applyDiagonalGate(DiagonalFusion<Precision>::getGateDiagonal(
+                              "MultiRZ", wires.size(), {param}, adjoint),
+                          {}, wires);
     }
 
     /* Gate generators */
@@ -790,6 +1194,25 @@ class StateVectorCudaManaged
         return expect_val;
     }
 
+    /**
+     * @brief expval(H) calculation with cuSparseSpMV. The matrix is uploaded
+     * once per device and reused by later calls.
+     *
+     * @tparam index_type Integer type used as indices of the sparse matrix.
+     * @param matrix Sparse matrix of the observable.
+     * @return auto Expectation value.
+     */
+    template <class index_type>
+    auto getExpectationValueOnSparseSpMV(
+        const CSRMatrixGPU<Precision, index_type> &matrix) -> Precision {
+        const CFP_t *h_sv = applySparseMatrixToScratch(matrix);
+        const auto &dev_tag = BaseType::getDevTag();
+        return innerProdC_CUDA(std::as_const(*this).getData(), h_sv,
+                               BaseType::getLength(), dev_tag.getDeviceID(),
+                               dev_tag.getStreamID())
+            .x;
+    }
+
     /**
      * @brief expval(H) calculation with cuSparseSpMV.
      *
@@ -808,130 +1231,113 @@ class StateVectorCudaManaged
         const index_type *csrOffsets_ptr, const index_type csrOffsets_size,
         const index_type *columns_ptr,
         const std::complex<Precision> *values_ptr, const index_type numNNZ) {
+        const CSRMatrixGPU<Precision, index_type> matrix{
+            {values_ptr, values_ptr + numNNZ},
+            {columns_ptr, columns_ptr + numNNZ},
+            {csrOffsets_ptr, csrOffsets_ptr + csrOffsets_size}};
+        return getExpectationValueOnSparseSpMV(matrix);
+    }
 
-        const index_type nIndexBits = BaseType::getNumQubits();
-        const index_type length = 1 << nIndexBits;
-        const int64_t num_rows = static_cast<int64_t>(
-            csrOffsets_size -
-            1); // int64_t is required for num_rows by cusparseCreateCsr
-        const int64_t num_cols = static_cast<int64_t>(
-            num_rows); // int64_t is required for num_cols by cusparseCreateCsr
-        const int64_t nnz = static_cast<int64_t>(
-            numNNZ); // int64_t is required for nnz by cusparseCreateCsr
-
-        const CFP_t alpha = {1.0, 0.0};
-        const CFP_t beta = {0.0, 0.0};
-
-        Precision expect = 0;
-
-        auto device_id = BaseType::getDataBuffer().getDevTag().getDeviceID();
-        auto stream_id = BaseType::getDataBuffer().getDevTag().getStreamID();
-
-        DataBuffer<index_type, int> d_csrOffsets{
-            static_cast<std::size_t>(csrOffsets_size), device_id, stream_id,
-            true};
-        DataBuffer<index_type, int> d_columns{static_cast<std::size_t>(numNNZ),
-                                              device_id, stream_id, true};
-        DataBuffer<CFP_t, int> d_values{static_cast<std::size_t>(numNNZ),
-                                        device_id, stream_id, true};
-        DataBuffer<CFP_t, int> d_tmp{static_cast<std::size_t>(length),
-                                     device_id, stream_id, true};
+    /**
+     * @brief var(H) calculation with cuSparseSpMV, for a Hermitian H. A single
+     * product H|psi> gives both <H^2> = <H psi|H psi> and <H>.
+     *
+     * @tparam index_type Integer type used as indices of the sparse matrix.
+     * @param matrix Sparse matrix of the observable.
+     * @return auto Variance.
+     */
+    template <class index_type>
+    auto getVarianceOnSparseSpMV(
+        const CSRMatrixGPU<Precision, index_type> &matrix) -> Precision {
+        const CFP_t *h_sv = applySparseMatrixToScratch(matrix);
+        const auto &dev_tag = BaseType::getDevTag();
+        const Precision mean =
+            innerProdC_CUDA(std::as_const(*this).getData(), h_sv,
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID())
+                .x;
+        const Precision squared_mean =
+            innerProdC_CUDA(h_sv, h_sv, BaseType::getLength(),
+                            dev_tag.getDeviceID(), dev_tag.getStreamID())
+                .x;
+        return squared_mean - mean * mean;
+    }
 
-        d_csrOffsets.CopyHostDataToGpu(csrOffsets_ptr, d_csrOffsets.getLength(),
-                                       false);
-        d_columns.CopyHostDataToGpu(columns_ptr, d_columns.getLength(), false);
-        d_values.CopyHostDataToGpu(values_ptr, d_values.getLength(), false);
+    /**
+     * @brief Variance of an observable, computing <O> and <O^2> together.
+     *
+     * Pauli words use O^2 = I and need a single expectation value. Diagonal
+     * observables take both moments from one probability pass over their
+     * wires. Other Hermitian observables are applied once to a scratch copy
+     * of the state, and O|psi> gives <O> = <psi|O psi> and
+     * <O^2> = <O psi|O psi>.
+     *
+     * @param obsNames Names of the factors of the observable. Words made of
+     * "PauliX", "PauliY", "PauliZ" and "Identity" use the Pauli-word path.
+     * @param wires Wires of the observable.
+     * @param matrix Host-defined row-major order matrix of the observable.
+     * @return Precision Variance.
+     */
+    auto variance(const std::vector<std::string> &obsNames,
+                  const std::vector<size_t> &wires,
+                  const std::vector<std::complex<Precision>> &matrix)
+        -> Precision {
+        static const std::unordered_map<std::string, char> pauli_letters{
+            {"PauliX", 'X'},
+            {"PauliY", 'Y'},
+            {"PauliZ", 'Z'},
+            {"Identity", 'I'}};
+        if (obsNames.size() == wires.size() &&
+            std::all_of(obsNames.begin(), obsNames.end(),
+                        [&](const std::string &name) {
+                            return pauli_letters.count(name) != 0;
+                        })) {
+            std::string word;
+            for (const auto &name : obsNames) {
+                word.push_back(pauli_letters.at(name));
+            }
+            const double mean = getPauliWordExpectations({word}, {wires})[0];
+            return static_cast<Precision>(1.0 - mean * mean);
+        }
 
-        cudaDataType_t data_type;
-        cusparseIndexType_t compute_type;
+        const std::size_t dim = Util::exp2(wires.size());
+        PL_ABORT_IF_NOT(matrix.size() == dim * dim,
+                        "The matrix does not match the number of wires");
 
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-            compute_type = CUSPARSE_INDEX_64I;
-        } else {
-            data_type = CUDA_C_32F;
-            compute_type = CUSPARSE_INDEX_32I;
-        }
-
-        // CUSPARSE APIs
-        cusparseHandle_t handle = nullptr;
-        cusparseSpMatDescr_t mat;
-        cusparseDnVecDescr_t vecX, vecY;
-
-        size_t bufferSize = 0;
-
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreate(&handle));
-
-        // Create sparse matrix A in CSR format
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
-            /* cusparseSpMatDescr_t* */ &mat,
-            /* int64_t */ num_rows,
-            /* int64_t */ num_cols,
-            /* int64_t */ nnz,
-            /* void* */ d_csrOffsets.getData(),
-            /* void* */ d_columns.getData(),
-            /* void* */ d_values.getData(),
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexType_t */ compute_type,
-            /* cusparseIndexBase_t */ CUSPARSE_INDEX_BASE_ZERO,
-            /* cudaDataType */ data_type));
-
-        // Create dense vector X
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &vecX,
-            /* int64_t */ num_cols,
-            /* void* */ BaseType::getData(),
-            /* cudaDataType */ data_type));
-
-        // Create dense vector y
-        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
-            /* cusparseDnVecDescr_t* */ &vecY,
-            /* int64_t */ num_rows,
-            /* void* */ d_tmp.getData(),
-            /* cudaDataType */ data_type));
-
-        // allocate an external buffer if needed
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ mat,
-            /* cusparseDnVecDescr_t */ vecX,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ vecY,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
-            /* size_t* */ &bufferSize));
-
-        DataBuffer<cudaDataType_t, int> dBuffer{bufferSize, device_id,
-                                                stream_id, true};
-
-        // execute SpMV
-        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
-            /* cusparseHandle_t */ handle,
-            /* cusparseOperation_t */ CUSPARSE_OPERATION_NON_TRANSPOSE,
-            /* const void* */ &alpha,
-            /* cusparseSpMatDescr_t */ mat,
-            /* cusparseDnVecDescr_t */ vecX,
-            /* const void* */ &beta,
-            /* cusparseDnVecDescr_t */ vecY,
-            /* cudaDataType */ data_type,
-            /* cusparseSpMVAlg_t */ CUSPARSE_SPMV_ALG_DEFAULT,
-            /* void* */
-            reinterpret_cast<void *>(dBuffer.getData())));
-
-        // destroy matrix/vector descriptors
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(mat));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecX));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vecY));
-        PL_CUSPARSE_IS_SUCCESS(cusparseDestroy(handle));
-
-        expect = innerProdC_CUDA(BaseType::getData(), d_tmp.getData(),
-                                 BaseType::getLength(), device_id, stream_id)
-                     .x;
+        bool is_diagonal = true;
+        for (std::size_t i = 0; i < matrix.size() && is_diagonal; i++) {
+            is_diagonal = (i % (dim + 1) == 0) ||
+                          matrix[i] == std::complex<Precision>{0, 0};
+        }
+        if (is_diagonal) {
+            // Reversed, so that the first wire is the most significant bit
+            const auto probabilities =
+                probability({wires.rbegin(), wires.rend()});
+            double mean = 0;
+            double squared_mean = 0;
+            for (std::size_t i = 0; i < dim; i++) {
+                const double eigval = std::real(matrix[i * (dim + 1)]);
+                mean += probabilities[i] * eigval;
+                squared_mean += probabilities[i] * eigval * eigval;
+            }
+            return static_cast<Precision>(squared_mean - mean * mean);
+        }
 
-        return expect;
+        auto &o_sv = copyToScratch();
+        o_sv.applyHostMatrixGate(matrix, {}, {wires.rbegin(), wires.rend()});
+        const auto &dev_tag = BaseType::getDevTag();
+        const Precision mean =
+            innerProdC_CUDA(std::as_const(*this).getData(),
+                            std::as_const(o_sv).getData(),
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID())
+                .x;
+        const Precision squared_mean =
+            innerProdC_CUDA(o_sv.getData(), o_sv.getData(),
+                            BaseType::getLength(), dev_tag.getDeviceID(),
+                            dev_tag.getStreamID())
+                .x;
+        return squared_mean - mean * mean;
     }
 
     /**
@@ -969,7 +1375,7 @@ class StateVectorCudaManaged
 
         PL_CUSTATEVEC_IS_SUCCESS(custatevecAbs2SumArray(
             /* custatevecHandle_t */ handle.ref(),
-            /* const void* */ BaseType::getData(),
+            /* const void* */ std::as_const(*this).getData(),
             /* cudaDataType_t */ data_type,
             /* const uint32_t */ BaseType::getNumQubits(),
             /* double* */ probabilities.data(),
@@ -983,94 +1389,68 @@ class StateVectorCudaManaged
     }
 
     /**
-     * @brief Utility method for samples.
+     * @brief Draw packed samples of the computational basis.
+     *
+     * The random numbers come from the generator seeded by `setSeed`, and the
+     * preprocessed sampler is reused while the state is unchanged.
      *
      * @param num_samples Number of Samples
      *
-     * @return std::vector<size_t> A 1-d array storing the samples.
-     * Each sample has a length equal to the number of qubits. Each sample can
-     * be accessed using the stride sample_id*num_qubits, where sample_id is a
-     * number between 0 and num_samples-1.
+     * @return std::vector<custatevecIndex_t> One basis-state index per sample,
+     * in ascending order. Qubit 0 is the most significant bit of each index.
      */
-    auto generate_samples(size_t num_samples) -> std::vector<size_t> {
-
-        std::vector<double> rand_nums(num_samples);
-        custatevecSamplerDescriptor_t sampler;
-
-        const size_t num_qubits = BaseType::getNumQubits();
+    auto generate_samples_packed(size_t num_samples)
+        -> std::vector<custatevecIndex_t> {
+        std::vector<custatevecIndex_t> bitStrings(num_samples);
+        // Leave the random stream untouched when no sample is drawn
+        if (num_samples == 0) {
+            return bitStrings;
+        }
         const int bitStringLen = BaseType::getNumQubits();
 
-        std::vector<int> bitOrdering(num_qubits);
+        std::vector<int> bitOrdering(bitStringLen);
         std::iota(std::begin(bitOrdering), std::end(bitOrdering),
                   0); // Fill with 0, 1, ...,
 
-        cudaDataType_t data_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-        } else {
-            data_type = CUDA_C_32F;
-        }
-
-        std::mt19937 gen(std::random_device{}());
-        std::uniform_real_distribution<Precision> dis(0.0, 1.0);
-        for (size_t n = 0; n < num_samples; n++) {
-            rand_nums[n] = dis(gen);
-        }
-        std::vector<size_t> samples(num_samples * num_qubits, 0);
-        std::unordered_map<size_t, size_t> cache;
-        std::vector<custatevecIndex_t> bitStrings(num_samples);
-
-        void *extraWorkspace = nullptr;
-        size_t extraWorkspaceSizeInBytes = 0;
-        // create sampler and check the size of external workspace
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
-            handle.ref(), BaseType::getData(), data_type, num_qubits, &sampler,
-            num_samples, &extraWorkspaceSizeInBytes));
-
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-
-        // sample preprocess
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
-            handle.ref(), sampler, extraWorkspace, extraWorkspaceSizeInBytes));
+        std::vector<double> rand_nums(num_samples);
+        rng_.fillUniform(rand_nums.data(), num_samples);
 
         // sample bit strings
         PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerSample(
-            handle.ref(), sampler, bitStrings.data(), bitOrdering.data(),
-            bitStringLen, rand_nums.data(), num_samples,
+            handle.ref(), prepareSampler(num_samples), bitStrings.data(),
+            bitOrdering.data(), bitStringLen, rand_nums.data(), num_samples,
             CUSTATEVEC_SAMPLER_OUTPUT_ASCENDING_ORDER));
 
-        // destroy descriptor and handle
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler));
-
-        // Pick samples
-        for (size_t i = 0; i < num_samples; i++) {
-            auto idx = bitStrings[i];
-            // If cached, retrieve sample from cache
-            if (cache.count(idx) != 0) {
-                size_t cache_id = cache[idx];
-                auto it_temp = samples.begin() + cache_id * num_qubits;
-                std::copy(it_temp, it_temp + num_qubits,
-                          samples.begin() + i * num_qubits);
-            }
-            // If not cached, compute
-            else {
-                for (size_t j = 0; j < num_qubits; j++) {
-                    samples[i * num_qubits + (num_qubits - 1 - j)] =
-                        (idx >> j) & 1U;
-                }
-                cache[idx] = i;
-            }
-        }
+        return bitStrings;
+    }
 
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+    /**
+     * @brief Draw samples of the computational basis and count the
+     * occurrences of each outcome.
+     *
+     * @param num_samples Number of Samples
+     *
+     * @return Pair of the distinct basis-state indices drawn, in ascending
+     * order, and the number of samples of each.
+     */
+    auto generate_counts(size_t num_samples)
+        -> std::pair<std::vector<custatevecIndex_t>, std::vector<size_t>> {
+        return countSamples(generate_samples_packed(num_samples));
+    }
 
-        return samples;
+    /**
+     * @brief Utility method for samples.
+     *
+     * @param num_samples Number of Samples
+     *
+     * @return std::vector<size_t> A 1-d array storing the samples.
+     * Each sample has a length equal to the number of qubits. Each sample can
+     * be accessed using the stride sample_id*num_qubits, where sample_id is a
+     * number between 0 and num_samples-1.
+     */
+    auto generate_samples(size_t num_samples) -> std::vector<size_t> {
+        return unpackSamples(generate_samples_packed(num_samples),
+                             BaseType::getNumQubits());
     }
 
     /**
@@ -1085,83 +1465,169 @@ class StateVectorCudaManaged
         const std::vector<std::string> &pauli_words,
         const std::vector<std::vector<std::size_t>> &tgts,
         const std::complex<Precision> *coeffs) {
+        return sumPauliWordExpectations(
+            getPauliWordExpectations(pauli_words, tgts), coeffs);
+    }
 
-        uint32_t nIndexBits = static_cast<uint32_t>(BaseType::getNumQubits());
-        cudaDataType_t data_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-        } else {
-            data_type = CUDA_C_32F;
-        }
-
-        // Note: due to API design, cuStateVec assumes this is always a double.
-        // Push NVIDIA to move this to behind API for future releases, and
-        // support 32/64 bits.
+    /**
+     * @brief Get expectation value for a sum of Pauli words, measuring
+     * qubit-wise-commuting words together.
+     *
+     * The words are partitioned by `groupQubitWiseCommuting`. For each group,
+     * a scratch copy of the state is rotated into the measurement basis of the
+     * group, and a single probability pass over the wires of the group gives
+     * the expectation values of all its words. Hamiltonians with thousands of
+     * words then need dozens of passes over the state instead of one per
+     * word, at the cost of a scratch copy of the state-vector. Groups only
+     * measured in the Z basis read the state directly.
+     *
+     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
+     * @param tgts Coupled qubit index to apply each Pauli term.
+     * @param coeffs Numpy array buffer of size |pauli_words|
+     * @param max_group_wires Maximum number of wires spanned by a group, which
+     * bounds the size of the marginal distributions copied to the host. Words
+     * acting on more wires are evaluated one by one.
+     * @return auto Expectation value.
+     */
+    auto getExpectationValuePauliWordsGrouped(
+        const std::vector<std::string> &pauli_words,
+        const std::vector<std::vector<std::size_t>> &tgts,
+        const std::complex<Precision> *coeffs,
+        std::size_t max_group_wires = 20) {
+        const auto groups =
+            groupQubitWiseCommuting(pauli_words, tgts, max_group_wires);
         std::vector<double> expect(pauli_words.size());
 
-        std::vector<std::vector<custatevecPauli_t>> pauliOps;
+        std::vector<std::string> wide_words;
+        std::vector<std::vector<std::size_t>> wide_tgts;
+        std::vector<std::size_t> wide_terms;
+        for (const auto &group : groups) {
+            if (group.wires.size() > max_group_wires) {
+                for (const auto term : group.terms) {
+                    wide_words.push_back(pauli_words[term]);
+                    wide_tgts.push_back(tgts[term]);
+                    wide_terms.push_back(term);
+                }
+                continue;
+            }
+            if (group.wires.empty()) {
+                for (const auto term : group.terms) {
+                    expect[term] = 1.0;
+                }
+                continue;
+            }
 
-        std::vector<custatevecPauli_t *> pauliOps_ptr;
+            StateVectorCudaManaged *measured = this;
+            if (std::any_of(group.bases.begin(), group.bases.end(),
+                            [](char basis) { return basis != 'Z'; })) {
+                measured = &copyToScratch();
+                for (std::size_t i = 0; i < group.wires.size(); i++) {
+                    if (group.bases[i] != 'Z') {
+                        measured->applyHostMatrixGate(
+                            getBasisRotation(group.bases[i]), {},
+                            {group.wires[i]});
+                    }
+                }
+            }
 
-        for (auto &p_word : pauli_words) {
-            pauliOps.push_back(cuUtil::pauliStringToEnum(p_word));
-            pauliOps_ptr.push_back((*pauliOps.rbegin()).data());
+            // Bit i of the marginal is wires[i], as encoded in the masks
+            const auto probabilities = measured->probability(group.wires);
+            for (std::size_t i = 0; i < group.terms.size(); i++) {
+                expect[group.terms[i]] =
+                    parityExpectation(probabilities, group.masks[i]);
+            }
         }
 
-        std::vector<std::vector<int32_t>> basisBits;
-        std::vector<int32_t *> basisBits_ptr;
-        std::vector<uint32_t> n_basisBits;
-
-        for (auto &wires : tgts) {
-            std::vector<int32_t> wiresInt(wires.size());
-            std::transform(wires.begin(), wires.end(), wiresInt.begin(),
-                           [&](std::size_t x) {
-                               return static_cast<int>(
-                                   BaseType::getNumQubits() - 1 - x);
-                           });
-            basisBits.push_back(wiresInt);
-            basisBits_ptr.push_back((*basisBits.rbegin()).data());
-            n_basisBits.push_back(wiresInt.size());
+        if (!wide_terms.empty()) {
+            const auto wide_expect =
+                getPauliWordExpectations(wide_words, wide_tgts);
+            for (std::size_t i = 0; i < wide_terms.size(); i++) {
+                expect[wide_terms[i]] = wide_expect[i];
+            }
         }
+        return sumPauliWordExpectations(expect, coeffs);
+    }
 
-        // compute expectation
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationsOnPauliBasis(
-            /* custatevecHandle_t */ handle.ref(),
-            /* void* */ BaseType::getData(),
-            /* cudaDataType_t */ data_type,
-            /* const uint32_t */ nIndexBits,
-            /* double* */ expect.data(),
-            /* const custatevecPauli_t ** */
-            const_cast<const custatevecPauli_t **>(pauliOps_ptr.data()),
-            /* const uint32_t */ static_cast<uint32_t>(pauliOps.size()),
-            /* const int32_t ** */
-            const_cast<const int32_t **>(basisBits_ptr.data()),
-            /* const uint32_t */ n_basisBits.data()));
-
-        std::complex<Precision> result{0, 0};
-
-        if constexpr (std::is_same_v<Precision, double>) {
-            for (std::size_t idx = 0; idx < expect.size(); idx++) {
-                result += expect[idx] * coeffs[idx];
-            }
-            return std::real(result);
+    /**
+     * @brief Copy the state into the scratch state-vector, allocated on first
+     * use, and return the copy. The copy is overwritten by the next call using
+     * the scratch state-vector, including measurements of this state-vector.
+     */
+    auto copyToScratch() -> StateVectorCudaManaged & {
+        if (scratch_) {
+            scratch_->updateData(*this);
         } else {
-            std::vector<Precision> expect_cast(expect.size());
-            std::transform(expect.begin(), expect.end(), expect_cast.begin(),
-                           [](double x) { return static_cast<float>(x); });
+            scratch_ = std::make_unique<StateVectorCudaManaged>(*this);
+        }
+        return *scratch_;
+    }
 
-            for (std::size_t idx = 0; idx < expect_cast.size(); idx++) {
-                result += expect_cast[idx] * expect_cast[idx];
-            }
+    /**
+     * @brief Get a device buffer the size of the state-vector, allocated on
+     * first use, for states derived from this one. Its content is undefined,
+     * and is overwritten by the next call using the accumulator, including
+     * measurements of this state-vector.
+     */
+    auto getAccumulator() -> DataBuffer<CFP_t, int> & {
+        if (!accumulator_) {
+            accumulator_ = std::make_unique<DataBuffer<CFP_t, int>>(
+                BaseType::getLength(), BaseType::getDevTag());
+        }
+        return *accumulator_;
+    }
+
+    /**
+     * @brief Get the accumulator zero-initialized, for accumulating linear
+     * combinations of states. The buffer is zeroed again by the next call.
+     */
+    auto getZeroedAccumulator() -> DataBuffer<CFP_t, int> & {
+        auto &accumulator = getAccumulator();
+        accumulator.zeroInit();
+        return accumulator;
+    }
 
-            return std::real(result);
+    /**
+     * @brief Add a Pauli word applied to the state-vector, scaled by a
+     * coefficient, to a device buffer in a single pass. The state-vector is
+     * left unchanged.
+     *
+     * @param coeff Coefficient of the word.
+     * @param pauli_word Pauli word, as a string of 'I', 'X', 'Y' and 'Z'.
+     * @param wires Wires of the word.
+     * @param acc Device buffer of the size of the state-vector.
+     */
+    template <size_t thread_per_block = 256>
+    void scaleAndAddPauliWord(const std::complex<Precision> &coeff,
+                              const std::string &pauli_word,
+                              const std::vector<size_t> &wires,
+                              CFP_t *acc) const {
+        const auto masks =
+            getPauliWordMasks(pauli_word, wires, BaseType::getNumQubits());
+        // Fold the phase i^num_y of the Y factors into the coefficient
+        std::complex<Precision> phase = coeff;
+        for (size_t i = 0; i < masks.num_y % 4; i++) {
+            phase *= std::complex<Precision>{0, 1};
         }
+
+        auto stream_id = BaseType::getDevTag().getStreamID();
+        scaleAndAddPauliWord_CUDA(
+            BaseType::getData(), acc, BaseType::getLength(), masks.x_mask,
+            masks.z_mask, cuUtil::complexToCu<std::complex<Precision>>(phase),
+            thread_per_block, stream_id);
     }
 
   private:
     GateCache<Precision> gate_cache_;
+    std::size_t max_fused_wires_{0};
+    /// Largest number of wires of a folded run of diagonal gates.
+    static constexpr std::size_t max_diagonal_wires_ = 10;
+    /// Cached device matrices of the fixed gates used by `applyTapeOperation`.
+    struct TapeGates {
+        const CFP_t *pauli_x{nullptr};
+        const CFP_t *pauli_y{nullptr};
+        const CFP_t *hadamard{nullptr};
+        const CFP_t *swap{nullptr};
+    } tape_gates_;
     using ParFunc = std::function<void(const std::vector<size_t> &, bool,
                                        const std::vector<Precision> &)>;
     using FMap = std::unordered_map<std::string, ParFunc>;
@@ -1292,7 +1758,228 @@ class StateVectorCudaManaged
                        std::forward<decltype(adjoint)>(adjoint),
                        std::forward<decltype(params)>(params));
          }}};
-    CSVHandle handle;
+    CSVHandle handle{BaseType::getDevTag().getStreamID()};
+    WorkspaceArena<int> workspace_{BaseType::getDevTag()};
+    /// Device copy of the last matrix given by `applyHostMatrixGate`
+    WorkspaceArena<int> matrix_workspace_{
+        BaseType::getDevTag()};
+    /// Pinned memory through which host data are uploaded on the stream
+    StagingPool staging_{BaseType::getDevTag().getStreamID()};
+
+    struct SamplerDeleter {
+        void operator()(custatevecSamplerDescriptor_t sampler) const {
+            custatevecSamplerDestroy(sampler);
+        }
+    };
+    /// Preprocessed sampler of the state of version `sampler_version_`
+    std::unique_ptr<std::remove_pointer_t<custatevecSamplerDescriptor_t>,
+                    SamplerDeleter>
+        sampler_;
+    std::size_t sampler_version_{0};
+    std::size_t sampler_max_shots_{0};
+    std::size_t num_sampler_preprocesses_{0};
+    // The preprocessed data must outlive the calls using `workspace_`
+    WorkspaceArena<int> sampler_workspace_{
+        BaseType::getDevTag()};
+    Philox4x32 rng_{(std::uint64_t{std::random_device{}()} << 32U) |
+                    std::random_device{}()};
+    /// Copy of the state transformed by measurements, kept across calls
+    std::unique_ptr<StateVectorCudaManaged> scratch_;
+    /// Accumulator of linear combinations of states, kept across calls
+    std::unique_ptr<DataBuffer<CFP_t, int>> accumulator_;
+
+    /// CUDA graph captured by `applyTapeGraph`, with the device buffers whose
+    /// addresses are recorded in it. The matrix table is uploaded through
+    /// pinned blocks holding a whole table, so that the host does not wait
+    /// for the previous replay.
+    struct TapeGraph {
+        TapeGraph(std::size_t table_size, const DevTag<int> &dev_tag)
+            : table{table_size, dev_tag, true}, workspace{dev_tag},
+              stream{createStream()},
+              staging{stream, sizeof(CFP_t) * table_size} {
+            PL_CUDA_IS_SUCCESS(
+                cudaEventCreateWithFlags(&ready, cudaEventDisableTiming));
+            PL_CUDA_IS_SUCCESS(
+                cudaEventCreateWithFlags(&done, cudaEventDisableTiming));
+        }
+        TapeGraph(const TapeGraph &) = delete;
+        TapeGraph &operator=(const TapeGraph &) = delete;
+        ~TapeGraph() {
+            if (exec != nullptr) {
+                cudaGraphExecDestroy(exec);
+            }
+            staging.release();
+            cudaEventDestroy(done);
+            cudaEventDestroy(ready);
+            cudaStreamDestroy(stream);
+        }
+
+        static auto createStream() -> cudaStream_t {
+            cudaStream_t stream_id{nullptr};
+            PL_CUDA_IS_SUCCESS(cudaStreamCreate(&stream_id));
+            return stream_id;
+        }
+
+        std::size_t plan_id{0};
+        const CFP_t *data{nullptr};
+        DataBuffer<CFP_t, int> table;
+        WorkspaceArena<int> workspace;
+        std::vector<CFP_t> host_table;
+        cudaStream_t stream{nullptr};
+        StagingPool staging;
+        cudaEvent_t ready{nullptr};
+        cudaEvent_t done{nullptr};
+        cudaGraphExec_t exec{nullptr};
+    };
+    std::unique_ptr<TapeGraph> tape_graph_;
+    struct GraphDeleter {
+        void operator()(cudaGraph_t captured) const {
+            cudaGraphDestroy(captured);
+        }
+    };
+    std::size_t num_tape_graph_captures_{0};
+
+    /**
+     * @brief Capture the gates of a plan applied to `data` into a new CUDA
+     * graph. Capturing forbids allocations, so the workspace is sized for the
+     * largest gate beforehand.
+     */
+    void captureTapeGraph(const TapeGraphPlan<Precision> &plan, CFP_t *data) {
+        tape_graph_.reset();
+        auto graph = std::make_unique<TapeGraph>(
+            plan.getMatrixTableSize(), BaseType::getDevTag());
+
+        const int nIndexBits = BaseType::getNumQubits();
+        cudaDataType_t data_type;
+        custatevecComputeType_t compute_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+            compute_type = CUSTATEVEC_COMPUTE_64F;
+        } else {
+            data_type = CUDA_C_32F;
+            compute_type = CUSTATEVEC_COMPUTE_32F;
+        }
+
+        const CFP_t *table = graph->table.getData();
+        std::size_t workspace_size = 0;
+        for (const auto &node : plan.getNodes()) {
+            size_t node_workspace_size = 0;
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixGetWorkspaceSize(
+                /* custatevecHandle_t */ handle.ref(),
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ nIndexBits,
+                /* const void* */ table + node.matrix_offset,
+                /* cudaDataType_t */ data_type,
+                /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+                /* const int32_t */ node.adjoint,
+                /* const uint32_t */ node.num_tgts,
+                /* const uint32_t */ node.num_ctrls,
+                /* custatevecComputeType_t */ compute_type,
+                /* size_t* */ &node_workspace_size));
+            workspace_size = std::max(workspace_size, node_workspace_size);
+        }
+        void *workspace = graph->workspace.acquire(workspace_size);
+
+        // The handle runs on the stream of the state-vector everywhere else,
+        // so restore it before reporting any failure
+        PL_CUSTATEVEC_IS_SUCCESS(
+            custatevecSetStream(handle.ref(), graph->stream));
+        cudaError_t cuda_status = cudaStreamBeginCapture(
+            graph->stream, cudaStreamCaptureModeThreadLocal);
+        custatevecStatus_t status = CUSTATEVEC_STATUS_SUCCESS;
+        for (const auto &node : plan.getNodes()) {
+            if (cuda_status != cudaSuccess) {
+                break;
+            }
+            const int *ctrls = plan.getWires().data() + node.wire_offset;
+            status = custatevecApplyMatrix(
+                /* custatevecHandle_t */ handle.ref(),
+                /* void* */ data,
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ nIndexBits,
+                /* const void* */ table + node.matrix_offset,
+                /* cudaDataType_t */ data_type,
+                /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+                /* const int32_t */ node.adjoint,
+                /* const int32_t* */ ctrls + node.num_ctrls,
+                /* const uint32_t */ node.num_tgts,
+                /* const int32_t* */ ctrls,
+                /* const int32_t* */ nullptr,
+                /* const uint32_t */ node.num_ctrls,
+                /* custatevecComputeType_t */ compute_type,
+                /* void* */ workspace,
+                /* size_t */ workspace_size);
+            if (status != CUSTATEVEC_STATUS_SUCCESS) {
+                break;
+            }
+        }
+        cudaGraph_t captured{nullptr};
+        if (cuda_status == cudaSuccess) {
+            cuda_status = cudaStreamEndCapture(graph->stream, &captured);
+        }
+        // Destroyed on every path, including the failures reported below
+        const std::unique_ptr<std::remove_pointer_t<cudaGraph_t>, GraphDeleter>
+            captured_graph{captured};
+        const custatevecStatus_t restore_status = custatevecSetStream(
+            handle.ref(), BaseType::getDevTag().getStreamID());
+        PL_CUSTATEVEC_IS_SUCCESS(restore_status);
+        PL_CUSTATEVEC_IS_SUCCESS(status);
+        PL_CUDA_IS_SUCCESS(cuda_status);
+
+        cuda_status = cudaGraphInstantiateWithFlags(&graph->exec,
+                                                    captured_graph.get(), 0);
+        PL_CUDA_IS_SUCCESS(cuda_status);
+
+        graph->plan_id = plan.getId();
+        graph->data = data;
+        tape_graph_ = std::move(graph);
+        num_tape_graph_captures_++;
+    }
+
+    /**
+     * @brief Get a sampler of the current state, able to draw `num_samples`
+     * samples per call. The sampler of a previous call is reused as long as
+     * the state is unchanged, which skips the prefix sum over the whole
+     * state-vector made by the preprocessing.
+     */
+    auto prepareSampler(size_t num_samples) -> custatevecSamplerDescriptor_t {
+        const std::size_t version = BaseType::getStateVersion();
+        if (sampler_ && sampler_version_ == version &&
+            num_samples <= sampler_max_shots_) {
+            return sampler_.get();
+        }
+        sampler_.reset();
+
+        cudaDataType_t data_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        custatevecSamplerDescriptor_t sampler;
+        size_t extraWorkspaceSizeInBytes = 0;
+        // create sampler and check the size of external workspace
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
+            handle.ref(), std::as_const(*this).getData(), data_type,
+            BaseType::getNumQubits(), &sampler, num_samples,
+            &extraWorkspaceSizeInBytes));
+        sampler_.reset(sampler);
+
+        void *extraWorkspace =
+            sampler_workspace_.acquire(extraWorkspaceSizeInBytes);
+
+        // sample preprocess
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
+            handle.ref(), sampler, extraWorkspace, extraWorkspaceSizeInBytes));
+
+        sampler_version_ = version;
+        sampler_max_shots_ = num_samples;
+        num_sampler_preprocesses_++;
+        return sampler;
+    }
 
     const std::unordered_map<std::string, custatevecPauli_t> native_gates_{
         {"RX", CUSTATEVEC_PAULI_X},       {"RY", CUSTATEVEC_PAULI_Y},
@@ -1317,6 +2004,382 @@ class StateVectorCudaManaged
         return t_indices;
     }
 
+    /**
+     * @brief Look up the device matrices of the fixed gates dispatched by
+     * `applyTapeOperation`, so that applying a tape does not hash gate names.
+     */
+    void initTapeGates() {
+        static const Precision param = 0.0;
+        tape_gates_.pauli_x = gate_cache_.get_gate_device_ptr("PauliX", param);
+        tape_gates_.pauli_y = gate_cache_.get_gate_device_ptr("PauliY", param);
+        tape_gates_.hadamard =
+            gate_cache_.get_gate_device_ptr("Hadamard", param);
+        tape_gates_.swap = gate_cache_.get_gate_device_ptr("SWAP", param);
+    }
+
+    /**
+     * @brief Get the expectation value of each of a list of Pauli words.
+     *
+     * @param pauli_words Vector of Pauli-words to evaluate expectation value.
+     * @param tgts Coupled qubit index to apply each Pauli term.
+     * @return std::vector<double> Expectation value of each word.
+     */
+    auto getPauliWordExpectations(
+        const std::vector<std::string> &pauli_words,
+        const std::vector<std::vector<std::size_t>> &tgts)
+        -> std::vector<double> {
+        uint32_t nIndexBits = static_cast<uint32_t>(BaseType::getNumQubits());
+        cudaDataType_t data_type;
+
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        // Note: due to API design, cuStateVec assumes this is always a double.
+        // Push NVIDIA to move this to behind API for future releases, and
+        // support 32/64 bits.
+        std::vector<double> expect(pauli_words.size());
+
+        std::vector<std::vector<custatevecPauli_t>> pauliOps;
+
+        std::vector<custatevecPauli_t *> pauliOps_ptr;
+
+        for (auto &p_word : pauli_words) {
+            pauliOps.push_back(cuUtil::pauliStringToEnum(p_word));
+            pauliOps_ptr.push_back((*pauliOps.rbegin()).data());
+        }
+
+        std::vector<std::vector<int32_t>> basisBits;
+        std::vector<int32_t *> basisBits_ptr;
+        std::vector<uint32_t> n_basisBits;
+
+        for (auto &wires : tgts) {
+            std::vector<int32_t> wiresInt(wires.size());
+            std::transform(wires.begin(), wires.end(), wiresInt.begin(),
+                           [&](std::size_t x) {
+                               return static_cast<int>(
+                                   BaseType::getNumQubits() - 1 - x);
+                           });
+            basisBits.push_back(wiresInt);
+            basisBits_ptr.push_back((*basisBits.rbegin()).data());
+            n_basisBits.push_back(wiresInt.size());
+        }
+
+        // compute expectation
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationsOnPauliBasis(
+            /* custatevecHandle_t */ handle.ref(),
+            /* const void* */ std::as_const(*this).getData(),
+            /* cudaDataType_t */ data_type,
+            /* const uint32_t */ nIndexBits,
+            /* double* */ expect.data(),
+            /* const custatevecPauli_t ** */
+            const_cast<const custatevecPauli_t **>(pauliOps_ptr.data()),
+            /* const uint32_t */ static_cast<uint32_t>(pauliOps.size()),
+            /* const int32_t ** */
+            const_cast<const int32_t **>(basisBits_ptr.data()),
+            /* const uint32_t */ n_basisBits.data()));
+
+        return expect;
+    }
+
+    /**
+     * @brief Sum expectation values of Pauli words weighted by their
+     * coefficients.
+     */
+    auto sumPauliWordExpectations(const std::vector<double> &expect,
+                                  const std::complex<Precision> *coeffs)
+        -> Precision {
+        std::complex<Precision> result{0, 0};
+        for (std::size_t idx = 0; idx < expect.size(); idx++) {
+            result += static_cast<Precision>(expect[idx]) * coeffs[idx];
+        }
+        return std::real(result);
+    }
+
+    /**
+     * @brief Get the matrix rotating the eigenbasis of a Pauli operator into
+     * the computational basis, as its PennyLane diagonalizing gates.
+     *
+     * @param basis 'X' or 'Y'.
+     */
+    static auto getBasisRotation(char basis) -> std::vector<CFP_t> {
+        if (basis == 'X') {
+            return cuGates::getHadamard<CFP_t>();
+        }
+        // Hadamard S^\dagger
+        const CFP_t r = cuUtil::INVSQRT2<CFP_t>();
+        const CFP_t ri = cuUtil::ConstMultSC(
+            Pennylane::Util::INVSQRT2<Precision>(), cuUtil::IMAG<CFP_t>());
+        return {r, -ri, r, ri};
+    }
+
+    /**
+     * @brief Compute H|psi> into the accumulator, leaving the state-vector
+     * unchanged.
+     *
+     * @param matrix Sparse matrix H, of the state-vector dimension.
+     * @return const CFP_t* Device pointer to H|psi>, valid until the next use
+     * of the accumulator.
+     */
+    template <class index_type>
+    auto applySparseMatrixToScratch(
+        const CSRMatrixGPU<Precision, index_type> &matrix) -> const CFP_t * {
+        PL_ABORT_IF_NOT(matrix.getNumRows() == BaseType::getLength(),
+                        "Sparse matrix size does not match state-vector size");
+        CFP_t *h_sv = getAccumulator().getData();
+        matrix.SpMV(std::as_const(*this).getData(), h_sv,
+                    BaseType::getDevTag());
+        return h_sv;
+    }
+
+    /**
+     * @brief Check whether a gate of a tape may be merged with its neighbours
+     * by the multi-op `applyOperation`: any named gate within the fused block
+     * size when fusion is enabled, and diagonal gates otherwise.
+     */
+    [[nodiscard]] auto
+    isFoldable(const typename GateTape<Precision>::Op &op) const -> bool {
+        static const auto is_diagonal = [] {
+            std::array<bool, static_cast<std::size_t>(GateOp::Matrix) + 1>
+                result{};
+            for (std::size_t i = 0; i < result.size(); i++) {
+                result[i] = DiagonalFusion<Precision>::isDiagonal(
+                    getGateOpName(static_cast<GateOp>(i)));
+            }
+            return result;
+        }();
+        const std::size_t num_wires = op.num_ctrls + op.num_tgts;
+        if (max_fused_wires_ > 0) {
+            return op.opcode != GateOp::Matrix && num_wires <= max_fused_wires_;
+        }
+        return is_diagonal[static_cast<std::size_t>(op.opcode)] &&
+               num_wires <= max_diagonal_wires_;
+    }
+
+    /**
+     * @brief Apply a sequence of gates, fusing consecutive gates with known
+     * host matrices into blocks of at most `max_fused_wires_` wires. Blocks
+     * holding a single gate, and gates that cannot be fused, are dispatched
+     * through the regular `applyOperation` path.
+     *
+     * @param opNames Names of gates to apply.
+     * @param wires Wires of each gate.
+     * @param adjoints Indicates whether to use the adjoint of each gate.
+     * @param params Parameters of each gate.
+     */
+    void
+    applyOperationsFused(const std::vector<std::string> &opNames,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &adjoints,
+                         const std::vector<std::vector<Precision>> &params) {
+        const auto num_ops = opNames.size();
+        GateFusion<Precision> fusion(max_fused_wires_);
+        std::size_t block_start = 0;
+
+        const auto flush = [&](std::size_t next_op) {
+            if (fusion.getNumGates() == 1) {
+                applyOperation(opNames[block_start], wires[block_start],
+                               adjoints[block_start], params[block_start]);
+            } else if (!fusion.empty()) {
+                const auto &fused_matrix = fusion.getMatrix();
+                const auto &fused_wires = fusion.getWires();
+                const std::size_t dim =
+                    Pennylane::Util::exp2(fused_wires.size());
+                std::vector<std::complex<Precision>> diagonal(dim);
+                bool is_diagonal = true;
+                for (std::size_t i = 0; i < dim * dim && is_diagonal; i++) {
+                    if (i % (dim + 1) == 0) {
+                        diagonal[i / (dim + 1)] = fused_matrix[i];
+                    } else {
+                        is_diagonal = (fused_matrix[i] ==
+                                       std::complex<Precision>{0, 0});
+                    }
+                }
+                if (is_diagonal) {
+                    applyDiagonalGate(diagonal, {}, fused_wires);
+                    fusion.clear();
+                    block_start = next_op;
+                    return;
+                }
+                applyHostMatrixGate(fused_matrix, {},
+                                    {fused_wires.rbegin(), fused_wires.rend()},
+                                    false);
+            }
+            fusion.clear();
+            block_start = next_op;
+        };
+
+        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            std::vector<std::complex<Precision>> matrix;
+            if (wires[op_idx].size() <= max_fused_wires_) {
+                matrix = GateFusion<Precision>::getGateMatrix(
+                    opNames[op_idx], wires[op_idx].size(), params[op_idx],
+                    adjoints[op_idx]);
+            }
+            if (matrix.empty()) {
+                flush(op_idx);
+                applyOperation(opNames[op_idx], wires[op_idx],
+                               adjoints[op_idx], params[op_idx]);
+                block_start = op_idx + 1;
+            } else if (!fusion.tryFuse(matrix, wires[op_idx])) {
+                flush(op_idx);
+                fusion.tryFuse(matrix, wires[op_idx]);
+            }
+        }
+        flush(num_ops);
+    }
+
+    /**
+     * @brief Apply a sequence of gates, folding each run of consecutive
+     * diagonal gates acting on at most `max_diagonal_wires_` wires into a
+     * single diagonal. Runs holding a single gate, and non-diagonal gates, are
+     * dispatched through the regular `applyOperation` path.
+     *
+     * @param opNames Names of gates to apply.
+     * @param wires Wires of each gate.
+     * @param adjoints Indicates whether to use the adjoint of each gate.
+     * @param params Parameters of each gate.
+     */
+    void applyOperationsDiagonalFolded(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<Precision>> &params) {
+        const auto num_ops = opNames.size();
+        DiagonalFusion<Precision> folded(max_diagonal_wires_);
+        std::size_t run_start = 0;
+
+        const auto flush = [&](std::size_t next_op) {
+            if (folded.getNumGates() == 1) {
+                applyOperation(opNames[run_start], wires[run_start],
+                               adjoints[run_start], params[run_start]);
+            } else if (!folded.empty()) {
+                applyDiagonalGate(folded.getDiagonal(), {}, folded.getWires());
+            }
+            folded.clear();
+            run_start = next_op;
+        };
+
+        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            std::vector<std::complex<Precision>> diagonal;
+            if (wires[op_idx].size() <= max_diagonal_wires_) {
+                diagonal = DiagonalFusion<Precision>::getGateDiagonal(
+                    opNames[op_idx], wires[op_idx].size(), params[op_idx],
+                    adjoints[op_idx]);
+            }
+            if (diagonal.empty()) {
+                flush(op_idx);
+                applyOperation(opNames[op_idx], wires[op_idx],
+                               adjoints[op_idx], params[op_idx]);
+                run_start = op_idx + 1;
+            } else if (!folded.tryFuse(diagonal, wires[op_idx])) {
+                flush(op_idx);
+                folded.tryFuse(diagonal, wires[op_idx]);
+            }
+        }
+        flush(num_ops);
+    }
+
+    /**
+     * @brief Apply a diagonal gate using the custatevec generalized
+     * permutation matrix API, avoiding any dense matrix.
+     *
+     * @param diagonal Host diagonal of the gate over `tgts`.
+     * @param ctrls Control line qubits.
+     * @param tgts Target qubits, with `tgts[0]` the most significant bit of
+     * the diagonal index.
+     */
+    void applyDiagonalGate(const std::vector<std::complex<Precision>> &diagonal,
+                           const std::vector<std::size_t> &ctrls,
+                           const std::vector<std::size_t> &tgts) {
+        std::vector<int> ctrlsInt(ctrls.size());
+        std::vector<int> tgtsInt(tgts.size());
+
+        // Transform indices between PL & cuQuantum ordering
+        std::transform(
+            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
+                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
+            });
+        std::transform(
+            tgts.rbegin(), tgts.rend(), tgtsInt.begin(), [&](std::size_t x) {
+                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
+            });
+
+        std::vector<CFP_t> diagonal_cu(diagonal.size());
+        std::transform(diagonal.begin(), diagonal.end(), diagonal_cu.begin(),
+                       [](const std::complex<Precision> &x) {
+                           return cuUtil::complexToCu<std::complex<Precision>>(
+                               x);
+                       });
+
+        applyDiagonalGate(diagonal_cu.data(), ctrlsInt.data(), ctrlsInt.size(),
+                          tgtsInt.data(), tgtsInt.size());
+    }
+
+    /**
+     * @brief Apply a diagonal gate given custatevec qubit indices.
+     *
+     * @param diagonal Host diagonal of the gate over `tgts`.
+     * @param ctrls Control qubit indices.
+     * @param num_ctrls Number of control qubits.
+     * @param tgts Target qubit indices, with `tgts[0]` the least significant
+     * bit of the diagonal index.
+     * @param num_tgts Number of target qubits.
+     */
+    void applyDiagonalGate(const CFP_t *diagonal, const int *ctrls,
+                           std::size_t num_ctrls, const int *tgts,
+                           std::size_t num_tgts) {
+        size_t extraWorkspaceSizeInBytes = 0;
+        int nIndexBits = BaseType::getNumQubits();
+
+        cudaDataType_t data_type;
+
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        // check the size of external workspace
+        PL_CUSTATEVEC_IS_SUCCESS(
+            custatevecApplyGeneralizedPermutationMatrixGetWorkspaceSize(
+                /* custatevecHandle_t */ handle.ref(),
+                /* cudaDataType_t */ data_type,
+                /* const uint32_t */ nIndexBits,
+                /* const custatevecIndex_t* */ nullptr,
+                /* const void* */ diagonal,
+                /* cudaDataType_t */ data_type,
+                /* const int32_t* */ tgts,
+                /* const uint32_t */ num_tgts,
+                /* const uint32_t */ num_ctrls,
+                /* size_t* */ &extraWorkspaceSizeInBytes));
+
+        // reuse the persistent external workspace
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
+
+        // apply gate
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyGeneralizedPermutationMatrix(
+            /* custatevecHandle_t */ handle.ref(),
+            /* void* */ BaseType::getData(),
+            /* cudaDataType_t */ data_type,
+            /* const uint32_t */ nIndexBits,
+            /* custatevecIndex_t* */ nullptr,
+            /* const void* */ diagonal,
+            /* cudaDataType_t */ data_type,
+            /* const int32_t */ 0,
+            /* const int32_t* */ tgts,
+            /* const uint32_t */ num_tgts,
+            /* const int32_t* */ ctrls,
+            /* const int32_t* */ nullptr,
+            /* const uint32_t */ num_ctrls,
+            /* void* */ extraWorkspace,
+            /* size_t */ extraWorkspaceSizeInBytes));
+    }
+
     /**
      * @brief Apply parametric Pauli gates using custateVec calls.
      *
@@ -1330,8 +2393,6 @@ class StateVectorCudaManaged
                                   std::vector<std::size_t> ctrls,
                                   std::vector<std::size_t> tgts,
                                   Precision param, bool use_adjoint = false) {
-        int nIndexBits = BaseType::getNumQubits();
-
         std::vector<int> ctrlsInt(ctrls.size());
         std::vector<int> tgtsInt(tgts.size());
 
@@ -1345,6 +2406,34 @@ class StateVectorCudaManaged
                 return static_cast<int>(BaseType::getNumQubits() - 1 - x);
             });
 
+        std::vector<custatevecPauli_t> pauli_enums;
+        pauli_enums.reserve(pauli_words.size());
+        for (const auto &pauli_str : pauli_words) {
+            pauli_enums.push_back(native_gates_.at(pauli_str));
+        }
+
+        applyParametricPauliGate(pauli_enums.data(), ctrlsInt.data(),
+                                 ctrlsInt.size(), tgtsInt.data(),
+                                 tgtsInt.size(), param, use_adjoint);
+    }
+
+    /**
+     * @brief Apply parametric Pauli gates given custatevec qubit indices.
+     *
+     * @param paulis Pauli operator acting on each target.
+     * @param ctrls Control qubit indices.
+     * @param num_ctrls Number of control qubits.
+     * @param tgts Target qubit indices.
+     * @param num_tgts Number of target qubits.
+     * @param param Rotation angle.
+     * @param use_adjoint Take adjoint of operation.
+     */
+    void applyParametricPauliGate(const custatevecPauli_t *paulis,
+                                  const int *ctrls, std::size_t num_ctrls,
+                                  const int *tgts, std::size_t num_tgts,
+                                  Precision param, bool use_adjoint = false) {
+        int nIndexBits = BaseType::getNumQubits();
+
         cudaDataType_t data_type;
 
         if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
@@ -1354,11 +2443,6 @@ class StateVectorCudaManaged
             data_type = CUDA_C_32F;
         }
 
-        std::vector<custatevecPauli_t> pauli_enums;
-        pauli_enums.reserve(pauli_words.size());
-        for (const auto &pauli_str : pauli_words) {
-            pauli_enums.push_back(native_gates_.at(pauli_str));
-        }
         const auto local_angle = (use_adjoint) ? param / 2 : -param / 2;
 
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyPauliRotation(
@@ -1367,12 +2451,12 @@ class StateVectorCudaManaged
             /* cudaDataType_t */ data_type,
             /* const uint32_t */ nIndexBits,
             /* double */ local_angle,
-            /* const custatevecPauli_t* */ pauli_enums.data(),
-            /* const int32_t* */ tgtsInt.data(),
-            /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrlsInt.data(),
+            /* const custatevecPauli_t* */ paulis,
+            /* const int32_t* */ tgts,
+            /* const uint32_t */ num_tgts,
+            /* const int32_t* */ ctrls,
             /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size()));
+            /* const uint32_t */ num_ctrls));
     }
 
     /**
@@ -1391,10 +2475,6 @@ class StateVectorCudaManaged
                                const std::vector<std::size_t> &ctrls,
                                const std::vector<std::size_t> &tgts,
                                bool use_adjoint = false) {
-        void *extraWorkspace = nullptr;
-        size_t extraWorkspaceSizeInBytes = 0;
-        int nIndexBits = BaseType::getNumQubits();
-
         std::vector<int> ctrlsInt(ctrls.size());
         std::vector<int> tgtsInt(tgts.size());
 
@@ -1407,6 +2487,29 @@ class StateVectorCudaManaged
                 return static_cast<int>(BaseType::getNumQubits() - 1 - x);
             });
 
+        applyDeviceMatrixGate(matrix, ctrlsInt.data(), ctrlsInt.size(),
+                              tgtsInt.data(), tgtsInt.size(), use_adjoint);
+    }
+
+    /**
+     * @brief Apply a host or device-stored gate matrix given custatevec qubit
+     * indices.
+     *
+     * @param matrix Host- or device data array in row-major order representing
+     * a given gate.
+     * @param ctrls Control qubit indices.
+     * @param num_ctrls Number of control qubits.
+     * @param tgts Target qubit indices, with `tgts[0]` the least significant
+     * bit of the matrix index.
+     * @param num_tgts Number of target qubits.
+     * @param use_adjoint Use adjoint of given gate.
+     */
+    void applyDeviceMatrixGate(const CFP_t *matrix, const int *ctrls,
+                               std::size_t num_ctrls, const int *tgts,
+                               std::size_t num_tgts, bool use_adjoint = false) {
+        size_t extraWorkspaceSizeInBytes = 0;
+        int nIndexBits = BaseType::getNumQubits();
+
         cudaDataType_t data_type;
         custatevecComputeType_t compute_type;
 
@@ -1428,16 +2531,13 @@ class StateVectorCudaManaged
             /* cudaDataType_t */ data_type,
             /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
             /* const int32_t */ use_adjoint,
-            /* const uint32_t */ tgts.size(),
-            /* const uint32_t */ ctrls.size(),
+            /* const uint32_t */ num_tgts,
+            /* const uint32_t */ num_ctrls,
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the persistent external workspace
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         // apply gate
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
@@ -1449,16 +2549,32 @@ class StateVectorCudaManaged
             /* cudaDataType_t */ data_type,
             /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
             /* const int32_t */ use_adjoint,
-            /* const int32_t* */ tgtsInt.data(),
-            /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrlsInt.data(),
+            /* const int32_t* */ tgts,
+            /* const uint32_t */ num_tgts,
+            /* const int32_t* */ ctrls,
             /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size(),
+            /* const uint32_t */ num_ctrls,
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+    }
+
+    /**
+     * @brief Upload a host matrix on the stream of the state-vector, through
+     * the pinned staging pool rather than passing the host pointer, which
+     * custatevec would copy synchronously.
+     *
+     * @param matrix Host data array.
+     * @param length Number of elements.
+     * @return const CFP_t* Device copy, valid until the next call.
+     */
+    auto stageHostMatrix(const CFP_t *matrix, std::size_t length)
+        -> const CFP_t * {
+        const std::size_t matrix_bytes = sizeof(CFP_t) * length;
+        auto *matrix_gpu =
+            static_cast<CFP_t *>(matrix_workspace_.acquire(matrix_bytes));
+        staging_.copyHostToDevice(matrix_gpu, matrix, matrix_bytes);
+        return matrix_gpu;
     }
 
     /**
@@ -1475,74 +2591,8 @@ class StateVectorCudaManaged
                              const std::vector<std::size_t> &ctrls,
                              const std::vector<std::size_t> &tgts,
                              bool use_adjoint = false) {
-        void *extraWorkspace = nullptr;
-        size_t extraWorkspaceSizeInBytes = 0;
-        int nIndexBits = BaseType::getNumQubits();
-
-        std::vector<int> ctrlsInt(ctrls.size());
-        std::vector<int> tgtsInt(tgts.size());
-
-        std::transform(
-            ctrls.begin(), ctrls.end(), ctrlsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
-        std::transform(
-            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
-
-        cudaDataType_t data_type;
-        custatevecComputeType_t compute_type;
-
-        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
-                      std::is_same_v<CFP_t, double2>) {
-            data_type = CUDA_C_64F;
-            compute_type = CUSTATEVEC_COMPUTE_64F;
-        } else {
-            data_type = CUDA_C_32F;
-            compute_type = CUSTATEVEC_COMPUTE_32F;
-        }
-
-        // check the size of external workspace
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixGetWorkspaceSize(
-            /* custatevecHandle_t */ handle.ref(),
-            /* cudaDataType_t */ data_type,
-            /* const uint32_t */ nIndexBits,
-            /* const void* */ matrix.data(),
-            /* cudaDataType_t */ data_type,
-            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
-            /* const int32_t */ use_adjoint,
-            /* const uint32_t */ tgts.size(),
-            /* const uint32_t */ ctrls.size(),
-            /* custatevecComputeType_t */ compute_type,
-            /* size_t* */ &extraWorkspaceSizeInBytes));
-
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
-
-        // apply gate
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
-            /* custatevecHandle_t */ handle.ref(),
-            /* void* */ BaseType::getData(),
-            /* cudaDataType_t */ data_type,
-            /* const uint32_t */ nIndexBits,
-            /* const void* */ matrix.data(),
-            /* cudaDataType_t */ data_type,
-            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
-            /* const int32_t */ use_adjoint,
-            /* const int32_t* */ tgtsInt.data(),
-            /* const uint32_t */ tgts.size(),
-            /* const int32_t* */ ctrlsInt.data(),
-            /* const int32_t* */ nullptr,
-            /* const uint32_t */ ctrls.size(),
-            /* custatevecComputeType_t */ compute_type,
-            /* void* */ extraWorkspace,
-            /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        applyDeviceMatrixGate(stageHostMatrix(matrix.data(), matrix.size()),
+                              ctrls, tgts, use_adjoint);
     }
     void applyHostMatrixGate(const std::vector<std::complex<Precision>> &matrix,
                              const std::vector<std::size_t> &ctrls,
@@ -1557,6 +2607,26 @@ class StateVectorCudaManaged
         applyHostMatrixGate(matrix_cu, ctrls, tgts, use_adjoint);
     }
 
+    /**
+     * @brief Apply a host matrix given custatevec qubit indices.
+     *
+     * @param matrix Host data array in row-major order of a given gate.
+     * @param length Number of elements of the matrix.
+     * @param ctrls Control qubit indices.
+     * @param num_ctrls Number of control qubits.
+     * @param tgts Target qubit indices, with `tgts[0]` the least significant
+     * bit of the matrix index.
+     * @param num_tgts Number of target qubits.
+     * @param use_adjoint Use adjoint of given gate.
+     */
+    void applyHostMatrixGate(const CFP_t *matrix, std::size_t length,
+                             const int *ctrls, std::size_t num_ctrls,
+                             const int *tgts, std::size_t num_tgts,
+                             bool use_adjoint = false) {
+        applyDeviceMatrixGate(stageHostMatrix(matrix, length), ctrls,
+                              num_ctrls, tgts, num_tgts, use_adjoint);
+    }
+
     /**
      * @brief Get expectation of a given host-defined matrix.
      *
@@ -1566,7 +2636,6 @@ class StateVectorCudaManaged
      */
     auto getExpectationValueHostMatrix(const std::vector<CFP_t> &matrix,
                                        const std::vector<std::size_t> &tgts) {
-        void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
 
         std::vector<int> tgtsInt(tgts.size());
@@ -1600,17 +2669,15 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the persistent external workspace
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
         // compute expectation
         PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectation(
             /* custatevecHandle_t */ handle.ref(),
-            /* void* */ BaseType::getData(),
+            /* const void* */ std::as_const(*this).getData(),
             /* cudaDataType_t */ data_type,
             /* const uint32_t */ nIndexBits,
             /* void* */ &expect,
@@ -1624,8 +2691,6 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
 
@@ -1638,7 +2703,6 @@ class StateVectorCudaManaged
      */
     auto getExpectationValueDeviceMatrix(const CFP_t *matrix,
                                          const std::vector<std::size_t> &tgts) {
-        void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
 
         std::vector<int> tgtsInt(tgts.size());
@@ -1672,17 +2736,15 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse the persistent external workspace
+        void *extraWorkspace = workspace_.acquire(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
         // compute expectation
         PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectation(
             /* custatevecHandle_t */ handle.ref(),
-            /* void* */ BaseType::getData(),
+            /* const void* */ std::as_const(*this).getData(),
             /* cudaDataType_t */ data_type,
             /* const uint32_t */ nIndexBits,
             /* void* */ &expect,
@@ -1697,8 +2759,6 @@ class StateVectorCudaManaged
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
 };
@@ -0,0 +1,330 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorCudaMultiDevice.hpp
+ * State-vector sharded across the local GPU devices.
+ */
+#pragma once
+
+#include <bit>
+#include <complex>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cuda.h>
+#include <custatevec.h> // custatevecMultiDeviceSwapIndexBits
+
+#include "DevTag.hpp"
+#include "DevicePool.hpp"
+#include "Error.hpp"
+#include "ShardLayout.hpp"
+#include "StateVectorCudaManaged.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+using namespace Pennylane::CUDA;
+} // namespace
+/// @endcond
+
+namespace Pennylane {
+
+/**
+ * @brief State-vector whose amplitudes are split into equal shards, one per
+ * local GPU device.
+ *
+ * Each shard is a StateVectorCudaManaged over the local qubits, living on its
+ * own device. Gates are applied by every shard at once after the index bits of
+ * their qubits have been made local, by swapping them with local index bits
+ * across devices through custatevecMultiDeviceSwapIndexBits. The placement of
+ * the index bits is tracked by a ShardLayout, so the logical ordering of the
+ * amplitudes is only restored when gathering them on the host.
+ *
+ * @tparam Precision Floating-point precision type.
+ */
+template <class Precision> class StateVectorCudaMultiDevice {
+  public:
+    using ShardType = StateVectorCudaManaged<Precision>;
+    using CFP_t = typename ShardType::CFP_t;
+
+    /**
+     * @brief Create a sharded state-vector in the |0...0> state.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_devices Number of devices to shard over, rounded down to a
+     * power of 2. Devices 0 to num_devices - 1 are used.
+     */
+    explicit StateVectorCudaMultiDevice(
+        std::size_t num_qubits,
+        std::size_t num_devices = DevicePool<int>::getTotalDevices())
+        : layout_{num_qubits, std::bit_floor(num_devices)} {
+        PL_ABORT_IF(num_devices == 0, "No GPU device available.");
+        const DeviceGuard guard;
+        enablePeerAccess();
+
+        const std::size_t num_shards = layout_.getNumShards();
+        shards_.reserve(num_shards);
+        for (std::size_t d = 0; d < num_shards; d++) {
+            const int dev_id = static_cast<int>(d);
+            // The shard's cuStateVec handle binds to the current device
+            DevicePool<int>::setDeviceIdx(dev_id);
+            shards_.push_back(std::make_unique<ShardType>(
+                layout_.getNumLocalQubits(), DevTag<int>{dev_id, 0}));
+            if (d > 0) {
+                shards_.back()->getDataBuffer().zeroInit();
+            }
+        }
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return layout_.getNumQubits();
+    }
+    [[nodiscard]] auto getNumShards() const -> std::size_t {
+        return shards_.size();
+    }
+    [[nodiscard]] auto getLayout() const -> const ShardLayout & {
+        return layout_;
+    }
+
+    /**
+     * @brief Get the shard living on a device. Its amplitudes follow the
+     * current layout, not the logical ordering.
+     */
+    [[nodiscard]] auto getShard(std::size_t shard) -> ShardType & {
+        return *shards_.at(shard);
+    }
+
+    /**
+     * @brief Apply a single gate to the state-vector, first swapping the
+     * index bits of its wires into the shards when needed.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param adjoint Indicates whether to use adjoint of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<std::size_t> &wires,
+                        bool adjoint = false,
+                        const std::vector<Precision> &params = {0.0}) {
+        const auto bits = wiresToBits(wires);
+        swapIndexBits(layout_.localize(bits));
+        const auto local_wires = layout_.getLocalWires(bits);
+
+        const DeviceGuard guard;
+        for (std::size_t d = 0; d < shards_.size(); d++) {
+            DevicePool<int>::setDeviceIdx(static_cast<int>(d));
+            shards_[d]->applyOperation(opName, local_wires, adjoint, params);
+        }
+    }
+
+    /**
+     * @brief Apply multiple gates to the state-vector.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param wires Vector of wires on which to apply index-matched gate name.
+     * @param adjoints Indicates whether gate at matched index is to be
+     * inverted.
+     * @param params Optional parameter data for index matched gates.
+     */
+    void applyOperation(const std::vector<std::string> &ops,
+                        const std::vector<std::vector<std::size_t>> &wires,
+                        const std::vector<bool> &adjoints,
+                        const std::vector<std::vector<Precision>> &params) {
+        PL_ABORT_IF(ops.size() != wires.size() || ops.size() != params.size() ||
+                        ops.size() != adjoints.size(),
+                    "Invalid arguments: number of operations, wires, inverses, "
+                    "and parameters must all be equal");
+        for (std::size_t i = 0; i < ops.size(); i++) {
+            applyOperation(ops[i], wires[i], adjoints[i], params[i]);
+        }
+    }
+
+    /**
+     * @brief Probabilities of the computational basis states of given wires,
+     * reduced over all shards.
+     *
+     * @param wires List of wires to return probabilities for in lexicographical
+     * order.
+     * @return std::vector<double>
+     */
+    auto probability(const std::vector<std::size_t> &wires)
+        -> std::vector<double> {
+        const auto bits = wiresToBits(wires);
+        const auto local_wires = layout_.getLocalWires(bits);
+
+        const DeviceGuard guard;
+        std::vector<std::vector<double>> shard_probs(shards_.size());
+        for (std::size_t d = 0; d < shards_.size(); d++) {
+            DevicePool<int>::setDeviceIdx(static_cast<int>(d));
+            if (local_wires.empty()) {
+                // Only the norm of the shard contributes
+                const auto probs = shards_[d]->probability({0});
+                shard_probs[d] = {probs[0] + probs[1]};
+            } else {
+                shard_probs[d] = shards_[d]->probability(local_wires);
+            }
+        }
+        return layout_.reduceProbabilities(bits, shard_probs);
+    }
+
+    /**
+     * @brief Gather the amplitudes of all shards on the host, in the logical
+     * ordering.
+     */
+    auto getDataVector() -> std::vector<std::complex<Precision>> {
+        const std::size_t shard_length =
+            std::size_t{1} << layout_.getNumLocalQubits();
+        std::vector<std::vector<std::complex<Precision>>> host_shards(
+            shards_.size(),
+            std::vector<std::complex<Precision>>(shard_length));
+        {
+            const DeviceGuard guard;
+            for (std::size_t d = 0; d < shards_.size(); d++) {
+                DevicePool<int>::setDeviceIdx(static_cast<int>(d));
+                shards_[d]->CopyGpuDataToHost(host_shards[d].data(),
+                                              shard_length);
+            }
+        }
+        std::vector<std::complex<Precision>> data(
+            std::size_t{1} << layout_.getNumQubits());
+        for (std::size_t i = 0; i < data.size(); i++) {
+            const auto [shard, offset] = layout_.locate(i);
+            data[i] = host_shards[shard][offset];
+        }
+        return data;
+    }
+
+  private:
+    /// Restores the current device of the calling thread on scope exit.
+    class DeviceGuard {
+      public:
+        DeviceGuard() { PL_CUDA_IS_SUCCESS(cudaGetDevice(&dev_id_)); }
+        DeviceGuard(const DeviceGuard &) = delete;
+        DeviceGuard &operator=(const DeviceGuard &) = delete;
+        ~DeviceGuard() { cudaSetDevice(dev_id_); }
+
+      private:
+        int dev_id_{0};
+    };
+
+    ShardLayout layout_;
+    std::vector<std::unique_ptr<ShardType>> shards_;
+
+    /**
+     * @brief Map wires, wire 0 being the most significant qubit, to logical
+     * index bits.
+     */
+    [[nodiscard]] auto wiresToBits(const std::vector<std::size_t> &wires) const
+        -> std::vector<std::size_t> {
+        const std::size_t num_qubits = layout_.getNumQubits();
+        std::vector<std::size_t> bits(wires.size());
+        for (std::size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits, "Invalid wire index.");
+            bits[i] = num_qubits - 1 - wires[i];
+        }
+        return bits;
+    }
+
+    /**
+     * @brief Allow every device to access the memory of the others, as
+     * required by the index bit swaps over a switch network.
+     */
+    void enablePeerAccess() {
+        const int num_devices =
+            static_cast<int>(std::size_t{1} << layout_.getNumGlobalQubits());
+        for (int d = 0; d < num_devices; d++) {
+            DevicePool<int>::setDeviceIdx(d);
+            for (int peer = 0; peer < num_devices; peer++) {
+                if (peer == d) {
+                    continue;
+                }
+                int can_access = 0;
+                PL_CUDA_IS_SUCCESS(
+                    cudaDeviceCanAccessPeer(&can_access, d, peer));
+                PL_ABORT_IF_NOT(can_access,
+                                "Sharding requires peer access between all "
+                                "devices.");
+                const auto err = cudaDeviceEnablePeerAccess(peer, 0);
+                if (err == cudaErrorPeerAccessAlreadyEnabled) {
+                    // Clear the sticky error left by the call
+                    cudaGetLastError();
+                } else {
+                    PL_CUDA_IS_SUCCESS(err);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Swap local and global index bits across all shards.
+     *
+     * @param swaps Disjoint (local, global) pairs of physical index bits.
+     */
+    void swapIndexBits(const std::vector<ShardLayout::BitSwap> &swaps) {
+        if (swaps.empty()) {
+            return;
+        }
+        const DeviceGuard guard;
+        std::vector<custatevecHandle_t> handles(shards_.size());
+        std::vector<void *> sub_svs(shards_.size());
+        for (std::size_t d = 0; d < shards_.size(); d++) {
+            handles[d] = shards_[d]->getCusvHandle();
+            sub_svs[d] = shards_[d]->getData();
+            // Gates still queued on the shard must complete first
+            DevicePool<int>::setDeviceIdx(static_cast<int>(d));
+            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        }
+
+        std::vector<int2> bit_swaps(swaps.size());
+        for (std::size_t i = 0; i < swaps.size(); i++) {
+            bit_swaps[i].x = static_cast<int>(swaps[i].first);
+            bit_swaps[i].y = static_cast<int>(swaps[i].second);
+        }
+
+        cudaDataType_t data_type;
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            data_type = CUDA_C_64F;
+        } else {
+            data_type = CUDA_C_32F;
+        }
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecMultiDeviceSwapIndexBits(
+            /* custatevecHandle_t* */ handles.data(),
+            /* const uint32_t */ static_cast<uint32_t>(handles.size()),
+            /* void** */ sub_svs.data(),
+            /* const cudaDataType_t */ data_type,
+            /* const uint32_t */
+            static_cast<uint32_t>(layout_.getNumGlobalQubits()),
+            /* const uint32_t */
+            static_cast<uint32_t>(layout_.getNumLocalQubits()),
+            /* const int2* */ bit_swaps.data(),
+            /* const uint32_t */ static_cast<uint32_t>(bit_swaps.size()),
+            /* const int32_t* maskBitString */ nullptr,
+            /* const int32_t* maskOrdering */ nullptr,
+            /* const uint32_t maskLen */ 0,
+            /* custatevecDeviceNetworkType_t */
+            CUSTATEVEC_DEVICE_NETWORK_TYPE_SWITCH));
+
+        for (std::size_t d = 0; d < shards_.size(); d++) {
+            DevicePool<int>::setDeviceIdx(static_cast<int>(d));
+            PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+        }
+    }
+};
+
+} // namespace Pennylane
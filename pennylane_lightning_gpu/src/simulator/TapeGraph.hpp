@@ -0,0 +1,276 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file TapeGraph.hpp
+ * Host-side layout of a gate tape captured into a CUDA graph.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Error.hpp"
+#include "GateTape.hpp"
+#include "Util.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Layout of a gate tape applied as a fixed sequence of dense matrix
+ * gates, as required to capture the tape into a CUDA graph.
+ *
+ * A captured graph replays its kernels with the arguments recorded at capture
+ * time, so parameters cannot be passed as scalars. Every gate of the tape is
+ * therefore applied as a matrix read from a slot of a device matrix table,
+ * whose layout is fixed by the plan. Replaying the tape with new parameters
+ * only rewrites the table with `fillMatrixTable` and launches the graph.
+ * Each gate reads the same wires and applies the same unitary as
+ * `StateVectorCudaManaged::applyTapeOperation`.
+ *
+ * @tparam PrecisionT Floating point precision of the parameters.
+ */
+template <class PrecisionT> class TapeGraphPlan {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = typename GateTape<PrecisionT>::CFP_t;
+
+    /// Largest number of target wires of a gate applied as a dense matrix.
+    static constexpr std::size_t max_target_wires = 6;
+
+    /**
+     * @brief A single matrix gate of the graph.
+     */
+    struct Node {
+        /// Index of the gate in the tape
+        std::size_t op_idx;
+        bool adjoint;
+        std::uint32_t num_ctrls;
+        std::uint32_t num_tgts;
+        /// Offset of the control wires, followed by the targets
+        std::size_t wire_offset;
+        /// Offset of the row-major matrix in the matrix table
+        std::size_t matrix_offset;
+    };
+
+    /**
+     * @brief Lay out the gates of a tape. Identity gates are skipped.
+     *
+     * @param tape Gate tape to capture.
+     */
+    explicit TapeGraphPlan(const GateTape<PrecisionT> &tape)
+        : id_{next_id_++}, num_qubits_{tape.getNumQubits()},
+          num_tape_ops_{tape.getNumOps()}, wires_{tape.getWires()} {
+        const auto &ops = tape.getOps();
+        for (std::size_t op_idx = 0; op_idx < ops.size(); op_idx++) {
+            const auto &op = ops[op_idx];
+            if (op.opcode == GateOp::Identity) {
+                continue;
+            }
+            PL_ABORT_IF(op.num_tgts > max_target_wires,
+                        "Graph capture supports gates on at most 6 target "
+                        "wires");
+            nodes_.push_back({op_idx, op.adjoint, op.num_ctrls, op.num_tgts,
+                              op.wire_offset, matrix_table_size_});
+            matrix_table_size_ += Pennylane::Util::exp2(2 * op.num_tgts);
+        }
+    }
+
+    /**
+     * @brief Write the matrices of all gates for the current parameters of a
+     * tape into a host matrix table.
+     *
+     * @param tape Gate tape the plan was built from, or a tape with the same
+     * gates and wires.
+     * @param table Matrix table, resized to `getMatrixTableSize()`.
+     */
+    void fillMatrixTable(const GateTape<PrecisionT> &tape,
+                         std::vector<CFP_t> &table) const {
+        PL_ABORT_IF(tape.getNumOps() != num_tape_ops_ ||
+                        tape.getNumQubits() != num_qubits_,
+                    "Gate tape does not match the graph plan");
+        table.resize(matrix_table_size_);
+        for (const auto &node : nodes_) {
+            const auto &op = tape.getOps()[node.op_idx];
+            const auto matrix = getOpMatrix(tape, op);
+            std::copy(matrix.begin(), matrix.end(),
+                      table.begin() + node.matrix_offset);
+        }
+    }
+
+    /**
+     * @brief Get the identifier of the plan, shared by its copies only.
+     */
+    [[nodiscard]] auto getId() const -> std::size_t { return id_; }
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    [[nodiscard]] auto getNodes() const -> const std::vector<Node> & {
+        return nodes_;
+    }
+    /// cuStateVec index bits of the gates, addressed by `Node::wire_offset`.
+    [[nodiscard]] auto getWires() const -> const std::vector<std::int32_t> & {
+        return wires_;
+    }
+    /// Number of complex entries of the matrix table.
+    [[nodiscard]] auto getMatrixTableSize() const -> std::size_t {
+        return matrix_table_size_;
+    }
+
+  private:
+    inline static std::atomic<std::size_t> next_id_{0};
+
+    std::size_t id_;
+    std::size_t num_qubits_;
+    std::size_t num_tape_ops_;
+    std::vector<std::int32_t> wires_;
+    std::vector<Node> nodes_;
+    std::size_t matrix_table_size_{0};
+
+    /**
+     * @brief Row-major matrix of `exp(-i param / 2 P)`, where `P` applies the
+     * Pauli operator to each of `num_tgts` wires.
+     */
+    static auto getPauliRotation(char pauli, std::size_t num_tgts,
+                                 PrecisionT param) -> std::vector<ComplexT> {
+        const std::size_t dim = Pennylane::Util::exp2(num_tgts);
+        const std::size_t all = dim - 1;
+        const ComplexT c{std::cos(param / 2), 0};
+        const ComplexT neg_is{0, -std::sin(param / 2)};
+        // i^num_tgts, the phase of the Y factors
+        ComplexT y_phase{1, 0};
+        for (std::size_t k = 0; k < num_tgts % 4; k++) {
+            y_phase *= ComplexT{0, 1};
+        }
+
+        std::vector<ComplexT> matrix(dim * dim);
+        for (std::size_t col = 0; col < dim; col++) {
+            const PrecisionT sign = (std::popcount(col) % 2 == 0) ? 1 : -1;
+            matrix[col * dim + col] += c;
+            switch (pauli) {
+            case 'X':
+                matrix[(col ^ all) * dim + col] += neg_is;
+                break;
+            case 'Y':
+                matrix[(col ^ all) * dim + col] += neg_is * y_phase * sign;
+                break;
+            default:
+                matrix[col * dim + col] += neg_is * sign;
+                break;
+            }
+        }
+        return matrix;
+    }
+
+    /**
+     * @brief Row-major matrix of `diag(1, value)`.
+     */
+    static auto getPhase(ComplexT value) -> std::vector<ComplexT> {
+        return {{1, 0}, {0, 0}, {0, 0}, value};
+    }
+
+    /**
+     * @brief Get the matrix applied for a gate of the tape, before any
+     * adjoint, over its target wires in tape order.
+     */
+    static auto getOpMatrix(const GateTape<PrecisionT> &tape,
+                            const typename GateTape<PrecisionT>::Op &op)
+        -> std::vector<CFP_t> {
+        const PrecisionT *params =
+            tape.getParameters().data() + op.param_offset;
+        std::vector<ComplexT> matrix;
+        switch (op.opcode) {
+        case GateOp::PauliX:
+        case GateOp::CNOT:
+        case GateOp::Toffoli:
+            return cuGates::getPauliX<CFP_t>();
+        case GateOp::PauliY:
+        case GateOp::CY:
+            return cuGates::getPauliY<CFP_t>();
+        case GateOp::Hadamard:
+            return cuGates::getHadamard<CFP_t>();
+        case GateOp::SWAP:
+        case GateOp::CSWAP:
+            return cuGates::getSWAP<CFP_t>();
+        case GateOp::PauliZ:
+        case GateOp::CZ:
+            matrix = getPhase({-1, 0});
+            break;
+        case GateOp::S:
+            matrix = getPhase({0, 1});
+            break;
+        case GateOp::T:
+            matrix = getPhase(
+                std::exp(ComplexT{0, static_cast<PrecisionT>(M_PI / 4)}));
+            break;
+        case GateOp::PhaseShift:
+        case GateOp::ControlledPhaseShift:
+            matrix = getPhase(std::exp(ComplexT{0, params[0]}));
+            break;
+        case GateOp::RX:
+        case GateOp::CRX:
+        case GateOp::IsingXX:
+            matrix = getPauliRotation('X', op.num_tgts, params[0]);
+            break;
+        case GateOp::RY:
+        case GateOp::CRY:
+        case GateOp::IsingYY:
+            matrix = getPauliRotation('Y', op.num_tgts, params[0]);
+            break;
+        case GateOp::RZ:
+        case GateOp::CRZ:
+        case GateOp::IsingZZ:
+        case GateOp::MultiRZ:
+            matrix = getPauliRotation('Z', op.num_tgts, params[0]);
+            break;
+        case GateOp::Rot:
+        case GateOp::CRot: {
+            // RZ(params[2]) RY(params[1]) RZ(params[0])
+            const auto rz0 = getPauliRotation('Z', 1, params[0]);
+            const auto ry = getPauliRotation('Y', 1, params[1]);
+            const auto rz2 = getPauliRotation('Z', 1, params[2]);
+            matrix.assign(4, {0, 0});
+            for (std::size_t r = 0; r < 2; r++) {
+                for (std::size_t c = 0; c < 2; c++) {
+                    for (std::size_t k = 0; k < 2; k++) {
+                        matrix[r * 2 + c] +=
+                            rz2[r * 2 + r] * ry[r * 2 + k] * rz0[k * 2 + c];
+                    }
+                }
+            }
+            break;
+        }
+        default: { // excitations and explicit matrices
+            const auto begin = tape.getMatrices().begin() + op.matrix_offset;
+            return {begin, begin + Pennylane::Util::exp2(2 * op.num_tgts)};
+        }
+        }
+
+        std::vector<CFP_t> result(matrix.size());
+        std::transform(matrix.begin(), matrix.end(), result.begin(),
+                       [](const ComplexT &x) {
+                           return Util::complexToCu<ComplexT>(x);
+                       });
+        return result;
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -2,6 +2,9 @@
 
 #include <cmath>
 #include <complex>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -9,7 +12,9 @@
 
 #include "DataBuffer.hpp"
 #include "DevTag.hpp"
+#include "Error.hpp"
 #include "Gates.hpp"
+#include "StagingPool.hpp"
 #include "cuda.h"
 #include "cuda_helpers.hpp"
 
@@ -24,40 +29,38 @@ using namespace cuUtil;
 namespace Pennylane::CUDA {
 
 /**
- * @brief Represents a cache for gate data to be accessible on the device.
+ * @brief Hash of `(gate name, parameter)` gate keys.
+ */
+struct gate_id_hash {
+    template <class T1, class T2>
+    std::size_t operator()(const std::pair<T1, T2> &pair) const {
+        return std::hash<T1>()(pair.first) ^ std::hash<T2>()(pair.second);
+    }
+};
+
+/**
+ * @brief Immutable device-resident table of the default gate-set, shared by
+ * all gate caches of a given device and precision. All gates are stored in a
+ * single device allocation. The table is safe for concurrent readers, and is
+ * released with the last cache referencing it.
  *
  * @tparam fp_t Floating point precision.
  */
-template <class fp_t> class GateCache {
+template <class fp_t> class SharedGateTable {
   public:
     using CFP_t = decltype(cuUtil::getCudaType(fp_t{}));
     using gate_id = std::pair<std::string, fp_t>;
 
-    GateCache() = delete;
-    GateCache(const GateCache &other) = delete;
-    GateCache(GateCache &&other) = delete;
-    GateCache(bool populate, int device_id = 0, cudaStream_t stream_id = 0)
-        : device_tag_(device_id, stream_id), total_alloc_bytes_{0} {
-        if (populate) {
-            defaultPopulateCache();
-        }
-    }
-    GateCache(bool populate, const DevTag<int> &device_tag)
-        : device_tag_{device_tag}, total_alloc_bytes_{0} {
-        if (populate) {
-            defaultPopulateCache();
-        }
-    }
-    virtual ~GateCache(){};
+    SharedGateTable() = delete;
+    SharedGateTable(const SharedGateTable &other) = delete;
+    SharedGateTable(SharedGateTable &&other) = delete;
 
     /**
-     * @brief Add a default gate-set to the given cache. Assumes
-     * initializer-list evaluated gates for "PauliX", "PauliY", "PauliZ",
-     * "Hadamard", "S", "T", "SWAP", with "CNOT" and "CZ" represented as their
-     * single-qubit values.
+     * @brief Build the default gate-set on the given device.
      *
+     * @param device_id Device index.
      */
-    void defaultPopulateCache() {
+    explicit SharedGateTable(int device_id) {
         host_gates_.emplace(
             std::piecewise_construct,
             std::forward_as_tuple(std::make_pair(std::string{"Identity"}, 0.0)),
@@ -150,15 +153,111 @@ template <class fp_t> class GateCache {
             std::forward_as_tuple(
                 host_gates_.at(std::make_pair(std::string{"SWAP"}, 0.0))));
 
+        std::size_t total_length = 0;
+        for (const auto &[h_gate_k, h_gate_v] : host_gates_) {
+            offsets_.emplace(h_gate_k, total_length);
+            total_length += h_gate_v.size();
+        }
+        std::vector<CFP_t> packed(total_length);
         for (const auto &[h_gate_k, h_gate_v] : host_gates_) {
-            device_gates_.emplace(
-                std::piecewise_construct, std::forward_as_tuple(h_gate_k),
-                std::forward_as_tuple(h_gate_v.size(), device_tag_));
-            device_gates_.at(h_gate_k).CopyHostDataToGpu(h_gate_v.data(),
-                                                         h_gate_v.size());
-            total_alloc_bytes_ += (sizeof(CFP_t) * h_gate_v.size());
+            std::copy(h_gate_v.begin(), h_gate_v.end(),
+                      packed.begin() + offsets_.at(h_gate_k));
+        }
+        device_gates_ = std::make_unique<DataBuffer<CFP_t>>(
+            total_length, DevTag<int>{device_id, 0});
+        device_gates_->CopyHostDataToGpu(packed.data(), packed.size());
+    }
+
+    /**
+     * @brief Get the table of the given device, building it if no cache
+     * currently references one.
+     *
+     * @param device_id Device index.
+     */
+    static auto getInstance(int device_id)
+        -> std::shared_ptr<const SharedGateTable> {
+        static std::mutex registry_mutex;
+        static std::unordered_map<int, std::weak_ptr<const SharedGateTable>>
+            registry;
+
+        const std::lock_guard<std::mutex> lock(registry_mutex);
+        auto table = registry[device_id].lock();
+        if (!table) {
+            table = std::make_shared<const SharedGateTable>(device_id);
+            registry[device_id] = table;
+        }
+        return table;
+    }
+
+    [[nodiscard]] bool contains(const gate_id &gate_key) const {
+        return offsets_.find(gate_key) != offsets_.end();
+    }
+    [[nodiscard]] auto getDevicePtr(const gate_id &gate_key) const
+        -> const CFP_t * {
+        return device_gates_->getData() + offsets_.at(gate_key);
+    }
+    [[nodiscard]] auto getHost(const gate_id &gate_key) const
+        -> const std::vector<CFP_t> & {
+        return host_gates_.at(gate_key);
+    }
+    [[nodiscard]] auto getNumGates() const -> std::size_t {
+        return host_gates_.size();
+    }
+
+  private:
+    std::unordered_map<gate_id, std::vector<CFP_t>, gate_id_hash> host_gates_;
+    std::unordered_map<gate_id, std::size_t, gate_id_hash> offsets_;
+    std::unique_ptr<DataBuffer<CFP_t>> device_gates_;
+};
+
+/**
+ * @brief Represents a cache for gate data to be accessible on the device.
+ *
+ * Gates of the default gate-set are read from the `SharedGateTable` of the
+ * device, so creating a cache does not allocate device memory. Gates added
+ * with `add_gate` are held in a private overlay bounded by a byte capacity,
+ * and the least recently used ones are evicted once it is exceeded. Device
+ * pointers returned by `get_gate_device_ptr` for such gates remain valid until
+ * the next `add_gate`, `setCapacity` or `clear` call.
+ *
+ * @tparam fp_t Floating point precision.
+ */
+template <class fp_t> class GateCache {
+  public:
+    using CFP_t = decltype(cuUtil::getCudaType(fp_t{}));
+    using gate_id = std::pair<std::string, fp_t>;
+
+    /// Default device memory budget in bytes for gates added with `add_gate`.
+    static constexpr std::size_t default_capacity_bytes = 1UL << 24UL;
+
+    GateCache() = delete;
+    GateCache(const GateCache &other) = delete;
+    GateCache(GateCache &&other) = delete;
+    GateCache(bool populate, int device_id = 0, cudaStream_t stream_id = 0)
+        : device_tag_(device_id, stream_id), total_alloc_bytes_{0} {
+        if (populate) {
+            defaultPopulateCache();
+        }
+    }
+    GateCache(bool populate, const DevTag<int> &device_tag)
+        : device_tag_{device_tag}, total_alloc_bytes_{0} {
+        if (populate) {
+            defaultPopulateCache();
         }
     }
+    virtual ~GateCache(){};
+
+    /**
+     * @brief Attach the shared default gate-set of this device to the cache.
+     * Assumes initializer-list evaluated gates for "PauliX", "PauliY",
+     * "PauliZ", "Hadamard", "S", "T", "SWAP", with "CNOT" and "CZ"
+     * represented as their single-qubit values.
+     *
+     */
+    void defaultPopulateCache() {
+        default_gates_ =
+            SharedGateTable<fp_t>::getInstance(device_tag_.getDeviceID());
+    }
 
     /**
      * @brief Check for the existence of a given gate.
@@ -168,7 +267,8 @@ template <class fp_t> class GateCache {
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const gate_id &gate) {
-        return ((host_gates_.find(gate) != host_gates_.end()) &&
+        return (default_gates_ && default_gates_->contains(gate)) ||
+               ((host_gates_.find(gate) != host_gates_.end()) &&
                 (device_gates_.find(gate)) != device_gates_.end());
     }
     /**
@@ -180,15 +280,13 @@ template <class fp_t> class GateCache {
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const std::string &gate_name, fp_t gate_param) {
-        return (host_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                host_gates_.end()) &&
-               (device_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                device_gates_.end());
+        return gateExists(std::make_pair(gate_name, gate_param));
     }
 
     /**
      * @brief Add gate numerical value to the cache, indexed by the gate name
-     * and parameter value.
+     * and parameter value. Least recently used gates are evicted if the
+     * cache capacity is exceeded.
      *
      * @param gate_name String representing the name of the given gate.
      * @param gate_param Gate parameter value. `0.0` if non-parametric gate.
@@ -196,16 +294,7 @@ template <class fp_t> class GateCache {
      */
     void add_gate(const std::string &gate_name, fp_t gate_param,
                   std::vector<CFP_t> host_data) {
-        const auto gate_key = std::make_pair(gate_name, gate_param);
-        host_gates_[gate_key] = std::move(host_data);
-        auto &gate = host_gates_[gate_key];
-
-        device_gates_.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(gate_key),
-                              std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
-
-        this->total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        add_gate(std::make_pair(gate_name, gate_param), std::move(host_data));
     }
 
     /**
@@ -216,20 +305,34 @@ template <class fp_t> class GateCache {
      * @param host_data
      */
     void add_gate(const gate_id &gate_key, std::vector<CFP_t> host_data) {
+        PL_ABORT_IF(default_gates_ && default_gates_->contains(gate_key),
+                    "Cannot overwrite a gate of the shared default gate-set");
+        if (gateExists(gate_key)) {
+            remove_gate(gate_key);
+        }
         host_gates_[gate_key] = std::move(host_data);
         auto &gate = host_gates_[gate_key];
 
         device_gates_.emplace(std::piecewise_construct,
                               std::forward_as_tuple(gate_key),
                               std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
+        const std::size_t gate_bytes = sizeof(CFP_t) * gate.size();
+        // Enqueued on the stream, so that adding a gate mid-circuit does not
+        // wait for the gates applied before it
+        staging_.copyHostToDevice(device_gates_.at(gate_key).getData(),
+                                  gate.data(), gate_bytes);
+
+        total_alloc_bytes_ += gate_bytes;
+        lru_order_.push_front(gate_key);
+        lru_entries_.emplace(gate_key, LRUEntry{lru_order_.begin(), true});
+        num_misses_++;
 
-        total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        evict(capacity_bytes_);
     }
 
     /**
      * @brief Returns a pointer to the GPU device memory where the gate is
-     * stored.
+     * stored, marking the gate as most recently used.
      *
      * @param gate_name String representing the name of the given gate.
      * @param gate_param Gate parameter value. `0.0` if non-parametric gate.
@@ -237,32 +340,143 @@ template <class fp_t> class GateCache {
      */
     const CFP_t *get_gate_device_ptr(const std::string &gate_name,
                                      fp_t gate_param) {
-        return device_gates_.at(std::make_pair(gate_name, gate_param))
-            .getData();
+        return get_gate_device_ptr(std::make_pair(gate_name, gate_param));
     }
     const CFP_t *get_gate_device_ptr(const gate_id &gate_key) {
-        return device_gates_.at(gate_key).getData();
+        if (default_gates_ && default_gates_->contains(gate_key)) {
+            return default_gates_->getDevicePtr(gate_key);
+        }
+        const CFP_t *ptr = device_gates_.at(gate_key).getData();
+        touch(gate_key);
+        return ptr;
     }
     auto get_gate_host(const std::string &gate_name, fp_t gate_param) {
-        return host_gates_.at(std::make_pair(gate_name, gate_param));
+        return get_gate_host(std::make_pair(gate_name, gate_param));
     }
-    auto get_gate_host(const gate_id &gate_key) {
+    auto get_gate_host(const gate_id &gate_key) -> std::vector<CFP_t> {
+        if (default_gates_ && default_gates_->contains(gate_key)) {
+            return default_gates_->getHost(gate_key);
+        }
         return host_gates_.at(gate_key);
     }
 
+    /**
+     * @brief Set the device memory budget for gates added with `add_gate`,
+     * evicting least recently used gates if it is exceeded.
+     *
+     * @param capacity_bytes Capacity in bytes.
+     */
+    void setCapacity(std::size_t capacity_bytes) {
+        capacity_bytes_ = capacity_bytes;
+        evict(capacity_bytes_);
+    }
+
+    /**
+     * @brief Evict all gates added with `add_gate`. The default gate-set is
+     * kept.
+     */
+    void clear() {
+        while (!lru_order_.empty()) {
+            remove_gate(gate_id{lru_order_.back()});
+        }
+    }
+
+    /**
+     * @brief Get the device memory budget for gates added with `add_gate`.
+     */
+    [[nodiscard]] auto getCapacity() const -> std::size_t {
+        return capacity_bytes_;
+    }
+    /**
+     * @brief Get the device memory in bytes held by the gates added with
+     * `add_gate`. The shared default gate-set is not included.
+     */
+    [[nodiscard]] auto getAllocatedBytes() const -> std::size_t {
+        return total_alloc_bytes_;
+    }
+    /**
+     * @brief Get the number of cached gates, including the default gate-set.
+     */
+    [[nodiscard]] auto getNumGates() const -> std::size_t {
+        return device_gates_.size() +
+               (default_gates_ ? default_gates_->getNumGates() : 0);
+    }
+    /**
+     * @brief Get the number of lookups of gates added with `add_gate` that
+     * were served without copying the gate to the device.
+     */
+    [[nodiscard]] auto getNumHits() const -> std::size_t { return num_hits_; }
+    /**
+     * @brief Get the number of gates added with `add_gate`, each requiring a
+     * copy to the device.
+     */
+    [[nodiscard]] auto getNumMisses() const -> std::size_t {
+        return num_misses_;
+    }
+    /**
+     * @brief Get the number of gates evicted to respect the capacity.
+     */
+    [[nodiscard]] auto getNumEvictions() const -> std::size_t {
+        return num_evictions_;
+    }
+
   private:
     const DevTag<int> device_tag_;
+    CUDA::StagingPool staging_{device_tag_.getStreamID()};
     std::size_t total_alloc_bytes_;
+    std::size_t capacity_bytes_{default_capacity_bytes};
+    std::size_t num_hits_{0};
+    std::size_t num_misses_{0};
+    std::size_t num_evictions_{0};
 
-    struct gate_id_hash {
-        template <class T1, class T2>
-        std::size_t operator()(const std::pair<T1, T2> &pair) const {
-            return std::hash<T1>()(pair.first) ^ std::hash<T2>()(pair.second);
-        }
-    };
-
+    std::shared_ptr<const SharedGateTable<fp_t>> default_gates_;
     std::unordered_map<gate_id, CUDA::DataBuffer<CFP_t>, gate_id_hash>
         device_gates_;
     std::unordered_map<gate_id, std::vector<CFP_t>, gate_id_hash> host_gates_;
+
+    /// Recency of the gates added with `add_gate`, most recent first.
+    std::list<gate_id> lru_order_;
+    struct LRUEntry {
+        typename std::list<gate_id>::iterator position;
+        bool fresh; ///< Added since its last lookup
+    };
+    std::unordered_map<gate_id, LRUEntry, gate_id_hash> lru_entries_;
+
+    /**
+     * @brief Count a lookup of a gate added with `add_gate` and move it to the
+     * front of the recency list.
+     */
+    void touch(const gate_id &gate_key) {
+        auto it = lru_entries_.find(gate_key);
+        if (it->second.fresh) {
+            it->second.fresh = false;
+        } else {
+            num_hits_++;
+        }
+        lru_order_.splice(lru_order_.begin(), lru_order_, it->second.position);
+    }
+
+    /**
+     * @brief Evict least recently used gates until at most `max_bytes` are
+     * held by gates added with `add_gate`. The most recently used gate is
+     * kept even if it alone exceeds the budget.
+     */
+    void evict(std::size_t max_bytes) {
+        while (total_alloc_bytes_ > max_bytes && lru_order_.size() > 1) {
+            remove_gate(gate_id{lru_order_.back()});
+            num_evictions_++;
+        }
+    }
+
+    void remove_gate(const gate_id &gate_key) {
+        const std::size_t gate_bytes =
+            sizeof(CFP_t) * host_gates_.at(gate_key).size();
+        auto it = lru_entries_.find(gate_key);
+        lru_order_.erase(it->second.position);
+        lru_entries_.erase(it);
+        device_gates_.erase(gate_key);
+        host_gates_.erase(gate_key);
+        total_alloc_bytes_ -= gate_bytes;
+    }
 };
 } // namespace Pennylane::CUDA
@@ -42,7 +42,7 @@ void setStateVector_CUDA(cuDoubleComplex *sv, long &num_indices,
  * @param sv Complex data pointer of state vector on device.
  * @param value Complex data of the input value.
  * @param index Integer data of the sv index to be set with the value.
- * @param async Use an asynchronous memory copy.
+ * @param async Return without waiting for the write to complete.
  * @param stream_id Stream id of CUDA calls
  */
 void setBasisState_CUDA(cuComplex *sv, cuComplex &value, const size_t index,
@@ -69,6 +69,20 @@ __global__ void setStateVectorkernel(GPUDataT *sv, index_type num_indices,
         sv[indices[i]] = value[i];
     }
 }
+/**
+ * @brief The CUDA kernel that sets a single element of the state vector. The
+ * value is passed as a kernel argument, so no host memory is read once the
+ * kernel is enqueued.
+ *
+ * @param sv Complex data pointer of state vector on device.
+ * @param value Complex data of the input value.
+ * @param index Integer data of the sv index to be set by value.
+ */
+template <class GPUDataT>
+__global__ void setBasisStatekernel(GPUDataT *sv, GPUDataT value,
+                                    size_t index) {
+    sv[index] = value;
+}
 /**
  * @brief The CUDA kernel call wrapper.
  *
@@ -95,23 +109,21 @@ void setStateVector_CUDA_call(GPUDataT *sv, index_type &num_indices,
     PL_CUDA_IS_SUCCESS(cudaGetLastError());
 }
 /**
- * @brief CUDA runtime API call wrapper.
+ * @brief The CUDA kernel call wrapper.
  *
  * @param sv Complex data pointer of state vector on device.
  * @param value Complex data of the input value.
  * @param index Integer data of the sv index to be set by value.
- * @param async Use an asynchronous memory copy.
+ * @param async Return without waiting for the write to complete.
  * @param stream_id Stream id of CUDA calls
  */
 template <class GPUDataT>
 void setBasisState_CUDA_call(GPUDataT *sv, GPUDataT &value, const size_t index,
                              bool async, cudaStream_t stream_id) {
+    setBasisStatekernel<GPUDataT><<<1, 1, 0, stream_id>>>(sv, value, index);
+    PL_CUDA_IS_SUCCESS(cudaGetLastError());
     if (!async) {
-        PL_CUDA_IS_SUCCESS(cudaMemcpy(&sv[index], &value, sizeof(GPUDataT),
-                                      cudaMemcpyHostToDevice));
-    } else {
-        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(&sv[index], &value, sizeof(GPUDataT),
-                                           cudaMemcpyHostToDevice, stream_id));
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
     }
 }
 
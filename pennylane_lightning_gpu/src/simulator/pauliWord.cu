@@ -0,0 +1,122 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//     http://www.apache.org/licenses/LICENSE-2.0
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file pauliWord.cu
+ */
+#include "cuda_helpers.hpp"
+#include <cuComplex.h>
+
+namespace Pennylane {
+
+/**
+ * @brief Add a Pauli word applied to the state vector, scaled by a
+ * coefficient, to an accumulator on GPU device. The state vector is left
+ * unchanged.
+ *
+ * The word maps the basis state `i` to
+ * `(-1)^popcount(i & z_mask) |i ^ x_mask>`, up to a global phase folded into
+ * `coeff`.
+ *
+ * @param sv Complex data pointer of state vector on device.
+ * @param acc Complex data pointer of the accumulator on device.
+ * @param length Number of elements of the state vector.
+ * @param x_mask Bits flipped by the word.
+ * @param z_mask Bits whose parity gives the sign of each element.
+ * @param coeff Coefficient of the word, including its global phase.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+void scaleAndAddPauliWord_CUDA(const cuComplex *sv, cuComplex *acc,
+                               size_t length, size_t x_mask, size_t z_mask,
+                               cuComplex coeff, size_t thread_per_block,
+                               cudaStream_t stream_id);
+void scaleAndAddPauliWord_CUDA(const cuDoubleComplex *sv,
+                               cuDoubleComplex *acc, size_t length,
+                               size_t x_mask, size_t z_mask,
+                               cuDoubleComplex coeff, size_t thread_per_block,
+                               cudaStream_t stream_id);
+
+/**
+ * @brief The CUDA kernel that adds a scaled Pauli word applied to the state
+ * vector to an accumulator. Each thread reads one element of the state vector
+ * and writes one element of the accumulator, so no two threads write the same
+ * element.
+ *
+ * @param sv Complex data pointer of state vector on device.
+ * @param acc Complex data pointer of the accumulator on device.
+ * @param length Number of elements of the state vector.
+ * @param x_mask Bits flipped by the word.
+ * @param z_mask Bits whose parity gives the sign of each element.
+ * @param coeff Coefficient of the word, including its global phase.
+ */
+template <class GPUDataT>
+__global__ void scaleAndAddPauliWordKernel(const GPUDataT *sv, GPUDataT *acc,
+                                           size_t length, size_t x_mask,
+                                           size_t z_mask, GPUDataT coeff) {
+    const size_t i = size_t{blockIdx.x} * blockDim.x + threadIdx.x;
+    if (i < length) {
+        if (__popcll(i & z_mask) & 1) {
+            coeff.x = -coeff.x;
+            coeff.y = -coeff.y;
+        }
+        const GPUDataT value = sv[i];
+        GPUDataT &target = acc[i ^ x_mask];
+        target.x += coeff.x * value.x - coeff.y * value.y;
+        target.y += coeff.x * value.y + coeff.y * value.x;
+    }
+}
+/**
+ * @brief The CUDA kernel call wrapper.
+ *
+ * @param sv Complex data pointer of state vector on device.
+ * @param acc Complex data pointer of the accumulator on device.
+ * @param length Number of elements of the state vector.
+ * @param x_mask Bits flipped by the word.
+ * @param z_mask Bits whose parity gives the sign of each element.
+ * @param coeff Coefficient of the word, including its global phase.
+ * @param thread_per_block Number of threads set per block.
+ * @param stream_id Stream id of CUDA calls
+ */
+template <class GPUDataT>
+void scaleAndAddPauliWord_CUDA_call(const GPUDataT *sv, GPUDataT *acc,
+                                    size_t length, size_t x_mask,
+                                    size_t z_mask, GPUDataT coeff,
+                                    size_t thread_per_block,
+                                    cudaStream_t stream_id) {
+    const size_t num_blocks =
+        (length + thread_per_block - 1) / thread_per_block;
+    dim3 blockSize(thread_per_block, 1, 1);
+    dim3 gridSize(num_blocks, 1);
+
+    scaleAndAddPauliWordKernel<GPUDataT>
+        <<<gridSize, blockSize, 0, stream_id>>>(sv, acc, length, x_mask,
+                                                z_mask, coeff);
+    PL_CUDA_IS_SUCCESS(cudaGetLastError());
+}
+
+// Definitions
+void scaleAndAddPauliWord_CUDA(const cuComplex *sv, cuComplex *acc,
+                               size_t length, size_t x_mask, size_t z_mask,
+                               cuComplex coeff, size_t thread_per_block,
+                               cudaStream_t stream_id) {
+    scaleAndAddPauliWord_CUDA_call(sv, acc, length, x_mask, z_mask, coeff,
+                                   thread_per_block, stream_id);
+}
+void scaleAndAddPauliWord_CUDA(const cuDoubleComplex *sv,
+                               cuDoubleComplex *acc, size_t length,
+                               size_t x_mask, size_t z_mask,
+                               cuDoubleComplex coeff, size_t thread_per_block,
+                               cudaStream_t stream_id) {
+    scaleAndAddPauliWord_CUDA_call(sv, acc, length, x_mask, z_mask, coeff,
+                                   thread_per_block, stream_id);
+}
+
+} // namespace Pennylane
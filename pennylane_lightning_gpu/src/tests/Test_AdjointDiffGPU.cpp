@@ -117,6 +117,39 @@ TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=RX, Obs=[Z,Z]",
     }
 }
 
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=RX, Obs=[SparseH,Z]",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    std::vector<size_t> tp{0};
+    {
+        const size_t num_qubits = 2;
+        const size_t num_obs = 2;
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(tp.size(), 0));
+
+        // Z on wire 0, whose application replaces the state-vector data
+        const auto obs1 = SparseHamiltonianGPU<double>::create(
+            {{1.0, 0.0}, {1.0, 0.0}, {-1.0, 0.0}, {-1.0, 0.0}}, {0, 1, 2, 3},
+            {0, 1, 2, 3, 4}, {0, 1});
+        const auto obs2 = std::make_shared<NamedObsGPU<double>>(
+            "PauliZ", std::vector<size_t>{1});
+
+        for (const auto &p : param) {
+            auto ops = adj.createOpsData({"RX", "RX"}, {{p}, {p / 2}},
+                                         {{0}, {1}}, {false, false});
+
+            SVDataGPU<double> psi(num_qubits);
+            adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                                jacobian, {obs1, obs2}, ops, tp, true);
+
+            CAPTURE(jacobian);
+            CHECK(-sin(p) == Approx(jacobian[0][0]).margin(1e-7));
+            CHECK(0.0 == Approx(jacobian[1][0]).margin(1e-7));
+        }
+    }
+}
+
 TEST_CASE("AdjointJacobianGPU::AdjointJacobianGPU Op=[RX,RX,RX], Obs=[Z,Z,Z]",
           "[AdjointJacobianGPU]") {
 
@@ -153,6 +186,137 @@ TEST_CASE("AdjointJacobianGPU::AdjointJacobianGPU Op=[RX,RX,RX], Obs=[Z,Z,Z]",
     }
 }
 
+TEST_CASE("AdjointJacobianGPU::adjointJacobian tiled observables",
+          "[AdjointJacobianGPU]") {
+    using AdjT = AdjointJacobianGPU<double>;
+    const size_t num_qubits = 3;
+    const size_t sv_bytes = sizeof(std::complex<double>) << num_qubits;
+
+    SECTION("Tile size") {
+        CHECK(AdjT::getObservableTileSize(num_qubits, 5, 0) == 5);
+        CHECK(AdjT::getObservableTileSize(
+                  num_qubits, 5, (AdjT::num_fixed_states + 2) * sv_bytes) ==
+              2);
+        CHECK(AdjT::getObservableTileSize(
+                  num_qubits, 5, (AdjT::num_fixed_states + 9) * sv_bytes) ==
+              5);
+        REQUIRE_THROWS_AS(AdjT::getObservableTileSize(
+                              num_qubits, 5, AdjT::num_fixed_states * sv_bytes),
+                          Pennylane::Util::LightningException);
+    }
+
+    SECTION("Tile size with scratch states") {
+        // Each observable holds its copy, a scratch copy and an accumulator
+        CHECK(AdjT::getObservableTileSize(
+                  num_qubits, 5, (AdjT::num_fixed_states + 7) * sv_bytes,
+                  2) == 2);
+        CHECK(AdjT::getObservableTileSize(
+                  num_qubits, 5, (AdjT::num_fixed_states + 3) * sv_bytes,
+                  2) == 1);
+        REQUIRE_THROWS_AS(
+            AdjT::getObservableTileSize(
+                num_qubits, 5, (AdjT::num_fixed_states + 2) * sv_bytes, 2),
+            Pennylane::Util::LightningException);
+    }
+
+    SECTION("Tiles match the untiled Jacobian") {
+        const std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+        const std::vector<size_t> tp{0, 1, 2};
+        const size_t num_obs = 3;
+
+        std::vector<std::shared_ptr<ObservableGPU<double>>> obs;
+        for (size_t i = 0; i < num_obs; i++) {
+            obs.push_back(std::make_shared<NamedObsGPU<double>>(
+                "PauliZ", std::vector<size_t>{i}));
+        }
+
+        for (size_t tile_size : {1, 2}) {
+            AdjT adj;
+            adj.setMemoryBudget((AdjT::num_fixed_states + tile_size) *
+                                sv_bytes);
+            CHECK(adj.getMemoryBudget() ==
+                  (AdjT::num_fixed_states + tile_size) * sv_bytes);
+
+            auto ops = adj.createOpsData({"RX", "RX", "RX"},
+                                         {{param[0]}, {param[1]}, {param[2]}},
+                                         {{0}, {1}, {2}},
+                                         {false, false, false});
+            std::vector<std::vector<double>> jacobian(
+                num_obs, std::vector<double>(tp.size(), 0));
+            SVDataGPU<double> psi(num_qubits);
+
+            adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                                jacobian, obs, ops, tp, true);
+
+            CAPTURE(tile_size);
+            CAPTURE(jacobian);
+            for (size_t i = 0; i < num_obs; i++) {
+                for (size_t j = 0; j < tp.size(); j++) {
+                    const double expected = (i == j) ? -sin(param[i]) : 0.0;
+                    CHECK(expected == Approx(jacobian[i][j]).margin(1e-7));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::vectorJacobianProduct Op=Mixed, Obs=[Z,Z,X,Y]",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const size_t num_qubits = 2;
+    const std::vector<size_t> tp{0, 1, 2};
+    const std::vector<double> dy{0.5, -1.0, 2.0, 0.0};
+
+    std::vector<std::shared_ptr<ObservableGPU<double>>> obs{
+        std::make_shared<NamedObsGPU<double>>("PauliZ",
+                                              std::vector<size_t>{0}),
+        std::make_shared<NamedObsGPU<double>>("PauliZ",
+                                              std::vector<size_t>{1}),
+        std::make_shared<NamedObsGPU<double>>("PauliX",
+                                              std::vector<size_t>{1}),
+        std::make_shared<NamedObsGPU<double>>("PauliY",
+                                              std::vector<size_t>{0})};
+
+    auto ops = adj.createOpsData({"RX", "CNOT", "RY", "RZ"},
+                                 {{0.4}, {}, {-0.3}, {1.1}},
+                                 {{0}, {0, 1}, {1}, {0}},
+                                 {false, false, false, false});
+
+    std::vector<std::vector<double>> jacobian(
+        obs.size(), std::vector<double>(tp.size(), 0));
+    SVDataGPU<double> psi(num_qubits);
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, obs, ops, tp, true);
+
+    std::vector<double> expected(tp.size(), 0);
+    for (size_t i = 0; i < obs.size(); i++) {
+        for (size_t j = 0; j < tp.size(); j++) {
+            expected[j] += dy[i] * jacobian[i][j];
+        }
+    }
+
+    SECTION("Matches the contracted Jacobian") {
+        std::vector<double> vjp(tp.size(), 0);
+        adj.vectorJacobianProduct(psi.cuda_sv.getData(),
+                                  psi.cuda_sv.getLength(), vjp, dy, obs, ops,
+                                  tp, true);
+        CAPTURE(vjp);
+        CHECK(vjp == Pennylane::approx(expected).margin(1e-7));
+    }
+    SECTION("Mismatched sizes") {
+        std::vector<double> vjp(tp.size(), 0);
+        REQUIRE_THROWS_AS(adj.vectorJacobianProduct(
+                              psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                              vjp, {1.0}, obs, ops, tp, true),
+                          Pennylane::Util::LightningException);
+        std::vector<double> short_vjp(1, 0);
+        REQUIRE_THROWS_AS(adj.vectorJacobianProduct(
+                              psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                              short_vjp, dy, obs, ops, tp, true),
+                          Pennylane::Util::LightningException);
+    }
+}
+
 TEST_CASE("AdjointJacobianGPU::AdjointJacobianGPU Op=[RX,RX,RX], Obs=[Z,Z,Z],"
           "TParams=[0,2]",
           "[AdjointJacobianGPU]") {
@@ -471,6 +635,49 @@ TEST_CASE("AdjointJacobianGPU::batchAdjointJacobian Mixed Ops, Obs and TParams",
     }
 }
 
+TEST_CASE("AdjointJacobianGPU::batchAdjointJacobian repeated calls",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const std::vector<size_t> tp{0, 1, 2};
+
+    // More observables than tiles, of uneven cost
+    std::vector<std::shared_ptr<ObservableGPU<double>>> obs;
+    for (size_t i = 0; i < 3; i++) {
+        obs.push_back(std::make_shared<NamedObsGPU<double>>(
+            "PauliZ", std::vector<size_t>{i}));
+        obs.push_back(HamiltonianGPU<double>::create(
+            {0.5, -0.25},
+            {std::make_shared<NamedObsGPU<double>>("PauliX",
+                                                   std::vector<size_t>{i}),
+             std::make_shared<NamedObsGPU<double>>(
+                 "PauliY", std::vector<size_t>{(i + 1) % 3})}));
+    }
+
+    auto ops = adj.createOpsData({"RX", "CNOT", "RY", "RZ"},
+                                 {{0.4}, {}, {-0.3}, {1.1}},
+                                 {{0}, {0, 1}, {1}, {2}},
+                                 {false, false, false, false});
+
+    std::vector<std::vector<double>> expected(
+        obs.size(), std::vector<double>(tp.size(), 0));
+    for (size_t num_qubits : {3, 4, 3}) {
+        SVDataGPU<double> psi(num_qubits);
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            expected, obs, ops, tp, true);
+
+        std::vector<std::vector<double>> jacobian(
+            obs.size(), std::vector<double>(tp.size(), 0));
+        adj.batchAdjointJacobian(psi.cuda_sv.getData(),
+                                 psi.cuda_sv.getLength(), jacobian, obs, ops,
+                                 tp, true);
+
+        CAPTURE(num_qubits);
+        for (size_t i = 0; i < obs.size(); i++) {
+            CHECK(jacobian[i] == Pennylane::approx(expected[i]).margin(1e-7));
+        }
+    }
+}
+
 TEST_CASE("Algorithms::adjointJacobian Op=RX, Obs=Ham[Z0+Z1]", "[Algorithms]") {
     AdjointJacobianGPU<double> adj;
     std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
@@ -0,0 +1,210 @@
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "CompiledCircuit.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+/**
+ * @brief State-vector stand-in recording the tapes applied to it.
+ */
+template <class PrecisionT> struct TapeRecorder {
+    using CFP_t = typename GateTape<PrecisionT>::CFP_t;
+
+    DevTag<int> dev_tag{0, 0};
+    std::vector<std::vector<PrecisionT>> params;
+    std::vector<const CFP_t *> device_matrices;
+    std::vector<std::size_t> plan_ids;
+
+    [[nodiscard]] auto getDevTag() const -> const DevTag<int> & {
+        return dev_tag;
+    }
+    void applyTape(const GateTape<PrecisionT> &tape, bool adjoint,
+                   const CFP_t *matrices) {
+        REQUIRE(!adjoint);
+        params.push_back(tape.getParameters());
+        device_matrices.push_back(matrices);
+    }
+    void applyTapeGraph(const GateTape<PrecisionT> &tape,
+                        const TapeGraphPlan<PrecisionT> &plan) {
+        params.push_back(tape.getParameters());
+        plan_ids.push_back(plan.getId());
+    }
+};
+} // namespace
+
+TEMPLATE_TEST_CASE("CompiledCircuit::CompiledCircuit", "[CompiledCircuit]",
+                   float, double) {
+    using Circuit = CompiledCircuit<TestType>;
+    const std::size_t num_qubits = 3;
+
+    SECTION("Without fusion") {
+        const Circuit circuit(num_qubits, {"Hadamard", "Rot", "CNOT", "RZ"},
+                              {{0}, {1}, {0, 2}, {2}},
+                              {false, false, false, true});
+        CHECK(circuit.getNumOps() == 4);
+        CHECK(circuit.getNumCompiledOps() == 4);
+        CHECK(circuit.getNumParams() == 4);
+        CHECK(circuit.getTape().getOps()[3].adjoint);
+    }
+    SECTION("Gates without parameters are fused") {
+        const Circuit circuit(
+            num_qubits,
+            {"Hadamard", "CNOT", "RX", "PauliX", "Identity", "S", "CZ"},
+            {{0}, {0, 1}, {1}, {2}, {}, {2}, {1, 2}},
+            {false, false, false, false, false, false, false}, {}, 2);
+        CHECK(circuit.getNumOps() == 7);
+        REQUIRE(circuit.getNumCompiledOps() == 3);
+        CHECK(circuit.getNumParams() == 1);
+
+        const auto &ops = circuit.getTape().getOps();
+        CHECK(ops[0].opcode == GateOp::Matrix);
+        CHECK(ops[1].opcode == GateOp::RX);
+        CHECK(ops[2].opcode == GateOp::Matrix);
+        // Matrix targets are reversed custatevec indices of wires {0, 1}
+        CHECK(circuit.getTape().getWires()[0] == 1);
+        CHECK(circuit.getTape().getWires()[1] == 2);
+
+        // CNOT (H x I), with wire 0 as the most significant bit
+        const TestType h = 1 / std::sqrt(TestType{2});
+        const std::vector<TestType> expected{h, 0, h, 0,  0, h, 0, h,
+                                             0, h, 0, -h, h, 0, -h, 0};
+        const auto &matrices = circuit.getTape().getMatrices();
+        REQUIRE(matrices.size() == 32);
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            CHECK(matrices[i].x == Approx(expected[i]).margin(1e-6));
+            CHECK(matrices[i].y == Approx(0).margin(1e-6));
+        }
+    }
+    SECTION("Single gates are kept") {
+        const Circuit circuit(num_qubits, {"Hadamard", "RX", "PauliY"},
+                              {{0}, {0}, {1}}, {false, false, true}, {}, 2);
+        const auto &ops = circuit.getTape().getOps();
+        REQUIRE(ops.size() == 3);
+        CHECK(ops[0].opcode == GateOp::Hadamard);
+        CHECK(ops[2].opcode == GateOp::PauliY);
+        CHECK(ops[2].adjoint);
+    }
+    SECTION("Explicit matrices") {
+        const std::vector<std::complex<TestType>> iswap{
+            {1, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 1}, {0, 0},
+            {0, 0}, {0, 1}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {1, 0}};
+        const Circuit fused(num_qubits, {"ISWAP", "PauliX"}, {{0, 1}, {1}},
+                            {false, false}, {iswap, {}}, 2);
+        CHECK(fused.getNumCompiledOps() == 1);
+        const Circuit kept(num_qubits, {"ISWAP", "PauliX"}, {{0, 1}, {1}},
+                           {false, false}, {iswap, {}});
+        CHECK(kept.getNumCompiledOps() == 2);
+        REQUIRE_THROWS_AS(Circuit(num_qubits, {"ISWAP"}, {{0, 1}}, {false}),
+                          LightningException);
+    }
+    SECTION("Invalid structures") {
+        REQUIRE_THROWS_AS(Circuit(num_qubits, {"RX"}, {}, {false}),
+                          LightningException);
+        REQUIRE_THROWS_AS(Circuit(num_qubits, {"RX"}, {{0}}, {}),
+                          LightningException);
+        REQUIRE_THROWS_AS(Circuit(num_qubits, {"CNOT"}, {{0, 3}}, {false}, {},
+                                  2),
+                          LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("CompiledCircuit::execute", "[CompiledCircuit]", float,
+                   double) {
+    CompiledCircuit<TestType> circuit(
+        2, {"RX", "Hadamard", "CNOT", "SingleExcitation"},
+        {{0}, {1}, {0, 1}, {0, 1}}, {false, false, false, false}, {}, 2);
+    REQUIRE(circuit.getNumParams() == 2);
+
+    TapeRecorder<TestType> sv;
+    circuit.execute(sv, {0.1, 0.2});
+    circuit.execute(sv, {0.3, 0.4});
+    REQUIRE(sv.params.size() == 2);
+    CHECK(sv.params[0] == std::vector<TestType>{0.1, 0.2});
+    CHECK(sv.params[1] == std::vector<TestType>{0.3, 0.4});
+
+    using CFP_t = typename GateTape<TestType>::CFP_t;
+    const auto expected = cuGates::getSingleExcitation<CFP_t>(TestType{0.4});
+    const auto &matrices = circuit.getTape().getMatrices();
+    REQUIRE(matrices.size() >= expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        const auto &value = matrices[matrices.size() - expected.size() + i];
+        CHECK(value.x == expected[i].x);
+        CHECK(value.y == expected[i].y);
+    }
+
+    REQUIRE_THROWS_AS(circuit.execute(sv, {0.1}), LightningException);
+}
+
+TEMPLATE_TEST_CASE("CompiledCircuit::execute device matrices",
+                   "[CompiledCircuit]", float, double) {
+    using CFP_t = typename GateTape<TestType>::CFP_t;
+    CompiledCircuit<TestType> circuit(
+        2, {"Hadamard", "CNOT", "SingleExcitation", "RX"},
+        {{1}, {0, 1}, {0, 1}, {0}}, {false, false, false, false}, {}, 2);
+    const std::size_t table_size = circuit.getTape().getMatrices().size();
+    // The fused block and the excitation
+    REQUIRE(table_size == 32);
+
+    TapeRecorder<TestType> sv;
+    circuit.execute(sv, {0.1, 0.2});
+    REQUIRE(sv.device_matrices.back() != nullptr);
+    auto stats = circuit.getMatrixStagingStats();
+    CHECK(stats.num_staged == 1);
+    CHECK(stats.bytes_staged == sizeof(CFP_t) * table_size);
+
+    // Later calls only rewrite the matrix of the excitation
+    circuit.execute(sv, {0.3, 0.4});
+    circuit.execute(sv, {0.5, 0.6});
+    CHECK(sv.device_matrices[2] == sv.device_matrices[0]);
+    stats = circuit.getMatrixStagingStats();
+    CHECK(stats.num_staged == 3);
+    CHECK(stats.bytes_staged == sizeof(CFP_t) * (table_size + 2 * 16));
+
+    std::vector<CFP_t> table(table_size);
+    PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+    PL_CUDA_IS_SUCCESS(cudaMemcpy(table.data(), sv.device_matrices[2],
+                                  sizeof(CFP_t) * table_size,
+                                  cudaMemcpyDeviceToHost));
+    const auto &matrices = circuit.getTape().getMatrices();
+    for (std::size_t i = 0; i < table_size; i++) {
+        CHECK(table[i].x == matrices[i].x);
+        CHECK(table[i].y == matrices[i].y);
+    }
+
+    SECTION("Tape without matrices") {
+        CompiledCircuit<TestType> rotations(2, {"RX", "CRZ"}, {{0}, {0, 1}},
+                                            {false, false});
+        rotations.execute(sv, {0.1, 0.2});
+        CHECK(sv.device_matrices.back() == nullptr);
+        CHECK(rotations.getMatrixStagingStats().num_staged == 0);
+    }
+}
+
+TEMPLATE_TEST_CASE("CompiledCircuit::executeGraph", "[CompiledCircuit]",
+                   float, double) {
+    CompiledCircuit<TestType> circuit(3, {"RX", "Hadamard", "CNOT", "CRZ"},
+                                      {{0}, {1}, {1, 2}, {0, 2}},
+                                      {false, false, false, true}, {}, 2);
+
+    TapeRecorder<TestType> sv;
+    circuit.executeGraph(sv, {0.1, 0.2});
+    circuit.executeGraph(sv, {0.3, 0.4});
+    REQUIRE(sv.params.size() == 2);
+    CHECK(sv.params[1] == std::vector<TestType>{0.3, 0.4});
+    // A single plan is built and reused by all executions
+    REQUIRE(sv.plan_ids.size() == 2);
+    CHECK(sv.plan_ids[0] == sv.plan_ids[1]);
+    CHECK(sv.plan_ids[0] == circuit.getGraphPlan().getId());
+    CHECK(circuit.getGraphPlan().getNodes().size() ==
+          circuit.getNumCompiledOps());
+}
@@ -0,0 +1,106 @@
+#include <complex>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DataBuffer.hpp"
+#include "cuda_helpers.hpp"
+
+#include <cuComplex.h>
+#include <cuda.h>
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+
+TEST_CASE("CublasHandleRegistry::getHandle", "[cuda_helpers]") {
+    auto &registry = cuUtil::CublasHandleRegistry::getInstance();
+    registry.clear();
+    REQUIRE(registry.getNumHandles() == 0);
+
+    cudaStream_t stream;
+    PL_CUDA_IS_SUCCESS(cudaStreamCreate(&stream));
+
+    SECTION("Handles are reused per device and stream") {
+        const auto created = registry.getNumCreated();
+        cublasHandle_t h_default = registry.getHandle(0, nullptr);
+        CHECK(registry.getHandle(0, nullptr) == h_default);
+        cublasHandle_t h_stream = registry.getHandle(0, stream);
+        CHECK(h_stream != h_default);
+        CHECK(registry.getHandle(0, stream) == h_stream);
+        CHECK(registry.getNumHandles() == 2);
+        CHECK(registry.getNumCreated() == created + 2);
+
+        registry.clear();
+        CHECK(registry.getNumHandles() == 0);
+        registry.getHandle(0, nullptr);
+        CHECK(registry.getNumCreated() == created + 3);
+    }
+    SECTION("Repeated helper calls share a handle") {
+        using cp_t = std::complex<double>;
+        const std::vector<cp_t> host{{1, 0}, {0, 1}, {1, 1}, {0, 0}};
+        DataBuffer<cuDoubleComplex, int> data(host.size(), 0, stream);
+        data.CopyHostDataToGpu(host.data(), host.size());
+        DataBuffer<cuDoubleComplex, int> other(host.size(), 0, stream);
+        other.CopyHostDataToGpu(host.data(), host.size());
+
+        const auto created = registry.getNumCreated();
+        for (std::size_t i = 0; i < 10; i++) {
+            const auto result = cuUtil::innerProdC_CUDA(
+                data.getData(), data.getData(),
+                static_cast<int>(data.getLength()), 0, stream);
+            CHECK(result.x == Approx(4.0));
+            CHECK(result.y == Approx(0.0).margin(1e-12));
+        }
+        cuUtil::scaleC_CUDA(cp_t{2, 0}, data.getData(),
+                            static_cast<int>(data.getLength()), 0, stream);
+        cuUtil::scaleAndAddC_CUDA(cp_t{-2, 0}, other.getData(), data.getData(),
+                                  static_cast<int>(data.getLength()), 0,
+                                  stream);
+        CHECK(registry.getNumCreated() == created + 1);
+        CHECK(registry.getNumHandles() == 1);
+
+        std::vector<cp_t> result(host.size());
+        data.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(std::vector<cp_t>(host.size())));
+    }
+
+    registry.clear();
+    PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream));
+}
+
+TEST_CASE("innerProdsC_CUDA", "[cuda_helpers]") {
+    using cp_t = std::complex<double>;
+    const std::size_t length = 4;
+    const std::vector<cp_t> host_mat{{1, 0}, {0, 1}, {1, 1}, {0, 0},
+                                     {0, 0}, {2, 0}, {0, -1}, {1, 0},
+                                     {1, 0}, {1, 0}, {1, 0}, {1, 0}};
+    const std::vector<cp_t> host_v{{0, 1}, {1, 0}, {0.5, 0}, {2, 1}};
+    const std::size_t num_vectors = host_mat.size() / length;
+
+    DataBuffer<cuDoubleComplex, int> mat(host_mat.size(), 0, nullptr);
+    mat.CopyHostDataToGpu(host_mat.data(), host_mat.size());
+    DataBuffer<cuDoubleComplex, int> v(length, 0, nullptr);
+    v.CopyHostDataToGpu(host_v.data(), host_v.size());
+    DataBuffer<cuDoubleComplex, int> result(num_vectors, 0, nullptr);
+
+    cuUtil::innerProdsC_CUDA(
+        cuUtil::CublasHandleRegistry::getInstance().getHandle(0, nullptr),
+        mat.getData(), v.getData(), result.getData(), static_cast<int>(length),
+        static_cast<int>(num_vectors));
+
+    std::vector<cp_t> expected(num_vectors);
+    for (std::size_t j = 0; j < num_vectors; j++) {
+        for (std::size_t i = 0; i < length; i++) {
+            expected[j] += std::conj(host_mat[j * length + i]) * host_v[i];
+        }
+    }
+    std::vector<cp_t> host_result(num_vectors);
+    result.CopyGpuDataToHost(host_result.data(), host_result.size());
+    CHECK(host_result == Pennylane::approx(expected));
+}
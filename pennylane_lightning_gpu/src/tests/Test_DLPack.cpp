@@ -0,0 +1,67 @@
+#include <complex>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include "DLPack.hpp"
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "cuda_helpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+
+TEST_CASE("DLPack data types", "[DLPack]") {
+    const auto dtype_c64 = getDLDataType<cuFloatComplex>();
+    CHECK(dtype_c64.code == kDLComplex);
+    CHECK(dtype_c64.bits == 64);
+    CHECK(dtype_c64.lanes == 1);
+    CHECK(getDLDataType<cuDoubleComplex>().bits == 128);
+
+    CHECK(std::string{getCudaArrayTypestr<cuFloatComplex>()} == "<c8");
+    CHECK(std::string{getCudaArrayTypestr<cuDoubleComplex>()} == "<c16");
+}
+
+TEST_CASE("DLPack stream handles", "[DLPack]") {
+    CHECK(streamToProtocol(nullptr) == 1);
+    CHECK(streamToProtocol(cudaStreamLegacy) == 1);
+    CHECK(streamToProtocol(cudaStreamPerThread) == 2);
+    CHECK(streamFromProtocol(1) == cudaStreamLegacy);
+    CHECK(streamFromProtocol(2) == cudaStreamPerThread);
+
+    cudaStream_t stream;
+    PL_CUDA_IS_SUCCESS(cudaStreamCreate(&stream));
+    CHECK(streamFromProtocol(streamToProtocol(stream)) == stream);
+    CHECK_NOTHROW(streamWaitFor(stream, nullptr, 0));
+    CHECK_NOTHROW(streamWaitFor(nullptr, stream, 0));
+    PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream));
+}
+
+TEMPLATE_TEST_CASE("makeDLManagedTensor", "[DLPack]", float, double) {
+    using CFP_t = decltype(cuUtil::getCudaType(TestType{}));
+    constexpr std::size_t length = 16;
+    DataBuffer<CFP_t, int> buffer(length, DevTag<int>{0, 0});
+
+    int num_releases = 0;
+    DLManagedTensor *managed = makeDLManagedTensor(
+        buffer.getData(), length, 0, &num_releases,
+        [](void *owner) { (*static_cast<int *>(owner))++; });
+
+    const DLTensor &tensor = managed->dl_tensor;
+    CHECK(tensor.data == buffer.getData());
+    CHECK(tensor.device.device_type == kDLCUDA);
+    CHECK(tensor.device.device_id == 0);
+    CHECK(tensor.ndim == 1);
+    CHECK(tensor.shape[0] == static_cast<std::int64_t>(length));
+    CHECK(tensor.strides == nullptr);
+    CHECK(tensor.byte_offset == 0);
+    CHECK(tensor.dtype.bits == 8 * sizeof(CFP_t));
+
+    CHECK(num_releases == 0);
+    managed->deleter(managed);
+    CHECK(num_releases == 1);
+}
@@ -65,6 +65,25 @@ TEMPLATE_TEST_CASE("DataBuffer::memory allocation", "[DataBuffer]", float,
         CHECK(data_buffer1.getStream() == 0);
         CHECK(data_buffer1.getDevice() == 0);
     }
+    SECTION("Non-owning view") {
+        DataBuffer<TestType, int> data_buffer1{8, 0, 0, true};
+        CHECK(data_buffer1.ownsMemory());
+        {
+            DataBuffer<TestType, int> view{data_buffer1.getData() + 4, 4,
+                                           data_buffer1.getDevTag()};
+            CHECK_FALSE(view.ownsMemory());
+            CHECK(view.getData() == data_buffer1.getData() + 4);
+            CHECK(view.getLength() == 4);
+
+            std::vector<TestType> host_data_in(4, 1);
+            view.CopyHostDataToGpu(host_data_in.data(), host_data_in.size());
+        }
+        // The view does not free the memory it refers to
+        std::vector<TestType> host_data_out(8, 0);
+        data_buffer1.CopyGpuDataToHost(host_data_out.data(), 8);
+        CHECK(std::count(host_data_out.begin() + 4, host_data_out.end(), 1) ==
+              4);
+    }
 }
 
 TEMPLATE_TEST_CASE("Data locality and movement", "[DataBuffer]", float,
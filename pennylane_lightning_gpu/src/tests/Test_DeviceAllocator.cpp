@@ -0,0 +1,221 @@
+#include <complex>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "DeviceAllocator.hpp"
+#include "cuda_helpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+
+TEST_CASE("CachingDeviceAllocator::getBinBytes", "[DeviceAllocator]") {
+    CHECK(CachingDeviceAllocator::getBinBytes(1) == 512);
+    CHECK(CachingDeviceAllocator::getBinBytes(512) == 512);
+    CHECK(CachingDeviceAllocator::getBinBytes(513) == 1024);
+    CHECK(CachingDeviceAllocator::getBinBytes(std::size_t{1} << 30) ==
+          std::size_t{1} << 30);
+
+    constexpr std::size_t MiB = std::size_t{1} << 20U;
+    CHECK(CachingDeviceAllocator::getBinBytes(MiB) == MiB);
+    CHECK(CachingDeviceAllocator::getBinBytes(MiB + 1) == 2 * MiB);
+    // Large requests are not inflated to a power of 2
+    CHECK(CachingDeviceAllocator::getBinBytes(5 * MiB + 1) == 6 * MiB);
+    CHECK(CachingDeviceAllocator::getBinBytes(48 * MiB) == 48 * MiB);
+    CHECK(CachingDeviceAllocator::getBinBytes(48 * MiB + 1) == 50 * MiB);
+    CHECK(CachingDeviceAllocator::getBinBytes(std::size_t{48} << 30U) ==
+          std::size_t{48} << 30U);
+}
+
+TEST_CASE("CachingDeviceAllocator::allocate", "[DeviceAllocator]") {
+    CachingDeviceAllocator allocator;
+
+    SECTION("Blocks of a size class are reused on the same stream") {
+        void *ptr = allocator.allocate(1000, 0, 0);
+        allocator.deallocate(ptr, 1000, 0, 0);
+        CHECK(allocator.getStats().bytes_cached == 1024);
+
+        void *reused = allocator.allocate(600, 0, 0);
+        CHECK(reused == ptr);
+        const auto stats = allocator.getStats();
+        CHECK(stats.num_requests == 2);
+        CHECK(stats.num_cache_hits == 1);
+        CHECK(stats.num_device_allocations == 1);
+        CHECK(stats.num_device_frees == 0);
+        CHECK(stats.bytes_in_use == 1024);
+        CHECK(stats.bytes_cached == 0);
+        allocator.deallocate(reused, 600, 0, 0);
+    }
+    SECTION("Other size classes allocate new blocks") {
+        void *small = allocator.allocate(256, 0, 0);
+        void *large = allocator.allocate(4096, 0, 0);
+        allocator.deallocate(small, 256, 0, 0);
+        void *larger = allocator.allocate(8192, 0, 0);
+        CHECK(larger != small);
+
+        const auto stats = allocator.getStats();
+        CHECK(stats.num_cache_hits == 0);
+        CHECK(stats.num_device_allocations == 3);
+        CHECK(stats.bytes_in_use == 4096 + 8192);
+        CHECK(stats.peak_bytes_in_use == 4096 + 8192);
+        allocator.deallocate(large, 4096, 0, 0);
+        allocator.deallocate(larger, 8192, 0, 0);
+    }
+    SECTION("Completed blocks are reused across streams") {
+        cudaStream_t stream;
+        PL_CUDA_IS_SUCCESS(cudaStreamCreate(&stream));
+        void *ptr = allocator.allocate(2048, 0, stream);
+        allocator.deallocate(ptr, 2048, 0, stream);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream));
+
+        CHECK(allocator.allocate(2048, 0, 0) == ptr);
+        CHECK(allocator.getStats().num_cache_hits == 1);
+        allocator.deallocate(ptr, 2048, 0, 0);
+        PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream));
+    }
+    SECTION("Cached blocks are released") {
+        allocator.deallocate(allocator.allocate(512, 0, 0), 512, 0, 0);
+        allocator.deallocate(allocator.allocate(2048, 0, 0), 2048, 0, 0);
+        allocator.releaseCached();
+
+        const auto stats = allocator.getStats();
+        CHECK(stats.bytes_cached == 0);
+        CHECK(stats.num_device_frees == 2);
+        void *ptr = allocator.allocate(512, 0, 0);
+        CHECK(allocator.getStats().num_device_allocations == 3);
+        allocator.deallocate(ptr, 512, 0, 0);
+    }
+    SECTION("Large requests allocate their size only") {
+        constexpr std::size_t MiB = std::size_t{1} << 20U;
+        void *ptr = allocator.allocate(5 * MiB + 3, 0, 0);
+        CHECK(allocator.getStats().bytes_in_use == 6 * MiB);
+        allocator.deallocate(ptr, 5 * MiB + 3, 0, 0);
+        CHECK(allocator.getStats().bytes_cached == 6 * MiB);
+    }
+    SECTION("Large requests reuse the best fitting block") {
+        constexpr std::size_t MiB = std::size_t{1} << 20U;
+        void *ptr_64 = allocator.allocate(64 * MiB, 0, 0);
+        void *ptr_40 = allocator.allocate(40 * MiB, 0, 0);
+        allocator.deallocate(ptr_64, 64 * MiB, 0, 0);
+        allocator.deallocate(ptr_40, 40 * MiB, 0, 0);
+
+        void *reused = allocator.allocate(38 * MiB, 0, 0);
+        CHECK(reused == ptr_40);
+        CHECK(allocator.getStats().bytes_in_use == 40 * MiB);
+        // The 64 MiB block wastes too much for a 32 MiB request
+        void *other = allocator.allocate(32 * MiB, 0, 0);
+        CHECK(other != ptr_64);
+        const auto stats = allocator.getStats();
+        CHECK(stats.num_cache_hits == 1);
+        CHECK(stats.num_device_allocations == 3);
+        CHECK(stats.bytes_cached == 64 * MiB);
+        allocator.deallocate(reused, 38 * MiB, 0, 0);
+        allocator.deallocate(other, 32 * MiB, 0, 0);
+    }
+    SECTION("Unknown pointers are rejected") {
+        int value = 0;
+        REQUIRE_THROWS_WITH(allocator.deallocate(&value, sizeof(int), 0, 0),
+                            Catch::Contains("not allocated by this"));
+    }
+}
+
+TEST_CASE("CachingDeviceAllocator cache limit", "[DeviceAllocator]") {
+    CachingDeviceAllocator allocator(1024);
+    void *ptr_a = allocator.allocate(1024, 0, 0);
+    void *ptr_b = allocator.allocate(1024, 0, 0);
+    allocator.deallocate(ptr_a, 1024, 0, 0);
+    CHECK(allocator.getStats().bytes_cached == 1024);
+    // Exceeding the limit frees the oldest block
+    allocator.deallocate(ptr_b, 1024, 0, 0);
+    auto stats = allocator.getStats();
+    CHECK(stats.bytes_cached == 1024);
+    CHECK(stats.num_device_frees == 1);
+    void *ptr_c = allocator.allocate(1024, 0, 0);
+    CHECK(ptr_c == ptr_b);
+    allocator.deallocate(ptr_c, 1024, 0, 0);
+
+    SECTION("Largest size classes are freed first") {
+        CachingDeviceAllocator trimmed(4096);
+        void *ptr_small = trimmed.allocate(512, 0, 0);
+        void *ptr_large = trimmed.allocate(4096, 0, 0);
+        trimmed.deallocate(ptr_small, 512, 0, 0);
+        trimmed.deallocate(ptr_large, 4096, 0, 0);
+        stats = trimmed.getStats();
+        CHECK(stats.bytes_cached == 512);
+        CHECK(stats.num_device_frees == 1);
+        void *ptr_reused = trimmed.allocate(512, 0, 0);
+        CHECK(ptr_reused == ptr_small);
+        trimmed.deallocate(ptr_reused, 512, 0, 0);
+    }
+    SECTION("The default limit is finite") {
+        CHECK(CachingDeviceAllocator::getDefaultMaxCachedBytes() <
+              std::numeric_limits<std::size_t>::max());
+        CHECK(CachingDeviceAllocator{}.getMaxCachedBytes() ==
+              CachingDeviceAllocator::getDefaultMaxCachedBytes());
+    }
+    SECTION("The default limit is read from the environment") {
+        setenv("PL_GPU_MAX_CACHED_BYTES", "2048", 1);
+        CHECK(CachingDeviceAllocator::getDefaultMaxCachedBytes() == 2048);
+        setenv("PL_GPU_MAX_CACHED_BYTES", "2kB", 1);
+        REQUIRE_THROWS_WITH(
+            static_cast<void>(
+                CachingDeviceAllocator::getDefaultMaxCachedBytes()),
+            Catch::Contains("number of bytes"));
+        unsetenv("PL_GPU_MAX_CACHED_BYTES");
+    }
+}
+
+TEMPLATE_TEST_CASE("DataBuffer allocators", "[DeviceAllocator]", float,
+                   double) {
+    using CFP_t = decltype(cuUtil::getCudaType(TestType{}));
+    const DevTag<int> dev_tag{0, 0};
+
+    SECTION("Buffers return their memory to the allocator") {
+        auto allocator = std::make_shared<CachingDeviceAllocator>();
+        const CFP_t *first_data = nullptr;
+        {
+            DataBuffer<CFP_t, int> buffer(64, dev_tag, allocator);
+            first_data = buffer.getData();
+            CHECK(buffer.getAllocator() == allocator);
+            CHECK(allocator->getStats().bytes_in_use ==
+                  CachingDeviceAllocator::getBinBytes(64 * sizeof(CFP_t)));
+        }
+        CHECK(allocator->getStats().bytes_in_use == 0);
+
+        DataBuffer<CFP_t, int> buffer(64, dev_tag, allocator);
+        CHECK(buffer.getData() == first_data);
+        CHECK(allocator->getStats().num_cache_hits == 1);
+    }
+    SECTION("The default allocator can be replaced") {
+        auto previous = DeviceAllocator::getDefault();
+        auto allocator = std::make_shared<CudaMallocAllocator>();
+        DeviceAllocator::setDefault(allocator);
+        {
+            DataBuffer<CFP_t, int> buffer(64, dev_tag);
+            CHECK(buffer.getAllocator() == allocator);
+        }
+        const auto stats = allocator->getStats();
+        CHECK(stats.num_device_allocations == 1);
+        CHECK(stats.num_device_frees == 1);
+        CHECK(stats.bytes_in_use == 0);
+        DeviceAllocator::setDefault(previous);
+        CHECK(DeviceAllocator::getDefault() == previous);
+    }
+    SECTION("Views do not allocate") {
+        auto allocator = std::make_shared<CachingDeviceAllocator>();
+        DataBuffer<CFP_t, int> buffer(64, dev_tag, allocator);
+        {
+            DataBuffer<CFP_t, int> view(buffer.getData(), 32, dev_tag);
+        }
+        CHECK(allocator->getStats().num_requests == 1);
+        CHECK(allocator->getStats().bytes_cached == 0);
+    }
+}
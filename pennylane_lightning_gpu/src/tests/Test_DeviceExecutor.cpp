@@ -0,0 +1,85 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DeviceExecutor.hpp"
+#include "DevicePool.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+struct Counter {
+    std::size_t count{0};
+};
+} // namespace
+
+TEST_CASE("DeviceExecutor::submit", "[DeviceExecutor]") {
+    const std::size_t num_devices = DevicePool<int>::getTotalDevices();
+    DeviceExecutor<int> executor(num_devices);
+    REQUIRE(executor.getNumWorkers() == num_devices);
+
+    SECTION("Tasks run on every device index once queued") {
+        const std::size_t num_tasks = 8 * num_devices;
+        std::atomic<std::size_t> num_run{0};
+        std::atomic<std::size_t> num_wrong_device{0};
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 0; i < num_tasks; i++) {
+            futures.emplace_back(executor.submit([&](int dev_id) {
+                int current = -1;
+                PL_CUDA_IS_SUCCESS(cudaGetDevice(&current));
+                if (current != dev_id) {
+                    num_wrong_device++;
+                }
+                num_run++;
+            }));
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+        CHECK(num_run == num_tasks);
+        CHECK(num_wrong_device == 0);
+
+        std::size_t num_started = 0;
+        for (std::size_t d = 0; d < num_devices; d++) {
+            num_started += executor.getNumTasksStarted(static_cast<int>(d));
+        }
+        CHECK(num_started == num_tasks);
+    }
+    SECTION("Exceptions are stored in the future") {
+        auto future = executor.submit(
+            [](int) { throw std::runtime_error("Task failure"); });
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+        // The worker survives a failed task
+        executor.submit([](int) {}).get();
+    }
+    SECTION("Local state persists across tasks") {
+        DeviceExecutor<int> single(1);
+        for (std::size_t i = 0; i < 5; i++) {
+            single
+                .submit([&](int dev_id) {
+                    single.getLocalState<Counter>(dev_id).count++;
+                })
+                .get();
+        }
+        std::size_t count = 0;
+        single
+            .submit([&](int dev_id) {
+                count = single.getLocalState<Counter>(dev_id).count;
+            })
+            .get();
+        CHECK(count == 5);
+        CHECK(single.getNumTasksStarted(0) == 6);
+
+        single.clearLocalState();
+        single
+            .submit([&](int dev_id) {
+                count = single.getLocalState<Counter>(dev_id).count;
+            })
+            .get();
+        CHECK(count == 0);
+    }
+}
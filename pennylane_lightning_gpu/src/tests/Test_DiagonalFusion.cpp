@@ -0,0 +1,120 @@
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DiagonalFusion.hpp"
+#include "GateFusion.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+/**
+ * @brief Extract the diagonal of a dense row-major matrix.
+ */
+template <class T>
+auto diagonalOf(const std::vector<std::complex<T>> &mat)
+    -> std::vector<std::complex<T>> {
+    const auto dim = static_cast<std::size_t>(std::sqrt(mat.size()));
+    std::vector<std::complex<T>> diag(dim);
+    for (std::size_t i = 0; i < dim; i++) {
+        diag[i] = mat[i * dim + i];
+    }
+    return diag;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("DiagonalFusion::getGateDiagonal", "[DiagonalFusion]",
+                   float, double) {
+    const std::vector<std::pair<std::string, std::size_t>> gates{
+        {"PauliZ", 1},  {"S", 1},       {"T", 1},
+        {"RZ", 1},      {"PhaseShift", 1}, {"CZ", 2},
+        {"CRZ", 2},     {"IsingZZ", 2},    {"ControlledPhaseShift", 2},
+        {"MultiRZ", 3}};
+    const std::vector<TestType> params{0.3};
+
+    SECTION("Matches the dense gate matrices") {
+        for (const auto &[name, num_wires] : gates) {
+            for (const bool adjoint : {false, true}) {
+                CAPTURE(name, adjoint);
+                REQUIRE(DiagonalFusion<TestType>::isDiagonal(name));
+                const auto diag = DiagonalFusion<TestType>::getGateDiagonal(
+                    name, num_wires, params, adjoint);
+                const auto mat = GateFusion<TestType>::getGateMatrix(
+                    name, num_wires, params, adjoint);
+                CHECK(diag == Pennylane::approx(diagonalOf(mat)));
+            }
+        }
+    }
+    SECTION("Non-diagonal gates and invalid arguments") {
+        CHECK_FALSE(DiagonalFusion<TestType>::isDiagonal("Hadamard"));
+        CHECK(DiagonalFusion<TestType>::getGateDiagonal("Hadamard", 1, {},
+                                                        false)
+                  .empty());
+        CHECK(DiagonalFusion<TestType>::getGateDiagonal("RZ", 1, {}, false)
+                  .empty());
+        CHECK(DiagonalFusion<TestType>::getGateDiagonal("CZ", 1, {}, false)
+                  .empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("DiagonalFusion::tryFuse", "[DiagonalFusion]", float,
+                   double) {
+    using cp_t = std::complex<TestType>;
+    const TestType angle = 0.6;
+
+    SECTION("Folded run matches the fused dense matrix") {
+        DiagonalFusion<TestType> folded(4);
+        GateFusion<TestType> fusion(4);
+        const std::vector<std::pair<std::string, std::vector<std::size_t>>>
+            ops{{"IsingZZ", {0, 1}},
+                {"IsingZZ", {2, 1}},
+                {"RZ", {3}},
+                {"ControlledPhaseShift", {3, 0}},
+                {"T", {2}}};
+        for (const auto &[name, wires] : ops) {
+            REQUIRE(folded.tryFuse(DiagonalFusion<TestType>::getGateDiagonal(
+                                       name, wires.size(), {angle}, false),
+                                   wires));
+            REQUIRE(fusion.tryFuse(GateFusion<TestType>::getGateMatrix(
+                                       name, wires.size(), {angle}, false),
+                                   wires));
+        }
+        CHECK(folded.getNumGates() == ops.size());
+        CHECK(folded.getWires() == fusion.getWires());
+        CHECK(folded.getDiagonal() ==
+              Pennylane::approx(diagonalOf(fusion.getMatrix())));
+    }
+    SECTION("Gate and adjoint cancel") {
+        DiagonalFusion<TestType> folded(2);
+        REQUIRE(folded.tryFuse(DiagonalFusion<TestType>::getGateDiagonal(
+                                   "MultiRZ", 2, {angle}, false),
+                               {0, 1}));
+        REQUIRE(folded.tryFuse(DiagonalFusion<TestType>::getGateDiagonal(
+                                   "MultiRZ", 2, {angle}, true),
+                               {1, 0}));
+        const std::vector<cp_t> expected(4, {1, 0});
+        CHECK(folded.getDiagonal() == Pennylane::approx(expected));
+    }
+    SECTION("Block size limit") {
+        DiagonalFusion<TestType> folded(2);
+        const auto CZ =
+            DiagonalFusion<TestType>::getGateDiagonal("CZ", 2, {}, false);
+        const auto Z =
+            DiagonalFusion<TestType>::getGateDiagonal("PauliZ", 1, {}, false);
+        REQUIRE(folded.tryFuse(CZ, {0, 1}));
+        CHECK_FALSE(folded.tryFuse(Z, {2}));
+        CHECK(folded.getNumGates() == 1);
+        folded.clear();
+        CHECK(folded.empty());
+        CHECK(folded.tryFuse(Z, {2}));
+    }
+    SECTION("Invalid block sizes") {
+        REQUIRE_THROWS_AS(DiagonalFusion<TestType>(0), LightningException);
+        REQUIRE_THROWS_AS(DiagonalFusion<TestType>(21), LightningException);
+    }
+}
@@ -42,4 +42,97 @@ TEMPLATE_TEST_CASE("CuGateCache", "[CuGateCache]", float, double) {
             CHECK(H_host[i].y == Approx(H_transfer[i].imag()).epsilon(1e-7));
         }
     }
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("CuGateCache LRU eviction", "[CuGateCache]", float,
+                   double) {
+    using cp_dev_t = decltype(cuUtil::getCudaType(TestType{}));
+    GateCache<TestType> gc(true);
+    const std::size_t num_default = gc.getNumGates();
+    const std::size_t default_bytes = gc.getAllocatedBytes();
+    const std::size_t gate_bytes = 4 * sizeof(cp_dev_t);
+    gc.setCapacity(3 * gate_bytes);
+
+    const auto add_rx = [&gc](TestType angle) {
+        gc.add_gate("RX", angle, cuGates::getRX<cp_dev_t>(angle));
+        return gc.get_gate_device_ptr("RX", angle);
+    };
+
+    SECTION("Capacity bounds the cached parametric gates") {
+        for (std::size_t i = 0; i < 5; i++) {
+            add_rx(static_cast<TestType>(0.1 * (i + 1)));
+        }
+        CHECK(gc.getNumGates() == num_default + 3);
+        CHECK(gc.getAllocatedBytes() == default_bytes + 3 * gate_bytes);
+        CHECK(gc.getNumMisses() == 5);
+        CHECK(gc.getNumHits() == 0);
+        CHECK(gc.getNumEvictions() == 2);
+        CHECK_FALSE(gc.gateExists("RX", static_cast<TestType>(0.1)));
+        CHECK(gc.gateExists("RX", static_cast<TestType>(0.5)));
+        // default gates are never evicted
+        CHECK(gc.gateExists("Hadamard", 0.0));
+    }
+    SECTION("Lookups refresh the eviction order") {
+        const auto a = static_cast<TestType>(0.1);
+        const auto b = static_cast<TestType>(0.2);
+        const auto c = static_cast<TestType>(0.3);
+        add_rx(a);
+        add_rx(b);
+        add_rx(c);
+        gc.get_gate_device_ptr("RX", a);
+        CHECK(gc.getNumHits() == 1);
+        add_rx(static_cast<TestType>(0.4));
+        CHECK(gc.gateExists("RX", a));
+        CHECK_FALSE(gc.gateExists("RX", b));
+        CHECK(gc.gateExists("RX", c));
+    }
+    SECTION("Gates larger than the capacity are kept until the next add") {
+        gc.setCapacity(gate_bytes / 2);
+        add_rx(static_cast<TestType>(0.1));
+        CHECK(gc.gateExists("RX", static_cast<TestType>(0.1)));
+        add_rx(static_cast<TestType>(0.2));
+        CHECK_FALSE(gc.gateExists("RX", static_cast<TestType>(0.1)));
+        CHECK(gc.getNumEvictions() == 1);
+    }
+    SECTION("Clear keeps the default gate-set") {
+        add_rx(static_cast<TestType>(0.1));
+        add_rx(static_cast<TestType>(0.2));
+        gc.clear();
+        CHECK(gc.getNumGates() == num_default);
+        CHECK(gc.getAllocatedBytes() == default_bytes);
+        CHECK(gc.gateExists("PauliX", 0.0));
+    }
+}
+
+TEMPLATE_TEST_CASE("CuGateCache shared default gate-set", "[CuGateCache]",
+                   float, double) {
+    using cp_dev_t = decltype(cuUtil::getCudaType(TestType{}));
+    GateCache<TestType> gc0(true);
+    GateCache<TestType> gc1(true);
+
+    SECTION("Default gates are shared between caches") {
+        CHECK(gc0.get_gate_device_ptr("Hadamard", 0.0) ==
+              gc1.get_gate_device_ptr("Hadamard", 0.0));
+        CHECK(gc0.get_gate_device_ptr("CNOT", 0.0) ==
+              gc1.get_gate_device_ptr("CNOT", 0.0));
+        CHECK(gc0.getAllocatedBytes() == 0);
+        CHECK(SharedGateTable<TestType>::getInstance(0)->getNumGates() ==
+              gc0.getNumGates());
+    }
+    SECTION("Added gates are private to each cache") {
+        const auto angle = static_cast<TestType>(0.3);
+        gc0.add_gate("RY", angle, cuGates::getRY<cp_dev_t>(angle));
+        CHECK(gc0.gateExists("RY", angle));
+        CHECK_FALSE(gc1.gateExists("RY", angle));
+        CHECK(gc0.getNumGates() == gc1.getNumGates() + 1);
+    }
+    SECTION("Default gates cannot be overwritten") {
+        REQUIRE_THROWS_AS(
+            gc0.add_gate("PauliX", 0.0, cuGates::getPauliX<cp_dev_t>()),
+            LightningException);
+    }
+    SECTION("Caches without the default gate-set") {
+        GateCache<TestType> gc_empty(false);
+        CHECK(gc_empty.getNumGates() == 0);
+        CHECK_FALSE(gc_empty.gateExists("PauliX", 0.0));
+    }
+}
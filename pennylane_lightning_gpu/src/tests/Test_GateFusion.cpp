@@ -0,0 +1,144 @@
+#include <complex>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "GateFusion.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+TEMPLATE_TEST_CASE("GateFusion::getGateMatrix", "[GateFusion]", float,
+                   double) {
+    using cp_t = std::complex<TestType>;
+
+    SECTION("Known gates") {
+        const auto mat =
+            GateFusion<TestType>::getGateMatrix("PauliY", 1, {}, false);
+        const std::vector<cp_t> expected{{0, 0}, {0, -1}, {0, 1}, {0, 0}};
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("T") {
+        const auto mat = GateFusion<TestType>::getGateMatrix("T", 1, {}, false);
+        const std::vector<cp_t> expected{
+            {1, 0}, {0, 0}, {0, 0}, std::exp(cp_t{0, M_PI / 4})};
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("CRZ") {
+        const TestType angle = 0.4;
+        const auto mat =
+            GateFusion<TestType>::getGateMatrix("CRZ", 2, {angle}, false);
+        std::vector<cp_t> expected(16, {0, 0});
+        expected[0] = expected[5] = {1, 0};
+        expected[10] = std::exp(cp_t{0, -angle / 2});
+        expected[15] = std::exp(cp_t{0, angle / 2});
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("SingleExcitation wire ordering") {
+        const TestType angle = 0.4;
+        const auto mat = GateFusion<TestType>::getGateMatrix(
+            "SingleExcitation", 2, {angle}, false);
+        const cp_t c{std::cos(angle / 2), 0};
+        const cp_t s{std::sin(angle / 2), 0};
+        const std::vector<cp_t> expected{{1, 0}, {0, 0}, {0, 0}, {0, 0},
+                                         {0, 0}, c,      -s,     {0, 0},
+                                         {0, 0}, s,      c,      {0, 0},
+                                         {0, 0}, {0, 0}, {0, 0}, {1, 0}};
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("Adjoint") {
+        const auto mat =
+            GateFusion<TestType>::getGateMatrix("S", 1, {}, true);
+        const std::vector<cp_t> expected{{1, 0}, {0, 0}, {0, 0}, {0, -1}};
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("MultiRZ") {
+        const TestType angle = 0.4;
+        const auto mat =
+            GateFusion<TestType>::getGateMatrix("MultiRZ", 2, {angle}, false);
+        const cp_t even{std::cos(angle / 2), -std::sin(angle / 2)};
+        const cp_t odd{std::cos(angle / 2), std::sin(angle / 2)};
+        const std::vector<cp_t> expected{even,   {0, 0}, {0, 0}, {0, 0},
+                                         {0, 0}, odd,    {0, 0}, {0, 0},
+                                         {0, 0}, {0, 0}, odd,    {0, 0},
+                                         {0, 0}, {0, 0}, {0, 0}, even};
+        CHECK(mat == Pennylane::approx(expected));
+    }
+    SECTION("Unknown gates and missing parameters") {
+        CHECK(GateFusion<TestType>::getGateMatrix("QFT", 2, {}, false)
+                  .empty());
+        CHECK(GateFusion<TestType>::getGateMatrix("RX", 1, {}, false).empty());
+        CHECK(GateFusion<TestType>::getGateMatrix("Rot", 1, {0.1}, false)
+                  .empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("GateFusion::tryFuse", "[GateFusion]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using Fusion = GateFusion<TestType>;
+    const auto H = Fusion::getGateMatrix("Hadamard", 1, {}, false);
+    const auto X = Fusion::getGateMatrix("PauliX", 1, {}, false);
+    const auto Z = Fusion::getGateMatrix("PauliZ", 1, {}, false);
+    const auto CNOT = Fusion::getGateMatrix("CNOT", 2, {}, false);
+
+    SECTION("Single wire run") {
+        GateFusion<TestType> fusion(2);
+        CHECK(fusion.empty());
+        REQUIRE(fusion.tryFuse(H, {0}));
+        REQUIRE(fusion.tryFuse(Z, {0}));
+        REQUIRE(fusion.tryFuse(H, {0}));
+        CHECK(fusion.getNumGates() == 3);
+        CHECK(fusion.getWires() == std::vector<size_t>{0});
+        // HZH = X
+        CHECK(fusion.getMatrix() == Pennylane::approx(X));
+    }
+    SECTION("Wire ordering of expanded blocks") {
+        GateFusion<TestType> fusion(2);
+        REQUIRE(fusion.tryFuse(X, {1}));
+        REQUIRE(fusion.tryFuse(Z, {0}));
+        CHECK(fusion.getWires() == std::vector<size_t>{1, 0});
+        // X on the most significant wire, Z on the least significant one
+        const std::vector<cp_t> expected{{0, 0}, {0, 0}, {1, 0},  {0, 0},
+                                         {0, 0}, {0, 0}, {0, 0},  {-1, 0},
+                                         {1, 0}, {0, 0}, {0, 0},  {0, 0},
+                                         {0, 0}, {-1, 0}, {0, 0}, {0, 0}};
+        CHECK(fusion.getMatrix() == Pennylane::approx(expected));
+    }
+    SECTION("Gate on reversed block wires") {
+        GateFusion<TestType> fusion(2);
+        REQUIRE(fusion.tryFuse(CNOT, {1, 0}));
+        REQUIRE(fusion.tryFuse(CNOT, {0, 1}));
+        REQUIRE(fusion.tryFuse(CNOT, {1, 0}));
+        const auto SWAP =
+            GateFusion<TestType>::getGateMatrix("SWAP", 2, {}, false);
+        CHECK(fusion.getMatrix() == Pennylane::approx(SWAP));
+    }
+    SECTION("Gate and adjoint cancel") {
+        GateFusion<TestType> fusion(1);
+        const std::vector<TestType> params{0.1, 0.2, 0.3};
+        REQUIRE(fusion.tryFuse(
+            GateFusion<TestType>::getGateMatrix("Rot", 1, params, false),
+            {0}));
+        REQUIRE(fusion.tryFuse(
+            GateFusion<TestType>::getGateMatrix("Rot", 1, params, true), {0}));
+        const auto I =
+            GateFusion<TestType>::getGateMatrix("Identity", 1, {}, false);
+        CHECK(fusion.getMatrix() == Pennylane::approx(I).margin(1e-6));
+    }
+    SECTION("Block size limit") {
+        GateFusion<TestType> fusion(2);
+        REQUIRE(fusion.tryFuse(CNOT, {0, 1}));
+        CHECK_FALSE(fusion.tryFuse(H, {2}));
+        CHECK(fusion.getNumGates() == 1);
+        CHECK(fusion.getWires() == std::vector<size_t>{0, 1});
+        fusion.clear();
+        CHECK(fusion.empty());
+        CHECK(fusion.tryFuse(H, {2}));
+    }
+    SECTION("Invalid block sizes") {
+        REQUIRE_THROWS_AS(GateFusion<TestType>(0), LightningException);
+        REQUIRE_THROWS_AS(GateFusion<TestType>(7), LightningException);
+    }
+}
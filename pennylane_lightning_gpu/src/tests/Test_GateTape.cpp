@@ -0,0 +1,213 @@
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "GateTape.hpp"
+#include "JacobianTape.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+/**
+ * @brief Compare two host arrays of CUDA complex values exactly.
+ */
+template <class CFP_t>
+bool sameValues(const std::vector<CFP_t> &lhs, const std::vector<CFP_t> &rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i].x != rhs[i].x || lhs[i].y != rhs[i].y) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("GateTape::lookupGateOp", "[GateTape]") {
+    CHECK(lookupGateOp("CNOT") == GateOp::CNOT);
+    CHECK(lookupGateOp("I") == GateOp::Identity);
+    CHECK(lookupGateOp("MultiRZ") == GateOp::MultiRZ);
+    CHECK(lookupGateOp("QubitUnitary") == GateOp::Matrix);
+}
+
+TEMPLATE_TEST_CASE("GateTape::GateTape", "[GateTape]", float, double) {
+    using Tape = GateTape<TestType>;
+    using cp_t = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+
+    SECTION("Wire encoding") {
+        const Tape tape(num_qubits, {"RX", "CNOT", "Toffoli", "CSWAP", "SWAP"},
+                        {{1}, {0, 2}, {3, 1, 0}, {2, 0, 3}, {1, 3}},
+                        {false, false, false, false, false},
+                        {{0.3}, {}, {}, {}, {}});
+        REQUIRE(tape.getNumOps() == 5);
+        const auto &ops = tape.getOps();
+        CHECK(ops[0].opcode == GateOp::RX);
+        CHECK(ops[0].num_ctrls == 0);
+        CHECK(ops[1].num_ctrls == 1);
+        CHECK(ops[1].num_tgts == 1);
+        CHECK(ops[2].num_ctrls == 2);
+        CHECK(ops[3].num_ctrls == 1);
+        CHECK(ops[3].num_tgts == 2);
+        // custatevec indices, controls first
+        const std::vector<std::int32_t> expected{2, 3, 1, 0, 2, 3,
+                                                 1, 3, 0, 2, 0};
+        CHECK(tape.getWires() == expected);
+        CHECK(ops[4].wire_offset == 9);
+    }
+    SECTION("Matrix targets are reversed") {
+        const std::vector<cp_t> mat(16, {1, 0});
+        const Tape tape(num_qubits, {"QubitUnitary"}, {{0, 2}}, {true}, {{}},
+                        {mat});
+        CHECK(tape.getOps()[0].opcode == GateOp::Matrix);
+        CHECK(tape.getOps()[0].adjoint);
+        CHECK(tape.getWires() == std::vector<std::int32_t>{1, 3});
+        CHECK(tape.getMatrices().size() == 16);
+    }
+    SECTION("Parameter slots") {
+        Tape tape(num_qubits, {"Rot", "Hadamard", "SingleExcitation", "RZ"},
+                  {{0}, {1}, {0, 1}, {2}}, {false, false, false, true},
+                  {{0.1, 0.2, 0.3}, {}, {0.4}, {0.5}});
+        const auto &ops = tape.getOps();
+        CHECK(ops[0].param_offset == 0);
+        CHECK(ops[2].param_offset == 3);
+        CHECK(ops[3].param_offset == 4);
+        CHECK(tape.getParameters() ==
+              std::vector<TestType>{0.1, 0.2, 0.3, 0.4, 0.5});
+
+        using CFP_t = typename Tape::CFP_t;
+        CHECK(sameValues(tape.getMatrices(),
+                         cuGates::getSingleExcitation<CFP_t>(TestType{0.4})));
+        tape.setParameters({0.0, 0.0, 0.0, 1.2, 0.0});
+        CHECK(tape.getParameters()[3] == TestType{1.2});
+        CHECK(sameValues(tape.getMatrices(),
+                         cuGates::getSingleExcitation<CFP_t>(TestType{1.2})));
+        REQUIRE_THROWS_AS(tape.setParameters({0.1}), LightningException);
+    }
+    SECTION("Invalid operations") {
+        REQUIRE_THROWS_AS(Tape(num_qubits, {"QFT"}, {{0, 1}}, {false}, {{}}),
+                          LightningException);
+        REQUIRE_THROWS_AS(Tape(num_qubits, {"RX"}, {{0}}, {false}, {{}}),
+                          LightningException);
+        REQUIRE_THROWS_AS(Tape(num_qubits, {"CNOT"}, {{0}}, {false}, {{}}),
+                          LightningException);
+        REQUIRE_THROWS_AS(Tape(num_qubits, {"PauliX"}, {{4}}, {false}, {{}}),
+                          LightningException);
+    }
+    SECTION("From OpsData") {
+        const Algorithms::OpsData<TestType> ops{
+            {"QubitStateVector", "RY", "CZ"},
+            {{}, {0.7}, {}},
+            {{0, 1}, {1}, {1, 2}},
+            {false, false, false},
+            {{}, {}, {}}};
+        const auto tape = Tape::fromOpsData(num_qubits, ops);
+        REQUIRE(tape.getNumOps() == 3);
+        CHECK(tape.getOps()[0].opcode == GateOp::Identity);
+        CHECK(tape.getOps()[1].opcode == GateOp::RY);
+        CHECK(tape.getOps()[2].opcode == GateOp::CZ);
+        CHECK(tape.getParameters() == std::vector<TestType>{0.7});
+    }
+}
+
+TEST_CASE("GateTape::getGateOpName", "[GateTape]") {
+    CHECK(getGateOpName(GateOp::Identity) == "Identity");
+    CHECK(getGateOpName(GateOp::CRot) == "CRot");
+    CHECK(getGateOpName(GateOp::Matrix) == "Matrix");
+    for (const auto &[name, opcode] : getGateOps()) {
+        CHECK(lookupGateOp(getGateOpName(opcode)) == opcode);
+    }
+}
+
+TEMPLATE_TEST_CASE("GateTape::unpackOperations", "[GateTape]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const std::size_t num_qubits = 3;
+    const auto code = [](GateOp op) { return static_cast<std::uint8_t>(op); };
+
+    SECTION("Gates are decoded by opcode") {
+        const std::vector<std::uint8_t> opcodes{
+            code(GateOp::RX), code(GateOp::CNOT), code(GateOp::Matrix),
+            code(GateOp::Rot), code(GateOp::Matrix)};
+        const std::vector<std::size_t> wire_offsets{0, 1, 3, 4, 5, 7};
+        const std::vector<std::size_t> wires{2, 0, 1, 1, 0, 2, 0};
+        const bool adjoints[] = {true, false, false, false, true};
+        const std::vector<TestType> params{0.1, 0.2, 0.3, 0.4};
+        std::vector<cp_t> matrices(4 + 16);
+        matrices[0] = {1, 0};
+        matrices[4] = {2, 0};
+
+        const auto tape = unpackOperations<TestType>(
+            num_qubits, opcodes.data(), opcodes.size(), wire_offsets.data(),
+            wires.data(), adjoints, params.data(), params.size(),
+            matrices.data(), matrices.size());
+        REQUIRE(tape.getNumOps() == 5);
+        const auto &ops = tape.getOps();
+        CHECK(ops[0].opcode == GateOp::RX);
+        CHECK(ops[0].adjoint);
+        CHECK(tape.getOpWires(0) == std::vector<std::size_t>{2});
+        CHECK(ops[1].opcode == GateOp::CNOT);
+        CHECK(ops[1].num_ctrls == 1);
+        CHECK(tape.getOpWires(1) == std::vector<std::size_t>{0, 1});
+
+        CHECK(ops[2].opcode == GateOp::Matrix);
+        CHECK(tape.getOpWires(2) == std::vector<std::size_t>{1});
+        CHECK(tape.getMatrices()[ops[2].matrix_offset].x == 1);
+
+        CHECK(ops[3].opcode == GateOp::Rot);
+        CHECK(tape.getParameters() == params);
+        CHECK(ops[3].param_offset == 1);
+
+        CHECK(ops[4].adjoint);
+        CHECK(tape.getOpWires(4) == std::vector<std::size_t>{2, 0});
+        REQUIRE(tape.getMatrices().size() == 4 + 16);
+        CHECK(tape.getMatrices()[ops[4].matrix_offset].x == 2);
+    }
+    SECTION("Empty circuit") {
+        const std::size_t wire_offsets[] = {0};
+        CHECK(unpackOperations<TestType>(num_qubits, nullptr, 0, wire_offsets,
+                                         nullptr, nullptr, nullptr, 0,
+                                         nullptr, 0)
+                  .getNumOps() == 0);
+    }
+    SECTION("Invalid operations") {
+        const std::size_t wires[] = {0, 1, 3};
+        const bool adjoints[] = {false, false};
+        const TestType params[] = {0.1, 0.2};
+        const cp_t matrix[4] = {};
+        const auto unpack = [&](std::uint8_t opcode,
+                                std::vector<std::size_t> wire_offsets,
+                                std::size_t num_params,
+                                std::size_t num_matrix_elements) {
+            return unpackOperations<TestType>(
+                num_qubits, &opcode, 1, wire_offsets.data(), wires, adjoints,
+                params, num_params, matrix, num_matrix_elements);
+        };
+        CHECK_NOTHROW(unpack(code(GateOp::RX), {0, 1}, 1, 0));
+        // Unknown opcode
+        REQUIRE_THROWS_AS(unpack(code(GateOp::Matrix) + 1, {0, 1}, 0, 0),
+                          LightningException);
+        // Invalid wires
+        REQUIRE_THROWS_AS(unpack(code(GateOp::MultiRZ), {0, 3}, 1, 0),
+                          LightningException);
+        REQUIRE_THROWS_AS(unpack(code(GateOp::PauliX), {1, 2}, 0, 0),
+                          LightningException);
+        REQUIRE_THROWS_AS(unpack(code(GateOp::CNOT), {0, 1}, 0, 0),
+                          LightningException);
+        // Missing and unused parameters
+        REQUIRE_THROWS_AS(unpack(code(GateOp::RX), {0, 1}, 0, 0),
+                          LightningException);
+        REQUIRE_THROWS_AS(unpack(code(GateOp::RX), {0, 1}, 2, 0),
+                          LightningException);
+        // Matrix of the wrong size
+        REQUIRE_THROWS_AS(unpack(code(GateOp::Matrix), {0, 2}, 0, 4),
+                          LightningException);
+    }
+}
@@ -49,6 +49,15 @@ TEMPLATE_TEST_CASE("ObservablesGPU::NamedObsGPU", "[ObservablesGPU]", float,
         CHECK(obs2.getObsName() == "RX[1]");
         CHECK(obs3.getObsName() == "UnsupportedObs[2, 3]");
     }
+    SECTION("NamedObsGPU<TestType>::appendPauliWord") {
+        std::string pauli_word = "Z";
+        std::vector<size_t> wires{0};
+        CHECK(obs1.appendPauliWord(pauli_word, wires));
+        CHECK(pauli_word == "ZX");
+        CHECK(wires == std::vector<size_t>{0, 3});
+        CHECK_FALSE(obs2.appendPauliWord(pauli_word, wires));
+        CHECK_FALSE(obs3.appendPauliWord(pauli_word, wires));
+    }
     SECTION("NamedObsGPU<TestType>::applyInPlace") {
         StateVectorCudaManaged<TestType> sv(4);
         sv.initSV();
@@ -209,6 +218,18 @@ TEMPLATE_TEST_CASE("ObservablesGPU::TensorProdObsGPU", "[ObservablesGPU]",
         CHECK(tp_obs3.getWires() == std::vector<size_t>{1, 3});
         CHECK_THROWS(TensorProdObsGPU<TestType>{obs1, obs1});
     }
+    SECTION("TensorProdObsGPU<TestType>::appendPauliWord") {
+        std::shared_ptr<NamedObsGPU<TestType>> obs5(
+            new NamedObsGPU<TestType>("PauliY", {0}, {}));
+        std::string pauli_word;
+        std::vector<size_t> wires;
+        CHECK(TensorProdObsGPU<TestType>{obs3, obs5}.appendPauliWord(pauli_word,
+                                                                     wires));
+        CHECK(pauli_word == "XY");
+        CHECK(wires == std::vector<size_t>{3, 0});
+        CHECK_FALSE(tp_obs2.appendPauliWord(pauli_word, wires));
+        CHECK_FALSE(tp_obs3.appendPauliWord(pauli_word, wires));
+    }
 
     SECTION("TensorProdObsGPU<TestType>::applyInPlace") {
         StateVectorCudaManaged<TestType> sv(4);
@@ -298,6 +319,17 @@ TEMPLATE_TEST_CASE("ObservablesGPU::HamiltonianGPU", "[ObservablesGPU]", float,
         CHECK(ham_1.getWires() == std::vector<size_t>{0, 2});
         CHECK(ham_2.getWires() == std::vector<size_t>{0, 2, 3});
     }
+    SECTION("HamiltonianGPU<TestType>::getNumScratchStates") {
+        // The accumulator, plus the scratch copy for the Hermitian terms
+        CHECK(HamiltonianGPU<TestType>{
+                  std::vector<TestType>{0.3, 0.4},
+                  std::vector<std::shared_ptr<ObservableGPU<TestType>>>{
+                      obs2, tp_obs2}}
+                  .getNumScratchStates() == 1);
+        CHECK(ham_1.getNumScratchStates() == 2);
+        CHECK(ham_2.getNumScratchStates() == 2);
+        CHECK(tp_obs1->getNumScratchStates() == 0);
+    }
     SECTION("HamiltonianGPU<TestType>::obsName") {
         std::ostringstream res1, res2;
         res1 << "Hamiltonian: { 'coeffs' : [0.165, 0.13, 0.5423], "
@@ -349,4 +381,111 @@ TEMPLATE_TEST_CASE("ObservablesGPU::HamiltonianGPU", "[ObservablesGPU]", float,
             CHECK(host_array[i].imag() == Approx(res2[i].imag()));
         }
     }
+
+    SECTION("HamiltonianGPU<TestType>::applyInPlace with Pauli words") {
+        std::shared_ptr<NamedObsGPU<TestType>> y0(
+            new NamedObsGPU<TestType>("PauliY", {0}, {}));
+        std::shared_ptr<NamedObsGPU<TestType>> z1(
+            new NamedObsGPU<TestType>("PauliZ", {1}, {}));
+        std::shared_ptr<NamedObsGPU<TestType>> y3(
+            new NamedObsGPU<TestType>("PauliY", {3}, {}));
+        std::shared_ptr<NamedObsGPU<TestType>> id2(
+            new NamedObsGPU<TestType>("Identity", {2}, {}));
+        const std::vector<TestType> coeffs{0.3, -0.7, 1.1, 0.45, 0.2};
+        const std::vector<std::shared_ptr<ObservableGPU<TestType>>> terms{
+            y0, TensorProdObsGPU<TestType>::create({obs2, z1, y3}),
+            TensorProdObsGPU<TestType>::create({y0, id2}), tp_obs1, obs1};
+        HamiltonianGPU<TestType> ham{coeffs, terms};
+
+        StateVectorCudaManaged<TestType> sv(4);
+        sv.initSV();
+        sv.applyOperation({"RX", "RY", "CNOT", "RX", "RZ"},
+                          {{0}, {1}, {1, 3}, {2}, {3}},
+                          {false, false, false, false, false},
+                          {{0.3}, {0.7}, {}, {1.2}, {0.4}});
+
+        // Apply each term to its own copy of the state
+        std::vector<std::complex<TestType>> expected(16, {0, 0});
+        std::vector<std::complex<TestType>> host_array(16, {0, 0});
+        for (std::size_t t = 0; t < terms.size(); t++) {
+            StateVectorCudaManaged<TestType> tmp(sv);
+            terms[t]->applyInPlace(tmp);
+            tmp.getDataBuffer().CopyGpuDataToHost(host_array.data(),
+                                                  host_array.size());
+            for (std::size_t i = 0; i < expected.size(); i++) {
+                expected[i] += coeffs[t] * host_array[i];
+            }
+        }
+
+        // The accumulator and scratch state are reused by a second call
+        StateVectorCudaManaged<TestType> sv_copy(sv);
+        ham.applyInPlace(sv);
+        ham.applyInPlace(sv_copy);
+        sv.getDataBuffer().CopyGpuDataToHost(host_array.data(),
+                                             host_array.size());
+        CHECK(host_array == Pennylane::approx(expected).margin(1e-5));
+        ham.applyInPlace(sv_copy);
+        ham.applyInPlace(sv);
+        std::vector<std::complex<TestType>> host_copy(16, {0, 0});
+        sv_copy.getDataBuffer().CopyGpuDataToHost(host_copy.data(),
+                                                  host_copy.size());
+        sv.getDataBuffer().CopyGpuDataToHost(host_array.data(),
+                                             host_array.size());
+        CHECK(host_array == Pennylane::approx(host_copy).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("ObservablesGPU::SparseHamiltonianGPU", "[ObservablesGPU]",
+                   float, double) {
+    using ComplexT = std::complex<TestType>;
+    using IdxT = typename SparseHamiltonianGPU<TestType>::IdxT;
+
+    // diag(1, 2, 3, 4) in CSR format
+    SparseHamiltonianGPU<TestType> sparse_h{
+        std::vector<ComplexT>{{1, 0}, {2, 0}, {3, 0}, {4, 0}},
+        std::vector<IdxT>{0, 1, 2, 3}, std::vector<IdxT>{0, 1, 2, 3, 4},
+        std::vector<std::size_t>{0, 1}};
+
+    SECTION("SparseHamiltonianGPU<TestType> binary ops") {
+        CHECK(sparse_h ==
+              SparseHamiltonianGPU<TestType>{
+                  std::vector<ComplexT>{{1, 0}, {2, 0}, {3, 0}, {4, 0}},
+                  std::vector<IdxT>{0, 1, 2, 3},
+                  std::vector<IdxT>{0, 1, 2, 3, 4},
+                  std::vector<std::size_t>{0, 1}});
+        CHECK(sparse_h !=
+              SparseHamiltonianGPU<TestType>{
+                  std::vector<ComplexT>{{1, 0}, {2, 0}, {3, 0}, {5, 0}},
+                  std::vector<IdxT>{0, 1, 2, 3},
+                  std::vector<IdxT>{0, 1, 2, 3, 4},
+                  std::vector<std::size_t>{0, 1}});
+    }
+
+    SECTION("SparseHamiltonianGPU<TestType>::getNumScratchStates") {
+        CHECK(sparse_h.getNumScratchStates() == 1);
+    }
+
+    SECTION("SparseHamiltonianGPU<TestType>::applyInPlace") {
+        StateVectorCudaManaged<TestType> sv(2);
+        sv.initSV();
+        sv.applyHadamard({0}, false);
+        sv.applyHadamard({1}, false);
+
+        // Copies of the observable share the device copy of the matrix
+        const auto sparse_h_copy = sparse_h;
+        const auto workspace_bytes = sv.getWorkspaceHighWaterMark();
+        sparse_h.applyInPlace(sv);
+        sparse_h_copy.applyInPlace(sv);
+        CHECK(&sparse_h.getMatrix() == &sparse_h_copy.getMatrix());
+        CHECK(sparse_h.getMatrix().getNumUploads() == 1);
+        // H|psi> is kept out of the gate workspace
+        CHECK(sv.getWorkspaceHighWaterMark() == workspace_bytes);
+
+        std::vector<ComplexT> host_array(4, {0, 0});
+        sv.getDataBuffer().CopyGpuDataToHost(host_array.data(),
+                                             host_array.size());
+        const std::vector<ComplexT> expected{
+            {0.5, 0}, {2.0, 0}, {4.5, 0}, {8.0, 0}};
+        CHECK(host_array == Pennylane::approx(expected));
+    }
 }
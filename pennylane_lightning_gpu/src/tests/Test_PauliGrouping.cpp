@@ -0,0 +1,189 @@
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "PauliGrouping.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane::CUDA;
+
+namespace {
+/**
+ * @brief Check that the groups cover each word once, and that the words of
+ * each group act with the basis of the group on the wires of their mask.
+ */
+void checkGroups(const std::vector<PauliWordGroup> &groups,
+                 const std::vector<std::string> &words,
+                 const std::vector<std::vector<std::size_t>> &tgts) {
+    std::vector<std::size_t> seen(words.size(), 0);
+    for (const auto &group : groups) {
+        REQUIRE(group.terms.size() == group.masks.size());
+        REQUIRE(group.wires.size() == group.bases.size());
+        for (std::size_t k = 0; k < group.terms.size(); k++) {
+            const auto term = group.terms[k];
+            seen[term]++;
+            std::size_t mask = 0;
+            for (std::size_t j = 0; j < words[term].size(); j++) {
+                if (words[term][j] == 'I') {
+                    continue;
+                }
+                std::size_t i = 0;
+                while (i < group.wires.size() &&
+                       group.wires[i] != tgts[term][j]) {
+                    i++;
+                }
+                REQUIRE(i < group.wires.size());
+                CHECK(group.bases[i] == words[term][j]);
+                mask |= std::size_t{1} << i;
+            }
+            CHECK(group.masks[k] == mask);
+        }
+    }
+    CHECK(seen == std::vector<std::size_t>(words.size(), 1));
+}
+} // namespace
+
+TEST_CASE("groupQubitWiseCommuting", "[PauliGrouping]") {
+    SECTION("Commuting words share a group") {
+        const std::vector<std::string> words{"ZZ", "Z", "XX", "ZI", "X", "Y"};
+        const std::vector<std::vector<std::size_t>> tgts{{0, 1}, {2}, {0, 1},
+                                                         {1, 3}, {2}, {0}};
+        const auto groups = groupQubitWiseCommuting(words, tgts, 20);
+        checkGroups(groups, words, tgts);
+        REQUIRE(groups.size() == 3);
+        CHECK(groups[0].terms == std::vector<std::size_t>{0, 1, 3});
+        CHECK(groups[0].wires == std::vector<std::size_t>{0, 1, 2});
+        CHECK(groups[0].bases == std::vector<char>{'Z', 'Z', 'Z'});
+        CHECK(groups[1].terms == std::vector<std::size_t>{2, 4});
+        CHECK(groups[1].bases == std::vector<char>{'X', 'X', 'X'});
+        CHECK(groups[2].terms == std::vector<std::size_t>{5});
+    }
+    SECTION("Identity words") {
+        const std::vector<std::string> words{"I", "X", "II", ""};
+        const std::vector<std::vector<std::size_t>> tgts{
+            {0}, {0}, {1, 2}, {}};
+        const auto groups = groupQubitWiseCommuting(words, tgts, 20);
+        checkGroups(groups, words, tgts);
+        REQUIRE(groups.size() == 2);
+        CHECK(groups[1].wires.empty());
+        CHECK(groups[1].terms == std::vector<std::size_t>{0, 2, 3});
+    }
+    SECTION("Groups are bounded in wires") {
+        const std::vector<std::string> words{"ZZ", "ZZ", "ZZZ", "Z"};
+        const std::vector<std::vector<std::size_t>> tgts{
+            {0, 1}, {2, 3}, {4, 5, 6}, {7}};
+        const auto groups = groupQubitWiseCommuting(words, tgts, 2);
+        checkGroups(groups, words, tgts);
+        REQUIRE(groups.size() == 4);
+        // The heavier word is alone and exceeds the bound
+        CHECK(groups[0].terms == std::vector<std::size_t>{2});
+        CHECK(groups[0].wires.size() == 3);
+        for (std::size_t i = 1; i < groups.size(); i++) {
+            CHECK(groups[i].wires.size() <= 2);
+        }
+    }
+    SECTION("Random words") {
+        const std::vector<char> paulis{'I', 'X', 'Y', 'Z'};
+        std::vector<std::string> words;
+        std::vector<std::vector<std::size_t>> tgts;
+        for (std::size_t term = 0; term < 200; term++) {
+            std::string word;
+            std::vector<std::size_t> wires;
+            for (std::size_t wire = 0; wire < 6; wire++) {
+                const char pauli = paulis[(term * 7 + wire * 3 + term / 5) % 4];
+                if (pauli != 'I' || wire % 2 == 0) {
+                    word.push_back(pauli);
+                    wires.push_back(wire);
+                }
+            }
+            words.push_back(word);
+            tgts.push_back(wires);
+        }
+        const auto groups = groupQubitWiseCommuting(words, tgts, 20);
+        checkGroups(groups, words, tgts);
+        CHECK(groups.size() < words.size() / 4);
+    }
+    SECTION("Invalid words") {
+        using Catch::Matchers::Contains;
+        REQUIRE_THROWS_WITH(groupQubitWiseCommuting({"XY"}, {{0}}, 20),
+                            Contains("different lengths"));
+        REQUIRE_THROWS_WITH(groupQubitWiseCommuting({"XA"}, {{0, 1}}, 20),
+                            Contains("Invalid Pauli operator A"));
+        REQUIRE_THROWS_WITH(groupQubitWiseCommuting({"XZ"}, {{1, 1}}, 20),
+                            Contains("more than once"));
+        REQUIRE_THROWS_WITH(groupQubitWiseCommuting({"X", "Z"}, {{0}}, 20),
+                            Contains("number of Pauli words"));
+    }
+}
+
+TEST_CASE("parityExpectation", "[PauliGrouping]") {
+    const std::vector<double> probabilities{0.1, 0.2, 0.3, 0.4};
+    CHECK(parityExpectation(probabilities, 0) == Approx(1.0));
+    // Bit 0
+    CHECK(parityExpectation(probabilities, 1) == Approx(0.1 - 0.2 + 0.3 - 0.4));
+    // Bit 1
+    CHECK(parityExpectation(probabilities, 2) == Approx(0.1 + 0.2 - 0.3 - 0.4));
+    CHECK(parityExpectation(probabilities, 3) == Approx(0.1 - 0.2 - 0.3 + 0.4));
+}
+
+TEST_CASE("getPauliWordMasks", "[PauliGrouping]") {
+    using ComplexT = std::complex<double>;
+    const std::size_t num_qubits = 3;
+
+    const std::vector<std::string> words{"X", "YZ", "ZIY", "XYZ", "YY"};
+    const std::vector<std::vector<std::size_t>> tgts{
+        {1}, {0, 2}, {2, 1, 0}, {0, 1, 2}, {2, 1}};
+    for (std::size_t term = 0; term < words.size(); term++) {
+        const auto masks =
+            getPauliWordMasks(words[term], tgts[term], num_qubits);
+        ComplexT phase{1, 0};
+        for (std::size_t k = 0; k < masks.num_y; k++) {
+            phase *= ComplexT{0, 1};
+        }
+        for (std::size_t i = 0; i < (std::size_t{1} << num_qubits); i++) {
+            // Apply the factors of the word one at a time
+            std::size_t index = i;
+            ComplexT amplitude{1, 0};
+            for (std::size_t j = 0; j < words[term].size(); j++) {
+                const std::size_t bit = std::size_t{1}
+                                        << (num_qubits - 1 - tgts[term][j]);
+                const bool set = (index & bit) != 0;
+                switch (words[term][j]) {
+                case 'X':
+                    index ^= bit;
+                    break;
+                case 'Y':
+                    amplitude *= set ? ComplexT{0, -1} : ComplexT{0, 1};
+                    index ^= bit;
+                    break;
+                case 'Z':
+                    amplitude *= set ? -1.0 : 1.0;
+                    break;
+                default:
+                    break;
+                }
+            }
+            const double sign =
+                (std::popcount(i & masks.z_mask) % 2 == 0) ? 1.0 : -1.0;
+            CHECK((i ^ masks.x_mask) == index);
+            CHECK(sign * phase == amplitude);
+        }
+    }
+
+    SECTION("Invalid words") {
+        using Catch::Matchers::Contains;
+        REQUIRE_THROWS_WITH(getPauliWordMasks("XA", {0, 1}, 2),
+                            Contains("Invalid Pauli operator A"));
+        REQUIRE_THROWS_WITH(getPauliWordMasks("XZ", {1, 1}, 2),
+                            Contains("more than once"));
+        REQUIRE_THROWS_WITH(getPauliWordMasks("X", {2}, 2),
+                            Contains("out of range"));
+        REQUIRE_THROWS_WITH(getPauliWordMasks("XZ", {1}, 2),
+                            Contains("different lengths"));
+    }
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Philox.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane::CUDA;
+
+TEST_CASE("Philox4x32::generate", "[Philox]") {
+    // Known-answer vectors of Random123
+    CHECK(Philox4x32::generate({0, 0, 0, 0}, {0, 0}) ==
+          Philox4x32::Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    CHECK(Philox4x32::generate({0xffffffff, 0xffffffff, 0xffffffff,
+                                0xffffffff},
+                               {0xffffffff, 0xffffffff}) ==
+          Philox4x32::Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    CHECK(Philox4x32::generate({0x243f6a88, 0x85a308d3, 0x13198a2e,
+                                0x03707344},
+                               {0xa4093822, 0x299f31d0}) ==
+          Philox4x32::Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Philox4x32::fillUniform", "[Philox]") {
+    SECTION("Seeded streams are reproduced") {
+        Philox4x32 rng0(1234);
+        Philox4x32 rng1(1234);
+        Philox4x32 rng2(4321);
+        std::vector<double> rand0(101);
+        std::vector<double> rand1(101);
+        std::vector<double> rand2(101);
+        rng0.fillUniform(rand0.data(), rand0.size());
+        rng1.fillUniform(rand1.data(), rand1.size());
+        rng2.fillUniform(rand2.data(), rand2.size());
+        CHECK(rand0 == rand1);
+        CHECK(rand0 != rand2);
+        CHECK(rng0.getCounter() == 51);
+
+        // Later calls continue the stream, until it is seeded again
+        rng0.fillUniform(rand0.data(), rand0.size());
+        CHECK(rand0 != rand1);
+        rng0.setSeed(1234);
+        rng0.fillUniform(rand0.data(), rand0.size());
+        CHECK(rand0 == rand1);
+    }
+    SECTION("Values are uniform in [0, 1)") {
+        Philox4x32 rng(7);
+        std::vector<double> rand(100000);
+        rng.fillUniform(rand.data(), rand.size());
+
+        double mean = 0;
+        for (const auto value : rand) {
+            mean += value / rand.size();
+        }
+        CHECK(*std::min_element(rand.begin(), rand.end()) >= 0);
+        CHECK(*std::max_element(rand.begin(), rand.end()) < 1);
+        CHECK(mean == Approx(0.5).margin(0.01));
+    }
+    SECTION("Blocks depend only on the seed and the counter") {
+        Philox4x32 rng(99);
+        std::vector<double> rand(6);
+        rng.fillUniform(rand.data(), 2);
+        rng.fillUniform(rand.data(), rand.size());
+        const auto bits = rng.block(1);
+        CHECK(rand[0] == ((bits[0] >> 5U) * 67108864.0 + (bits[1] >> 6U)) /
+                             9007199254740992.0);
+    }
+}
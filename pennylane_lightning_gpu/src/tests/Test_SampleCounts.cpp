@@ -0,0 +1,60 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "SampleCounts.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane::CUDA;
+
+TEST_CASE("countSamples", "[SampleCounts]") {
+    SECTION("Sorted samples") {
+        const std::vector<std::int64_t> samples{0, 0, 3, 5, 5, 5, 7};
+        auto &&[outcomes, counts] = countSamples(samples);
+        CHECK(outcomes == std::vector<std::int64_t>{0, 3, 5, 7});
+        CHECK(counts == std::vector<std::size_t>{2, 1, 3, 1});
+    }
+    SECTION("Unsorted samples") {
+        const std::vector<std::int64_t> samples{5, 0, 7, 5, 3, 0, 5};
+        auto &&[outcomes, counts] = countSamples(samples);
+        CHECK(outcomes == std::vector<std::int64_t>{0, 3, 5, 7});
+        CHECK(counts == std::vector<std::size_t>{2, 1, 3, 1});
+    }
+    SECTION("No samples") {
+        auto &&[outcomes, counts] = countSamples(std::vector<std::int64_t>{});
+        CHECK(outcomes.empty());
+        CHECK(counts.empty());
+    }
+    SECTION("Random samples") {
+        std::mt19937 gen(1337);
+        std::uniform_int_distribution<std::int64_t> dis(0, 15);
+        std::vector<std::int64_t> samples(1000);
+        std::vector<std::size_t> histogram(16, 0);
+        for (auto &sample : samples) {
+            sample = dis(gen);
+            histogram[sample]++;
+        }
+        auto &&[outcomes, counts] = countSamples(samples);
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < outcomes.size(); i++) {
+            CHECK(counts[i] == histogram[outcomes[i]]);
+            total += counts[i];
+        }
+        CHECK(total == samples.size());
+    }
+}
+
+TEST_CASE("unpackSamples", "[SampleCounts]") {
+    const std::vector<std::int64_t> samples{1, 1, 4, 6, 6};
+    const auto bits = unpackSamples(samples, 3);
+    // Qubit 0 is the most significant bit
+    const std::vector<std::size_t> expected{0, 0, 1, 0, 0, 1, 1, 0, 0,
+                                            1, 1, 0, 1, 1, 0};
+    CHECK(bits == expected);
+    CHECK(unpackSamples(std::vector<std::int64_t>{}, 3).empty());
+}
@@ -0,0 +1,229 @@
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ShardLayout.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+using ComplexT = std::complex<double>;
+using Matrix2 = std::vector<ComplexT>;
+
+/**
+ * @brief Apply a 2x2 matrix to the qubit of an index bit of a host vector.
+ */
+void applyMatrixHost(std::vector<ComplexT> &data, std::size_t bit,
+                     const Matrix2 &matrix) {
+    const std::size_t mask = std::size_t{1} << bit;
+    for (std::size_t i = 0; i < data.size(); i++) {
+        if ((i & mask) == 0) {
+            const ComplexT v0 = data[i];
+            const ComplexT v1 = data[i | mask];
+            data[i] = matrix[0] * v0 + matrix[1] * v1;
+            data[i | mask] = matrix[2] * v0 + matrix[3] * v1;
+        }
+    }
+}
+
+/**
+ * @brief Apply a CNOT to the qubits of two index bits of a host vector.
+ */
+void applyCNOTHost(std::vector<ComplexT> &data, std::size_t ctrl,
+                   std::size_t tgt) {
+    const std::size_t ctrl_mask = std::size_t{1} << ctrl;
+    const std::size_t tgt_mask = std::size_t{1} << tgt;
+    for (std::size_t i = 0; i < data.size(); i++) {
+        if ((i & ctrl_mask) != 0 && (i & tgt_mask) == 0) {
+            std::swap(data[i], data[i | tgt_mask]);
+        }
+    }
+}
+
+/**
+ * @brief Probabilities of the given index bits of a host vector, the first
+ * bit being the most significant of the outcome.
+ */
+auto probabilitiesHost(const std::vector<ComplexT> &data,
+                       const std::vector<std::size_t> &bits)
+    -> std::vector<double> {
+    std::vector<double> probs(std::size_t{1} << bits.size(), 0.0);
+    for (std::size_t i = 0; i < data.size(); i++) {
+        std::size_t outcome = 0;
+        for (const auto bit : bits) {
+            outcome = (outcome << 1U) | ((i >> bit) & 1U);
+        }
+        probs[outcome] += std::norm(data[i]);
+    }
+    return probs;
+}
+
+/**
+ * @brief Split a host vector into shards along its upper index bits.
+ */
+auto splitHost(const std::vector<ComplexT> &data, std::size_t num_shards)
+    -> std::vector<std::vector<ComplexT>> {
+    const std::size_t length = data.size() / num_shards;
+    std::vector<std::vector<ComplexT>> shards;
+    for (std::size_t s = 0; s < num_shards; s++) {
+        shards.emplace_back(data.begin() + s * length,
+                            data.begin() + (s + 1) * length);
+    }
+    return shards;
+}
+
+/**
+ * @brief Gather emulated shards in the logical ordering.
+ */
+auto gatherHost(const std::vector<std::vector<ComplexT>> &shards,
+                const ShardLayout &layout) -> std::vector<ComplexT> {
+    std::vector<ComplexT> data(std::size_t{1} << layout.getNumQubits());
+    for (std::size_t i = 0; i < data.size(); i++) {
+        const auto [shard, offset] = layout.locate(i);
+        data[i] = shards[shard][offset];
+    }
+    return data;
+}
+} // namespace
+
+TEST_CASE("ShardLayout::ShardLayout", "[ShardLayout]") {
+    SECTION("Identity placement") {
+        const ShardLayout layout(5, 4);
+        CHECK(layout.getNumQubits() == 5);
+        CHECK(layout.getNumShards() == 4);
+        CHECK(layout.getNumGlobalQubits() == 2);
+        CHECK(layout.getNumLocalQubits() == 3);
+        for (std::size_t bit = 0; bit < 5; bit++) {
+            CHECK(layout.getPhysicalBit(bit) == bit);
+            CHECK(layout.isLocal(bit) == (bit < 3));
+        }
+        using Location = std::pair<std::size_t, std::size_t>;
+        CHECK(layout.locate(0b10110) == Location{2, 6});
+    }
+    SECTION("A single shard holds every bit") {
+        ShardLayout layout(3, 1);
+        CHECK(layout.getNumGlobalQubits() == 0);
+        CHECK(layout.localize({0, 1, 2}).empty());
+    }
+    SECTION("Invalid shard counts") {
+        REQUIRE_THROWS_WITH(ShardLayout(5, 3),
+                            Catch::Contains("power of 2"));
+        REQUIRE_THROWS_WITH(ShardLayout(2, 4),
+                            Catch::Contains("at least one qubit"));
+    }
+}
+
+TEST_CASE("ShardLayout::localize", "[ShardLayout]") {
+    ShardLayout layout(5, 4);
+
+    SECTION("Local bits need no swap") {
+        CHECK(layout.localize({0, 2}).empty());
+        CHECK(layout.getNumSwaps() == 0);
+    }
+    SECTION("Least recently used local bits are swapped out") {
+        CHECK(layout.localize({0}).empty());
+        CHECK(layout.localize({2}).empty());
+        // Bit 1 was never used, then bit 0 is the least recent
+        const auto swaps = layout.localize({3, 4});
+        REQUIRE(swaps.size() == 2);
+        CHECK(swaps[0] == ShardLayout::BitSwap{1, 3});
+        CHECK(swaps[1] == ShardLayout::BitSwap{0, 4});
+        CHECK(layout.isLocal(3));
+        CHECK(layout.isLocal(4));
+        CHECK(layout.isLocal(2));
+        CHECK_FALSE(layout.isLocal(0));
+        CHECK_FALSE(layout.isLocal(1));
+        CHECK(layout.getNumSwaps() == 2);
+    }
+    SECTION("Targets are never swapped out") {
+        const auto swaps = layout.localize({0, 1, 4});
+        REQUIRE(swaps.size() == 1);
+        CHECK(swaps[0] == ShardLayout::BitSwap{2, 4});
+        for (const auto bit : {0, 1, 4}) {
+            CHECK(layout.isLocal(bit));
+        }
+    }
+    SECTION("Gates larger than a shard") {
+        REQUIRE_THROWS_WITH(layout.localize({0, 1, 2, 3}),
+                            Catch::Contains("more qubits than a shard"));
+    }
+}
+
+TEST_CASE("ShardLayout::getLocalWires", "[ShardLayout]") {
+    ShardLayout layout(5, 2);
+    CHECK(layout.getLocalWires({4, 0}) == std::vector<std::size_t>{3});
+
+    // Bit 4 replaces bit 0, the least recently used, at physical position 0
+    CHECK(layout.localize({4}) ==
+          std::vector<ShardLayout::BitSwap>{ShardLayout::BitSwap{0, 4}});
+    CHECK(layout.localize({3}).empty());
+    CHECK(layout.localize({2}).empty());
+    CHECK(layout.getLocalPositions({4, 3, 2}) ==
+          std::vector<std::size_t>{0, 3, 2});
+    CHECK(layout.getLocalWires({4, 3, 2}) ==
+          std::vector<std::size_t>{3, 0, 1});
+    CHECK(layout.getLocalWires({0, 4}) == std::vector<std::size_t>{3});
+    CHECK(layout.getLocalWires({0}).empty());
+}
+
+TEST_CASE("ShardLayout emulated shards", "[ShardLayout]") {
+    constexpr std::size_t num_qubits = 6;
+    std::mt19937 re{1337};
+
+    for (const std::size_t num_shards : {1, 2, 4, 8}) {
+        DYNAMIC_SECTION("Shards - " << num_shards) {
+            ShardLayout layout(num_qubits, num_shards);
+            const std::size_t num_local = layout.getNumLocalQubits();
+
+            auto expected = createRandomState<double>(re, num_qubits);
+            auto shards = splitHost(expected, num_shards);
+
+            std::uniform_real_distribution<double> dist(-1.0, 1.0);
+            const std::vector<std::size_t> targets{5, 0, 4, 5, 3, 1, 2, 4};
+            for (const auto bit : targets) {
+                Matrix2 matrix(4);
+                for (auto &value : matrix) {
+                    value = {dist(re), dist(re)};
+                }
+                applyMatrixHost(expected, bit, matrix);
+
+                swapIndexBitsHost(shards, layout.localize({bit}), num_local);
+                for (auto &shard : shards) {
+                    applyMatrixHost(shard, layout.getPhysicalBit(bit), matrix);
+                }
+                CHECK(gatherHost(shards, layout) == approx(expected));
+            }
+
+            applyCNOTHost(expected, 5, 4);
+            swapIndexBitsHost(shards, layout.localize({5, 4}), num_local);
+            for (auto &shard : shards) {
+                applyCNOTHost(shard, layout.getPhysicalBit(5),
+                              layout.getPhysicalBit(4));
+            }
+            CHECK(gatherHost(shards, layout) == approx(expected));
+
+            // Marginals after the swaps, with the shards addressed by wire as
+            // the devices are
+            for (const auto &prob_bits :
+                 {std::vector<std::size_t>{5, 1, 3},
+                  std::vector<std::size_t>{4, 0}, std::vector<std::size_t>{2},
+                  std::vector<std::size_t>{0, 1, 2, 3, 4, 5}}) {
+                std::vector<std::size_t> shard_bits;
+                for (const auto wire : layout.getLocalWires(prob_bits)) {
+                    shard_bits.push_back(num_local - 1 - wire);
+                }
+                std::vector<std::vector<double>> shard_probs;
+                for (const auto &shard : shards) {
+                    shard_probs.push_back(probabilitiesHost(shard, shard_bits));
+                }
+                CHECK(layout.reduceProbabilities(prob_bits, shard_probs) ==
+                      approx(probabilitiesHost(expected, prob_bits)));
+            }
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "StagingPool.hpp"
+#include "StateVectorCudaManaged.hpp"
+#include "cuda_helpers.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+TEST_CASE("StagingPool round trips", "[StagingPool]") {
+    constexpr std::size_t block_bytes = 1024;
+    constexpr std::size_t num_bytes = 300;
+    StagingPool pool(0, block_bytes);
+    DataBuffer<std::int8_t, int> buffer(4 * num_bytes, DevTag<int>{0, 0});
+
+    std::vector<std::int8_t> host_in(4 * num_bytes);
+    std::iota(host_in.begin(), host_in.end(), 0);
+
+    SECTION("Copies share a block until it is full") {
+        for (std::size_t i = 0; i < 4; i++) {
+            pool.copyHostToDevice(buffer.getData() + i * num_bytes,
+                                  host_in.data() + i * num_bytes, num_bytes);
+        }
+        std::vector<std::int8_t> host_out(4 * num_bytes, 0);
+        buffer.CopyGpuDataToHost(host_out.data(), host_out.size());
+        CHECK(host_out == host_in);
+
+        // Copies are 256-byte aligned, so three fit in a block
+        const auto stats = pool.getStats();
+        CHECK(stats.num_staged == 4);
+        CHECK(stats.num_direct == 0);
+        CHECK(stats.num_blocks == 2);
+        CHECK(stats.bytes_staged == 4 * num_bytes);
+    }
+    SECTION("The source can be overwritten once the call returns") {
+        std::vector<std::int8_t> source(host_in.begin(),
+                                        host_in.begin() + num_bytes);
+        pool.copyHostToDevice(buffer.getData(), source.data(), num_bytes);
+        std::fill(source.begin(), source.end(), 0);
+
+        std::vector<std::int8_t> host_out(num_bytes, 0);
+        buffer.CopyGpuDataToHost(host_out.data(), host_out.size());
+        CHECK(host_out == std::vector<std::int8_t>(
+                              host_in.begin(), host_in.begin() + num_bytes));
+    }
+    SECTION("Completed blocks are reused") {
+        for (std::size_t i = 0; i < 10; i++) {
+            pool.copyHostToDevice(buffer.getData(), host_in.data(),
+                                  block_bytes);
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(buffer.getStream()));
+        }
+        const auto stats = pool.getStats();
+        CHECK(stats.num_staged == 10);
+        CHECK(stats.num_blocks == 1);
+    }
+    SECTION("Copies larger than a block are direct") {
+        pool.copyHostToDevice(buffer.getData(), host_in.data(),
+                              host_in.size());
+        std::vector<std::int8_t> host_out(host_in.size(), 0);
+        buffer.CopyGpuDataToHost(host_out.data(), host_out.size());
+        CHECK(host_out == host_in);
+
+        const auto stats = pool.getStats();
+        CHECK(stats.num_staged == 0);
+        CHECK(stats.num_direct == 1);
+        CHECK(stats.num_blocks == 0);
+    }
+    SECTION("Release frees the blocks") {
+        pool.copyHostToDevice(buffer.getData(), host_in.data(), num_bytes);
+        pool.release();
+        pool.copyHostToDevice(buffer.getData(), host_in.data(), num_bytes);
+        CHECK(pool.getStats().num_blocks == 2);
+    }
+    SECTION("Empty blocks") {
+        REQUIRE_THROWS_AS(StagingPool(0, 0), LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::synchronize", "[StagingPool]",
+                   float, double) {
+    using StateVectorT = StateVectorCudaManaged<TestType>;
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 3;
+    const TestType inv_sqrt2 = 1 / std::sqrt(TestType{2});
+    // Added to the gate cache, and uploaded, while the basis state is written
+    const std::vector<ComplexT> matrix{{inv_sqrt2, 0},
+                                       {0, inv_sqrt2},
+                                       {0, inv_sqrt2},
+                                       {inv_sqrt2, 0}};
+
+    StateVectorT sv{num_qubits};
+    sv.setBasisState({1, 0}, 5, true);
+    for (std::size_t i = 0; i < 20; i++) {
+        sv.applyOperation_std("QubitUnitary", {i % num_qubits}, false, {},
+                              matrix);
+        sv.applyOperation_std("QubitUnitary", {i % num_qubits}, true, {},
+                              matrix);
+    }
+    sv.synchronize();
+    CHECK(sv.query());
+
+    std::vector<ComplexT> result(1U << num_qubits);
+    sv.CopyGpuDataToHost(result.data(), result.size());
+    std::vector<ComplexT> expected(1U << num_qubits);
+    expected[5] = {1, 0};
+    CHECK(result == Pennylane::approx(expected));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged on a non-blocking stream",
+                   "[StagingPool]", float, double) {
+    using StateVectorT = StateVectorCudaManaged<TestType>;
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+    const TestType inv_sqrt2 = 1 / std::sqrt(TestType{2});
+    const std::vector<ComplexT> matrix{{inv_sqrt2, 0},
+                                       {0, inv_sqrt2},
+                                       {0, inv_sqrt2},
+                                       {inv_sqrt2, 0}};
+
+    const auto applyCircuit = [&](StateVectorT &sv) {
+        sv.setBasisState({1, 0}, 6, true);
+        for (std::size_t i = 0; i < num_qubits; i++) {
+            sv.applyOperation("Hadamard", {i}, false);
+            sv.applyOperation_std("QubitUnitary", {i}, false, {}, matrix);
+            sv.applyOperation("RZ", {i}, false,
+                              {static_cast<TestType>(0.3) * (i + 1)});
+        }
+        sv.applyOperation("CNOT", {0, 3}, false);
+        sv.applyOperation("IsingXX", {1, 2}, false, {0.7});
+    };
+
+    StateVectorT sv_ref{num_qubits};
+    applyCircuit(sv_ref);
+    std::vector<ComplexT> expected(1U << num_qubits);
+    sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+
+    // No implicit ordering with the default stream, so gates, uploads and
+    // memsets are only correct if they are all enqueued on this stream
+    cudaStream_t stream_id{nullptr};
+    PL_CUDA_IS_SUCCESS(
+        cudaStreamCreateWithFlags(&stream_id, cudaStreamNonBlocking));
+    {
+        StateVectorT sv{num_qubits, DevTag<int>{0, stream_id}};
+        applyCircuit(sv);
+
+        // The readback orders itself after the gates on the stream
+        std::vector<ComplexT> result(1U << num_qubits);
+        sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(expected));
+    }
+    PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream_id));
+}
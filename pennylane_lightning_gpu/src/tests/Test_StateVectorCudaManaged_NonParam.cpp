@@ -3,6 +3,8 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <random>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -928,6 +930,120 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::Hamiltonian_expval_cuSparse",
         TestType expected = 1;
 
         CHECK(expected == Approx(results).epsilon(1e-7));
+
+        SECTION("Device-resident matrix") {
+            const CSRMatrixGPU<TestType, index_type> matrix{
+                {values, values + nnz},
+                {columns, columns + nnz},
+                {csrOffsets, csrOffsets + num_csrOffsets}};
+            CHECK(matrix.getNumUploads() == 0);
+            for (std::size_t i = 0; i < 3; i++) {
+                CHECK(svdat.cuda_sv.getExpectationValueOnSparseSpMV(matrix) ==
+                      Approx(expected).epsilon(1e-7));
+            }
+            // H = I + P with P^2 = I, so <H^2> = 2<H>
+            CHECK(svdat.cuda_sv.getVarianceOnSparseSpMV(matrix) ==
+                  Approx(1.0).epsilon(1e-6));
+            CHECK(matrix.getNumUploads() == 1);
+            // H|psi> is kept out of the gate workspace
+            CHECK(svdat.cuda_sv.getWorkspaceHighWaterMark() == 0);
+
+            std::vector<cp_t> state(init_state.size());
+            svdat.cuda_sv.CopyGpuDataToHost(state.data(), state.size());
+            CHECK(state == Pennylane::approx(init_state));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::Hamiltonian_expval_PauliGrouped",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+    std::mt19937 re{1337};
+    const auto init_state = createRandomState<TestType>(re, num_qubits);
+    SVDataGPU<TestType> svdat{num_qubits, init_state};
+
+    const std::vector<std::string> words{"ZZ", "XX", "YY", "Z",   "X",
+                                         "XY", "YZX", "I", "ZIZ", "YXZY"};
+    const std::vector<std::vector<std::size_t>> tgts{
+        {0, 1}, {0, 1}, {2, 3},    {3},       {2},
+        {1, 3}, {0, 1, 2}, {1}, {0, 2, 3}, {0, 1, 2, 3}};
+    const std::vector<cp_t> coeffs{0.5, -0.3, 0.2, 1.1, -0.7,
+                                   0.4, 0.9,  2.0, -0.1, 0.6};
+    const auto expected = svdat.cuda_sv.getExpectationValuePauliWords(
+        words, tgts, coeffs.data());
+
+    for (const std::size_t max_group_wires : {4, 2, 1}) {
+        CHECK(svdat.cuda_sv.getExpectationValuePauliWordsGrouped(
+                  words, tgts, coeffs.data(), max_group_wires) ==
+              Approx(expected).margin(1e-5));
+    }
+
+    // The basis rotations are applied to a scratch copy
+    std::vector<cp_t> state(init_state.size());
+    svdat.cuda_sv.CopyGpuDataToHost(state.data(), state.size());
+    CHECK(state == Pennylane::approx(init_state).margin(1e-6));
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::variance",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const std::size_t num_qubits = 3;
+    std::mt19937 re{1337};
+    const auto init_state = createRandomState<TestType>(re, num_qubits);
+    SVDataGPU<TestType> svdat{num_qubits, init_state};
+
+    // Variance from <O> and <O^2>, with O^2 computed on the host
+    const auto expected_variance = [&](const std::vector<std::size_t> &wires,
+                                       const std::vector<cp_t> &matrix) {
+        const std::size_t dim = std::size_t{1} << wires.size();
+        std::vector<cp_t> squared(dim * dim);
+        for (std::size_t i = 0; i < dim; i++) {
+            for (std::size_t j = 0; j < dim; j++) {
+                for (std::size_t k = 0; k < dim; k++) {
+                    squared[i * dim + j] +=
+                        matrix[i * dim + k] * matrix[k * dim + j];
+                }
+            }
+        }
+        const TestType mean = svdat.cuda_sv.expval(wires, matrix).x;
+        return svdat.cuda_sv.expval(wires, squared).x - mean * mean;
+    };
+
+    SECTION("Pauli word") {
+        const std::vector<std::size_t> wires{0, 2};
+        // X (x) Z
+        const std::vector<cp_t> matrix{0, 0, 1, 0,  0, 0, 0, -1,
+                                       1, 0, 0, 0,  0, -1, 0, 0};
+        CHECK(svdat.cuda_sv.variance({"PauliX", "PauliZ"}, wires, matrix) ==
+              Approx(expected_variance(wires, matrix)).margin(1e-5));
+    }
+    SECTION("Diagonal observable") {
+        const std::vector<std::size_t> wires{2, 0};
+        const std::vector<cp_t> matrix{0.5, 0, 0,   0, 0, -1.5, 0, 0,
+                                       0,   0, 2.0, 0, 0, 0,    0, 0.25};
+        CHECK(svdat.cuda_sv.variance({"Hermitian"}, wires, matrix) ==
+              Approx(expected_variance(wires, matrix)).margin(1e-5));
+    }
+    SECTION("Hermitian observable") {
+        const std::vector<std::size_t> wires{1, 0};
+        const std::vector<cp_t> matrix{
+            {0.5, 0.0},  {0.2, 0.5},  {0.1, -0.3}, {0.3, 0.0},
+            {0.2, -0.5}, {-1.0, 0.0}, {0.0, 0.4},  {0.6, 0.1},
+            {0.1, 0.3},  {0.0, -0.4}, {0.7, 0.0},  {0.2, -0.2},
+            {0.3, 0.0},  {0.6, -0.1}, {0.2, 0.2},  {0.1, 0.0}};
+        CHECK(svdat.cuda_sv.variance({"Hermitian"}, wires, matrix) ==
+              Approx(expected_variance(wires, matrix)).margin(1e-5));
+
+        // The observable is applied to a scratch copy
+        std::vector<cp_t> state(init_state.size());
+        svdat.cuda_sv.CopyGpuDataToHost(state.data(), state.size());
+        CHECK(state == Pennylane::approx(init_state).margin(1e-6));
+    }
+    SECTION("Invalid matrix") {
+        REQUIRE_THROWS_WITH(
+            svdat.cuda_sv.variance({"Hermitian"}, {0}, std::vector<cp_t>(8)),
+            Catch::Contains("does not match the number of wires"));
     }
 }
 
@@ -1043,3 +1159,30 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::SetIthStates",
         CHECK(expected_state == Pennylane::approx(svdat.sv.getDataVector()));
     }
 }
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::Workspace",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const std::size_t num_qubits = 4;
+    SVDataGPU<TestType> svdat{num_qubits};
+    const std::vector<cp_t> matrix{{0, 0}, {1, 0}, {0, 0}, {0, 0},
+                                   {1, 0}, {0, 0}, {0, 0}, {0, 0},
+                                   {0, 0}, {0, 0}, {0, 0}, {1, 0},
+                                   {0, 0}, {0, 0}, {1, 0}, {0, 0}};
+
+    CHECK(svdat.cuda_sv.getWorkspaceCapacity() == 0);
+    for (std::size_t i = 0; i < 8; i++) {
+        svdat.cuda_sv.applyOperation_std("QubitUnitary", {i % 2, 2 + i % 2},
+                                         false, {}, matrix);
+    }
+    // The workspace never shrinks, and always fits the largest request
+    CHECK(svdat.cuda_sv.getWorkspaceCapacity() >=
+          svdat.cuda_sv.getWorkspaceHighWaterMark());
+
+    svdat.cuda_sv.releaseWorkspace();
+    CHECK(svdat.cuda_sv.getWorkspaceCapacity() == 0);
+
+    // Each two-qubit unitary is applied an even number of times
+    svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+    CHECK(svdat.sv.getDataVector()[0] == cp_t{1, 0});
+}
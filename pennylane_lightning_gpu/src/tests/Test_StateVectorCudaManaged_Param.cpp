@@ -1276,6 +1276,279 @@ TEMPLATE_TEST_CASE("LightningGPU::applyOperation multiple wires",
     }
 }
 
+TEMPLATE_TEST_CASE("LightningGPU::applyOperation gate fusion",
+                   "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 4;
+    const std::vector<std::string> ops{
+        "Hadamard", "RX",      "CNOT",    "RZ",   "Rot",
+        "IsingXX",  "CRY",     "PauliY",  "S",    "DoubleExcitation",
+        "MultiRZ",  "Toffoli", "SingleExcitation", "T"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {1}, {0, 1}, {1}, {2}, {2, 3}, {1, 2}, {3}, {0},
+        {0, 1, 2, 3}, {0, 2, 3}, {3, 1, 0}, {2, 0}, {1}};
+    const std::vector<bool> adjoints{false, false, false, true,  false,
+                                     false, true,  false, true,  false,
+                                     false, false, true,  false};
+    const std::vector<std::vector<TestType>> params{
+        {}, {0.3}, {}, {0.5}, {0.1, 0.2, 0.3}, {0.7}, {1.1}, {}, {},
+        {0.4}, {0.9}, {}, {0.6}, {}};
+
+    SVDataGPU<TestType> svdat_expected{num_qubits};
+    svdat_expected.cuda_sv.applyOperation(ops, wires, adjoints, params);
+    svdat_expected.cuda_sv.CopyGpuDataToHost(svdat_expected.sv);
+
+    for (size_t max_fused_wires = 1; max_fused_wires <= 4;
+         max_fused_wires++) {
+        SVDataGPU<TestType> svdat{num_qubits};
+        svdat.cuda_sv.setGateFusion(max_fused_wires);
+        CHECK(svdat.cuda_sv.getGateFusion() == max_fused_wires);
+        svdat.cuda_sv.applyOperation(ops, wires, adjoints, params);
+        svdat.cuda_sv.CopyGpuDataToHost(svdat.sv);
+        CHECK(svdat.sv.getDataVector() ==
+              Pennylane::approx(svdat_expected.sv.getDataVector()));
+    }
+
+    SECTION("Unsupported block size") {
+        SVDataGPU<TestType> svdat{num_qubits};
+        REQUIRE_THROWS_AS(svdat.cuda_sv.setGateFusion(7), LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("LightningGPU::applyOperation diagonal folding",
+                   "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 4;
+    // QAOA-like layer: long runs of diagonal gates between mixers
+    const std::vector<std::string> ops{
+        "Hadamard", "Hadamard", "Hadamard",
+        "Hadamard", "IsingZZ",  "IsingZZ",
+        "IsingZZ",  "RZ",       "MultiRZ",
+        "CZ",       "CRZ",      "ControlledPhaseShift",
+        "PhaseShift", "S",      "T",
+        "PauliZ",   "RX",       "RX",
+        "IsingZZ",  "RZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {1}, {2}, {3}, {0, 1}, {1, 2}, {3, 0}, {2}, {0, 1, 2, 3}, {2, 3},
+        {1, 3}, {3, 2}, {0}, {1}, {2}, {3}, {0}, {1}, {2, 3}, {3}};
+    const std::vector<bool> adjoints{
+        false, false, false, false, false, true,  false, false, false, false,
+        false, false, true,  true,  false, false, false, false, false, false};
+    const std::vector<std::vector<TestType>> params{
+        {}, {}, {}, {}, {0.3}, {0.5}, {0.7}, {0.2}, {0.9}, {},
+        {1.1}, {0.4}, {0.6}, {}, {}, {}, {0.8}, {0.8}, {0.3}, {1.3}};
+
+    SVDataGPU<TestType> svdat{num_qubits};
+    svdat.sv.applyOperations(ops, wires, adjoints, params);
+
+    SECTION("Multi-op apply") {
+        svdat.cuda_sv.applyOperation(ops, wires, adjoints, params);
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+    }
+    SECTION("Single-op apply") {
+        for (size_t op_idx = 0; op_idx < ops.size(); op_idx++) {
+            svdat.cuda_sv.applyOperation(ops[op_idx], wires[op_idx],
+                                         adjoints[op_idx], params[op_idx]);
+        }
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+    }
+    SECTION("Fused apply") {
+        svdat.cuda_sv.setGateFusion(3);
+        svdat.cuda_sv.applyOperation(ops, wires, adjoints, params);
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+    }
+}
+
+TEMPLATE_TEST_CASE("LightningGPU::applyTape", "[LightningGPU_Param]", float,
+                   double) {
+    const size_t num_qubits = 4;
+    const std::vector<std::string> ops{"Hadamard",
+                                       "PauliX",
+                                       "PauliY",
+                                       "PauliZ",
+                                       "S",
+                                       "T",
+                                       "RX",
+                                       "RY",
+                                       "RZ",
+                                       "Rot",
+                                       "PhaseShift",
+                                       "CNOT",
+                                       "CY",
+                                       "CZ",
+                                       "SWAP",
+                                       "IsingXX",
+                                       "IsingYY",
+                                       "IsingZZ",
+                                       "CRX",
+                                       "CRY",
+                                       "CRZ",
+                                       "CRot",
+                                       "ControlledPhaseShift",
+                                       "SingleExcitation",
+                                       "Toffoli",
+                                       "CSWAP",
+                                       "DoubleExcitation",
+                                       "MultiRZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0},    {1},    {2},    {3},       {0},       {1},
+        {2},    {3},    {0},    {1},       {2},       {0, 3},
+        {3, 1}, {2, 0}, {1, 2}, {0, 1},    {2, 3},    {3, 0},
+        {1, 0}, {2, 1}, {3, 2}, {0, 2},    {1, 3},    {2, 0},
+        {3, 0, 1},      {1, 3, 2},         {0, 1, 2, 3},
+        {0, 1, 2, 3}};
+    const std::vector<bool> adjoints{
+        false, false, true,  false, true,  true,  false, true,  false, true,
+        false, false, false, false, false, true,  false, false, true,  false,
+        false, true,  false, true,  false, false, false, true};
+    const std::vector<std::vector<TestType>> params{
+        {},    {},    {},    {},    {},    {},    {0.3}, {0.5},
+        {0.7}, {0.1, 0.2, 0.3},     {0.9}, {},    {},    {},
+        {},    {1.1}, {0.4}, {0.6}, {0.8}, {1.2}, {0.2},
+        {0.3, 0.5, 0.7},     {1.3}, {0.4}, {},    {},    {0.6},
+        {0.5}};
+
+    SVDataGPU<TestType> svdat{num_qubits};
+    svdat.sv.applyOperations(ops, wires, adjoints, params);
+    const GateTape<TestType> tape(num_qubits, ops, wires, adjoints, params);
+
+    SECTION("Apply tape") {
+        svdat.cuda_sv.applyTape(tape);
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+    }
+    SECTION("Apply tape with device matrices") {
+        using CFP_t = typename GateTape<TestType>::CFP_t;
+        const auto &matrices = tape.getMatrices();
+        DataBuffer<CFP_t, int> table{matrices.size(),
+                                     svdat.cuda_sv.getDevTag(), true};
+        table.CopyHostDataToGpu(matrices.data(), matrices.size());
+        svdat.cuda_sv.applyTape(tape, false, table.getData());
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+    }
+    SECTION("Adjoint tape restores the initial state") {
+        svdat.cuda_sv.applyTape(tape);
+        svdat.cuda_sv.applyTape(tape, true);
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        std::vector<std::complex<TestType>> expected(result.size(), {0, 0});
+        expected[0] = {1, 0};
+        CHECK(result == Pennylane::approx(expected).margin(1e-5));
+    }
+    SECTION("Apply tape graph") {
+        const TapeGraphPlan<TestType> plan(tape);
+        svdat.cuda_sv.applyTapeGraph(tape, plan);
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(svdat.sv.getDataVector()));
+        CHECK(svdat.cuda_sv.getNumTapeGraphCaptures() == 1);
+    }
+    SECTION("Replay tape graph with new parameters") {
+        const TapeGraphPlan<TestType> plan(tape);
+        svdat.cuda_sv.applyTapeGraph(tape, plan);
+
+        GateTape<TestType> replayed = tape;
+        std::vector<TestType> new_params = tape.getParameters();
+        for (auto &param : new_params) {
+            param *= -2;
+        }
+        replayed.setParameters(new_params);
+        svdat.cuda_sv.applyTapeGraph(replayed, plan);
+        svdat.cuda_sv.applyTape(replayed, true);
+        CHECK(svdat.cuda_sv.getNumTapeGraphCaptures() == 1);
+
+        // Undoing the replay leaves the state of the first launch
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result ==
+              Pennylane::approx(svdat.sv.getDataVector()).margin(1e-5));
+    }
+    SECTION("Consecutive replays upload their own parameters") {
+        const TapeGraphPlan<TestType> plan(tape);
+        svdat.cuda_sv.applyTapeGraph(tape, plan);
+
+        // Each replay rewrites the host table while the previous upload may
+        // still be queued behind the graph launches
+        std::vector<GateTape<TestType>> replayed(3, tape);
+        for (std::size_t i = 0; i < replayed.size(); i++) {
+            std::vector<TestType> new_params = tape.getParameters();
+            for (auto &param : new_params) {
+                param *= static_cast<TestType>(i + 2);
+            }
+            replayed[i].setParameters(new_params);
+            svdat.cuda_sv.applyTapeGraph(replayed[i], plan);
+        }
+        for (auto it = replayed.rbegin(); it != replayed.rend(); ++it) {
+            svdat.cuda_sv.applyTape(*it, true);
+        }
+        CHECK(svdat.cuda_sv.getNumTapeGraphCaptures() == 1);
+
+        auto result = svdat.sv.getDataVector();
+        svdat.cuda_sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result ==
+              Pennylane::approx(svdat.sv.getDataVector()).margin(1e-4));
+    }
+}
+
+TEMPLATE_TEST_CASE("LightningGPU::applyUnpackedOperations",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const auto code = [](GateOp op) { return static_cast<std::uint8_t>(op); };
+    // The explicit matrices are a CNOT on wires {2, 0} and an S on wire 1
+    const std::vector<std::uint8_t> opcodes{
+        code(GateOp::Hadamard), code(GateOp::RX),     code(GateOp::RZ),
+        code(GateOp::CZ),       code(GateOp::Matrix), code(GateOp::Rot),
+        code(GateOp::Matrix),   code(GateOp::IsingZZ)};
+    const std::vector<std::size_t> wire_offsets{0, 1, 2, 3, 5, 7, 8, 9, 11};
+    const std::vector<std::size_t> wires{1, 0, 2, 0, 1, 2, 0, 1, 1, 0, 2};
+    const bool adjoints[] = {false, false, true, false,
+                             false, true,  false, false};
+    const std::vector<TestType> params{0.3, 0.5, 0.1, 0.2, 0.4, 0.6};
+    std::vector<cp_t> matrices(16 + 4, {0, 0});
+    matrices[0] = matrices[5] = matrices[11] = matrices[14] = {1, 0};
+    matrices[16] = {1, 0};
+    matrices[19] = {0, 1};
+
+    StateVectorCudaManaged<TestType> sv_expected{num_qubits};
+    sv_expected.initSV();
+    sv_expected.applyOperation("Hadamard", {1}, false);
+    sv_expected.applyOperation("RX", {0}, false, {0.3});
+    sv_expected.applyOperation("RZ", {2}, true, {0.5});
+    sv_expected.applyOperation("CZ", {0, 1}, false);
+    sv_expected.applyOperation("CNOT", {2, 0}, false);
+    sv_expected.applyOperation("Rot", {1}, true, {0.1, 0.2, 0.4});
+    sv_expected.applyOperation("S", {1}, false);
+    sv_expected.applyOperation("IsingZZ", {0, 2}, false, {0.6});
+
+    std::vector<cp_t> expected(std::size_t{1} << num_qubits);
+    sv_expected.CopyGpuDataToHost(expected.data(), expected.size());
+    const auto tape = unpackOperations<TestType>(
+        num_qubits, opcodes.data(), opcodes.size(), wire_offsets.data(),
+        wires.data(), adjoints, params.data(), params.size(), matrices.data(),
+        matrices.size());
+
+    // Without fusion, RZ and CZ are folded and the other gates are
+    // dispatched by opcode. With fusion, runs of named gates are fused.
+    for (std::size_t max_fused_wires : {0, 2}) {
+        StateVectorCudaManaged<TestType> sv{num_qubits};
+        sv.initSV();
+        sv.setGateFusion(max_fused_wires);
+        sv.applyUnpackedOperations(tape);
+
+        std::vector<cp_t> result(expected.size());
+        sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(expected));
+    }
+}
+
 TEMPLATE_TEST_CASE("Sample", "[LightningGPU_Param]", float, double) {
     constexpr uint32_t twos[] = {
         1U << 0U,  1U << 1U,  1U << 2U,  1U << 3U,  1U << 4U,  1U << 5U,
@@ -1330,3 +1603,125 @@ TEMPLATE_TEST_CASE("Sample", "[LightningGPU_Param]", float, double) {
     REQUIRE_THAT(probabilities,
                  Catch::Approx(expected_probabilities).margin(.05));
 }
+
+TEMPLATE_TEST_CASE("Sample counts", "[LightningGPU_Param]", float, double) {
+    // Defining the State Vector that will be measured.
+    size_t num_qubits = 3;
+    size_t data_size = std::pow(2, num_qubits);
+
+    std::vector<std::complex<TestType>> init_state(data_size, 0);
+    init_state[0] = 1;
+    SVDataGPU<TestType> svdat{num_qubits, init_state};
+    TestType alpha = 0.7;
+    TestType beta = 0.5;
+    TestType gamma = 0.2;
+    svdat.sv.applyOperations(
+        {"RX", "RY", "RX", "RY", "RX", "RY"}, {{0}, {0}, {1}, {1}, {2}, {2}},
+        {false, false, false, false, false, false},
+        {{alpha}, {alpha}, {beta}, {beta}, {gamma}, {gamma}});
+    svdat.cuda_sv.CopyHostDataToGpu(svdat.sv);
+
+    std::vector<TestType> expected_probabilities = {
+        0.687573, 0.013842, 0.089279, 0.001797,
+        0.180036, 0.003624, 0.023377, 0.000471};
+    size_t num_samples = 100000;
+
+    SECTION("Packed samples") {
+        auto &&packed = svdat.cuda_sv.generate_samples_packed(num_samples);
+        REQUIRE(packed.size() == num_samples);
+        CHECK(std::is_sorted(packed.begin(), packed.end()));
+
+        std::vector<TestType> probabilities(data_size, 0);
+        for (auto idx : packed) {
+            REQUIRE(idx < static_cast<custatevecIndex_t>(data_size));
+            probabilities[idx] += 1 / static_cast<TestType>(num_samples);
+        }
+        REQUIRE_THAT(probabilities,
+                     Catch::Approx(expected_probabilities).margin(.05));
+    }
+
+    SECTION("Counts") {
+        auto &&[outcomes, counts] = svdat.cuda_sv.generate_counts(num_samples);
+        REQUIRE(outcomes.size() == counts.size());
+        CHECK(std::is_sorted(outcomes.begin(), outcomes.end()));
+
+        std::vector<TestType> probabilities(data_size, 0);
+        size_t total = 0;
+        for (size_t i = 0; i < outcomes.size(); i++) {
+            probabilities[outcomes[i]] =
+                counts[i] / static_cast<TestType>(num_samples);
+            total += counts[i];
+        }
+        CHECK(total == num_samples);
+        REQUIRE_THAT(probabilities,
+                     Catch::Approx(expected_probabilities).margin(.05));
+    }
+}
+
+TEMPLATE_TEST_CASE("Sampler reuse and seeding", "[LightningGPU_Param]", float,
+                   double) {
+    const size_t num_qubits = 3;
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation({"Hadamard", "RX", "CNOT"}, {{0}, {1}, {0, 2}},
+                      {false, false, false}, {{}, {0.7}, {}});
+
+    SECTION("Samples of an unchanged state reuse the sampler") {
+        sv.generate_samples_packed(100);
+        sv.generate_counts(50);
+        sv.generate_samples(100);
+        CHECK(sv.getNumSamplerPreprocesses() == 1);
+
+        // More samples than the sampler was created for
+        sv.generate_samples_packed(200);
+        CHECK(sv.getNumSamplerPreprocesses() == 2);
+
+        sv.applyOperation("PauliX", {1});
+        sv.generate_samples_packed(100);
+        CHECK(sv.getNumSamplerPreprocesses() == 3);
+
+        sv.markStateChanged();
+        sv.generate_samples_packed(100);
+        CHECK(sv.getNumSamplerPreprocesses() == 4);
+    }
+
+    SECTION("Measurements between samples reuse the sampler") {
+        using ComplexT = std::complex<TestType>;
+        const std::vector<ComplexT> pauli_z{{1, 0}, {0, 0}, {0, 0}, {-1, 0}};
+        const std::vector<ComplexT> hermitian{{1, 0}, {0, -1}, {0, 1}, {2, 0}};
+        const std::vector<ComplexT> coeffs{{0.5, 0}};
+
+        sv.generate_samples_packed(100);
+        const auto version = sv.getStateVersion();
+        sv.expval({1}, pauli_z);
+        sv.probability({0, 2});
+        sv.variance({"PauliX"}, {2}, {});
+        sv.variance({"Hermitian"}, {0}, hermitian);
+        sv.getExpectationValuePauliWords({"XZ"}, {{0, 1}}, coeffs.data());
+        CHECK(sv.getStateVersion() == version);
+
+        sv.generate_samples_packed(100);
+        CHECK(sv.getNumSamplerPreprocesses() == 1);
+    }
+
+    SECTION("No samples leave the random stream unchanged") {
+        StateVectorCudaManaged<TestType> other{sv};
+        sv.setSeed(7);
+        other.setSeed(7);
+        CHECK(sv.generate_samples_packed(0).empty());
+        CHECK(sv.generate_samples_packed(100) ==
+              other.generate_samples_packed(100));
+    }
+
+    SECTION("Seeded samples are reproduced") {
+        StateVectorCudaManaged<TestType> other{sv};
+        sv.setSeed(42);
+        other.setSeed(42);
+        const auto samples = sv.generate_samples_packed(1000);
+        CHECK(samples == other.generate_samples_packed(1000));
+        CHECK(samples != sv.generate_samples_packed(1000));
+
+        sv.setSeed(42);
+        CHECK(samples == sv.generate_samples_packed(1000));
+    }
+}
@@ -0,0 +1,56 @@
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DevicePool.hpp"
+#include "StateVectorCudaManaged.hpp"
+#include "StateVectorCudaMultiDevice.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+TEMPLATE_TEST_CASE("StateVectorCudaMultiDevice::applyOperation",
+                   "[StateVectorCudaMultiDevice]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    constexpr std::size_t num_qubits = 5;
+
+    const std::vector<std::string> ops{"Hadamard", "RX",   "CNOT",
+                                       "RY",       "CRZ",  "Toffoli",
+                                       "PauliY",   "SWAP", "IsingXX"};
+    const std::vector<std::vector<std::size_t>> wires{
+        {0}, {4}, {0, 3}, {1}, {4, 0}, {0, 1, 2}, {3}, {0, 4}, {1, 4}};
+    const std::vector<bool> adjoints{false, false, false, true, false,
+                                     false, false, false, true};
+    const std::vector<std::vector<TestType>> params{
+        {}, {0.3}, {}, {0.7}, {-1.1}, {}, {}, {}, {0.4}};
+
+    StateVectorCudaManaged<TestType> sv_expected{num_qubits};
+    sv_expected.applyOperation(ops, wires, adjoints, params);
+    std::vector<ComplexT> expected(std::size_t{1} << num_qubits);
+    sv_expected.CopyGpuDataToHost(expected.data(), expected.size());
+
+    const std::size_t num_devices = DevicePool<int>::getTotalDevices();
+    for (std::size_t n = 1; n <= num_devices && n <= 4; n *= 2) {
+        DYNAMIC_SECTION("Devices - " << n) {
+            StateVectorCudaMultiDevice<TestType> sv{num_qubits, n};
+            REQUIRE(sv.getNumShards() == n);
+            sv.applyOperation(ops, wires, adjoints, params);
+
+            CHECK(sv.getDataVector() == approx(expected).margin(1e-5));
+            for (const auto &prob_wires :
+                 std::vector<std::vector<std::size_t>>{
+                     {0}, {4, 1}, {0, 2, 3}, {0, 1, 2, 3, 4}}) {
+                CHECK(sv.probability(prob_wires) ==
+                      approx(sv_expected.probability(prob_wires))
+                          .margin(1e-5));
+            }
+            if (n > 1) {
+                CHECK(sv.getLayout().getNumSwaps() > 0);
+            }
+        }
+    }
+}
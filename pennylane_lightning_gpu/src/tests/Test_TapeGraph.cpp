@@ -0,0 +1,208 @@
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "TapeGraph.hpp"
+#include "cuGates_host.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+/**
+ * @brief Get a slice of a matrix table as complex numbers.
+ */
+template <class CFP_t, class PrecisionT = decltype(CFP_t{}.x)>
+auto getSlice(const std::vector<CFP_t> &table, std::size_t offset,
+              std::size_t size) -> std::vector<std::complex<PrecisionT>> {
+    std::vector<std::complex<PrecisionT>> slice;
+    for (std::size_t i = offset; i < offset + size; i++) {
+        slice.emplace_back(table[i].x, table[i].y);
+    }
+    return slice;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("TapeGraphPlan::TapeGraphPlan", "[TapeGraph]", float,
+                   double) {
+    using ComplexT = std::complex<TestType>;
+    const std::size_t num_qubits = 3;
+    const std::vector<ComplexT> cz{{1, 0}, {0, 0}, {0, 0}, {0, 0},
+                                   {0, 0}, {1, 0}, {0, 0}, {0, 0},
+                                   {0, 0}, {0, 0}, {1, 0}, {0, 0},
+                                   {0, 0}, {0, 0}, {0, 0}, {-1, 0}};
+    const GateTape<TestType> tape(
+        num_qubits,
+        {"Hadamard", "Identity", "CNOT", "MultiRZ", "QubitUnitary"},
+        {{0}, {1}, {0, 1}, {0, 1, 2}, {2, 1}},
+        {false, false, false, true, false}, {{}, {}, {}, {0.3}, {}},
+        {{}, {}, {}, {}, cz});
+    const TapeGraphPlan<TestType> plan(tape);
+
+    SECTION("Identity gates are skipped") {
+        const auto &nodes = plan.getNodes();
+        REQUIRE(nodes.size() == 4);
+        CHECK(nodes[0].op_idx == 0);
+        CHECK(nodes[1].op_idx == 2);
+        CHECK(nodes[2].op_idx == 3);
+        CHECK(nodes[3].op_idx == 4);
+    }
+    SECTION("Matrix table layout") {
+        const auto &nodes = plan.getNodes();
+        CHECK(nodes[1].num_ctrls == 1);
+        CHECK(nodes[1].num_tgts == 1);
+        CHECK(nodes[2].num_ctrls == 0);
+        CHECK(nodes[2].num_tgts == 3);
+        CHECK(nodes[2].adjoint);
+        CHECK(nodes[0].matrix_offset == 0);
+        CHECK(nodes[1].matrix_offset == 4);
+        CHECK(nodes[2].matrix_offset == 8);
+        CHECK(nodes[3].matrix_offset == 72);
+        CHECK(plan.getMatrixTableSize() == 88);
+        CHECK(plan.getWires() == tape.getWires());
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            CHECK(nodes[i].wire_offset ==
+                  tape.getOps()[nodes[i].op_idx].wire_offset);
+        }
+    }
+    SECTION("Matrices of the gates") {
+        std::vector<typename GateTape<TestType>::CFP_t> table;
+        plan.fillMatrixTable(tape, table);
+        REQUIRE(table.size() == plan.getMatrixTableSize());
+
+        const auto hadamard =
+            cuGates::getHadamard<typename GateTape<TestType>::CFP_t>();
+        CHECK(getSlice(table, 0, 4) == approx(getSlice(hadamard, 0, 4)));
+        CHECK(getSlice(table, 4, 4) ==
+              approx(std::vector<ComplexT>{{0, 0}, {1, 0}, {1, 0}, {0, 0}}));
+
+        // MultiRZ is diagonal, with a phase given by the parity of the index
+        const auto multi_rz = getSlice(table, 8, 64);
+        std::vector<ComplexT> expected(64);
+        for (std::size_t i = 0; i < 8; i++) {
+            const TestType sign = (std::popcount(i) % 2 == 0) ? 1 : -1;
+            expected[i * 8 + i] =
+                std::exp(ComplexT{0, -sign * static_cast<TestType>(0.15)});
+        }
+        CHECK(multi_rz == approx(expected));
+
+        CHECK(getSlice(table, 72, 16) == approx(cz));
+    }
+    SECTION("Copies share the plan identifier") {
+        const TapeGraphPlan<TestType> copy = plan;
+        const TapeGraphPlan<TestType> other(tape);
+        CHECK(copy.getId() == plan.getId());
+        CHECK(other.getId() != plan.getId());
+    }
+    SECTION("Invalid tapes") {
+        const GateTape<TestType> mismatched(num_qubits, {"RX"}, {{0}}, {false},
+                                            {{0.1}});
+        std::vector<typename GateTape<TestType>::CFP_t> table;
+        REQUIRE_THROWS_AS(plan.fillMatrixTable(mismatched, table),
+                          LightningException);
+
+        const std::size_t num_wires = 7;
+        std::vector<std::size_t> wires(num_wires);
+        std::iota(wires.begin(), wires.end(), 0);
+        const std::size_t dim = std::size_t{1} << num_wires;
+        std::vector<ComplexT> identity(dim * dim);
+        for (std::size_t i = 0; i < dim; i++) {
+            identity[i * dim + i] = {1, 0};
+        }
+        const GateTape<TestType> wide(num_wires, {"QubitUnitary"}, {wires},
+                                      {false}, {{}}, {identity});
+        REQUIRE_THROWS_AS(TapeGraphPlan<TestType>(wide), LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("TapeGraphPlan::fillMatrixTable", "[TapeGraph]", float,
+                   double) {
+    using CFP_t = typename GateTape<TestType>::CFP_t;
+    const std::size_t num_qubits = 3;
+    const TestType angle = 0.7;
+    const std::vector<TestType> rot{0.3, 0.5, 0.9};
+
+    const auto getTable = [&](const std::string &name,
+                              const std::vector<std::size_t> &wires,
+                              const std::vector<TestType> &params) {
+        const GateTape<TestType> tape(num_qubits, {name}, {wires}, {false},
+                                      {params});
+        std::vector<CFP_t> table;
+        TapeGraphPlan<TestType>(tape).fillMatrixTable(tape, table);
+        return getSlice(table, 0, table.size());
+    };
+    const auto expect = [](const std::vector<CFP_t> &matrix) {
+        return getSlice(matrix, 0, matrix.size());
+    };
+
+    SECTION("Rotations") {
+        CHECK(getTable("RX", {0}, {angle}) ==
+              approx(expect(cuGates::getRX<CFP_t>(angle))));
+        CHECK(getTable("RY", {0}, {angle}) ==
+              approx(expect(cuGates::getRY<CFP_t>(angle))));
+        CHECK(getTable("RZ", {0}, {angle}) ==
+              approx(expect(cuGates::getRZ<CFP_t>(angle))));
+        CHECK(getTable("CRY", {1, 0}, {angle}) ==
+              approx(expect(cuGates::getRY<CFP_t>(angle))));
+        CHECK(getTable("Rot", {2}, rot) ==
+              approx(expect(cuGates::getRot<CFP_t>(rot[0], rot[1], rot[2]))));
+        CHECK(getTable("CRot", {0, 2}, rot) ==
+              approx(expect(cuGates::getRot<CFP_t>(rot[0], rot[1], rot[2]))));
+    }
+    SECTION("Ising gates") {
+        CHECK(getTable("IsingXX", {0, 1}, {angle}) ==
+              approx(expect(cuGates::getIsingXX<CFP_t>(angle))));
+        CHECK(getTable("IsingYY", {0, 1}, {angle}) ==
+              approx(expect(cuGates::getIsingYY<CFP_t>(angle))));
+        CHECK(getTable("IsingZZ", {0, 1}, {angle}) ==
+              approx(expect(cuGates::getIsingZZ<CFP_t>(angle))));
+    }
+    SECTION("Phase gates") {
+        CHECK(getTable("PauliZ", {0}, {}) ==
+              approx(expect(cuGates::getPauliZ<CFP_t>())));
+        CHECK(getTable("CZ", {0, 1}, {}) ==
+              approx(expect(cuGates::getPauliZ<CFP_t>())));
+        CHECK(getTable("S", {0}, {}) == approx(expect(cuGates::getS<CFP_t>())));
+        CHECK(getTable("T", {0}, {}) == approx(expect(cuGates::getT<CFP_t>())));
+        CHECK(getTable("PhaseShift", {0}, {angle}) ==
+              approx(expect(cuGates::getPhaseShift<CFP_t>(angle))));
+        CHECK(getTable("ControlledPhaseShift", {0, 1}, {angle}) ==
+              approx(expect(cuGates::getPhaseShift<CFP_t>(angle))));
+    }
+    SECTION("Gates without parameters") {
+        CHECK(getTable("PauliX", {0}, {}) ==
+              approx(expect(cuGates::getPauliX<CFP_t>())));
+        CHECK(getTable("Toffoli", {0, 1, 2}, {}) ==
+              approx(expect(cuGates::getPauliX<CFP_t>())));
+        CHECK(getTable("CY", {0, 1}, {}) ==
+              approx(expect(cuGates::getPauliY<CFP_t>())));
+        CHECK(getTable("CSWAP", {0, 1, 2}, {}) ==
+              approx(expect(cuGates::getSWAP<CFP_t>())));
+    }
+    SECTION("Gates applied from the tape matrices") {
+        const GateTape<TestType> tape(num_qubits, {"SingleExcitation"},
+                                      {{0, 1}}, {false}, {{angle}});
+        std::vector<CFP_t> table;
+        TapeGraphPlan<TestType>(tape).fillMatrixTable(tape, table);
+        CHECK(getSlice(table, 0, table.size()) ==
+              approx(expect(tape.getMatrices())));
+    }
+    SECTION("New parameters update the table") {
+        GateTape<TestType> tape(num_qubits, {"Hadamard", "RX"}, {{0}, {1}},
+                                {false, false}, {{}, {0.1}});
+        const TapeGraphPlan<TestType> plan(tape);
+        tape.setParameters({angle});
+        std::vector<CFP_t> table;
+        plan.fillMatrixTable(tape, table);
+        CHECK(getSlice(table, 4, 4) ==
+              approx(expect(cuGates::getRX<CFP_t>(angle))));
+    }
+}
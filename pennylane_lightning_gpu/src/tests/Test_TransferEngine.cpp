@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "TransferEngine.hpp"
+#include "cuda_helpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+
+TEST_CASE("transferModeFromString", "[TransferEngine]") {
+    CHECK(transferModeFromString("auto") == TransferMode::Auto);
+    CHECK(transferModeFromString("direct") == TransferMode::Direct);
+    CHECK(transferModeFromString("staged") == TransferMode::Staged);
+    CHECK(transferModeFromString("registered") == TransferMode::Registered);
+    REQUIRE_THROWS_WITH(transferModeFromString("pinned"),
+                        Catch::Contains("Unknown transfer mode"));
+}
+
+TEST_CASE("TransferEngine round trips", "[TransferEngine]") {
+    // Small chunks, with a partial last one, exercise the pipelining
+    constexpr std::size_t chunk_bytes = 1024;
+    constexpr std::size_t num_bytes = 10 * chunk_bytes + 136;
+    TransferEngine engine(0, chunk_bytes);
+    DataBuffer<std::int8_t, int> buffer(num_bytes, DevTag<int>{0, 0});
+
+    std::vector<std::int8_t> host_in(num_bytes);
+    std::iota(host_in.begin(), host_in.end(), 0);
+
+    for (const auto mode : {TransferMode::Auto, TransferMode::Direct,
+                            TransferMode::Staged, TransferMode::Registered}) {
+        std::vector<std::int8_t> host_out(num_bytes, 0);
+        buffer.zeroInit();
+        engine.copyHostToDevice(buffer.getData(), host_in.data(), num_bytes,
+                                buffer.getStream(), mode);
+        engine.copyDeviceToHost(host_out.data(), buffer.getData(), num_bytes,
+                                buffer.getStream(), mode);
+        CHECK(host_out == host_in);
+    }
+
+    const auto stats = engine.getStats();
+    // Automatic copies of large pageable buffers are staged
+    CHECK(stats.num_staged == 4);
+    CHECK(stats.num_direct == 2);
+    CHECK(stats.num_registered == 2);
+    CHECK(stats.num_chunks == 4 * 11);
+    CHECK(stats.bytes_transferred == 8 * num_bytes);
+}
+
+TEST_CASE("TransferEngine small and pinned copies", "[TransferEngine]") {
+    constexpr std::size_t chunk_bytes = 1024;
+    TransferEngine engine(0, chunk_bytes);
+
+    SECTION("Copies within a chunk are direct") {
+        DataBuffer<std::int8_t, int> buffer(chunk_bytes, DevTag<int>{0, 0});
+        std::vector<std::int8_t> host(chunk_bytes, 7);
+        engine.copyHostToDevice(buffer.getData(), host.data(), chunk_bytes,
+                                buffer.getStream());
+        CHECK(engine.getStats().num_direct == 1);
+    }
+    SECTION("Pinned memory is not staged") {
+        constexpr std::size_t num_bytes = 4 * chunk_bytes;
+        void *pinned = nullptr;
+        PL_CUDA_IS_SUCCESS(cudaMallocHost(&pinned, num_bytes));
+        CHECK_FALSE(TransferEngine::isPageable(pinned));
+
+        DataBuffer<std::int8_t, int> buffer(num_bytes, DevTag<int>{0, 0});
+        engine.copyDeviceToHost(pinned, buffer.getData(), num_bytes,
+                                buffer.getStream());
+        CHECK(engine.getStats().num_direct == 1);
+        CHECK(engine.getStats().num_staged == 0);
+        PL_CUDA_IS_SUCCESS(cudaFreeHost(pinned));
+    }
+    SECTION("Pageable memory") {
+        std::vector<std::int8_t> host(16);
+        CHECK(TransferEngine::isPageable(host.data()));
+    }
+}
+
+TEMPLATE_TEST_CASE("DataBuffer transfer modes", "[TransferEngine]", float,
+                   double) {
+    using ComplexT = std::complex<TestType>;
+    using CFP_t = decltype(cuUtil::getCudaType(TestType{}));
+    // Larger than a default chunk, so that automatic copies are staged
+    const std::size_t length =
+        2 * TransferEngine::default_chunk_bytes / sizeof(CFP_t) + 3;
+    DataBuffer<CFP_t, int> buffer(length, DevTag<int>{0, 0});
+
+    std::vector<ComplexT> host_in(length);
+    for (std::size_t i = 0; i < length; i++) {
+        host_in[i] = {static_cast<TestType>(i % 1024),
+                      -static_cast<TestType>(i % 512)};
+    }
+    for (const auto mode : {TransferMode::Auto, TransferMode::Direct,
+                            TransferMode::Staged, TransferMode::Registered}) {
+        std::vector<ComplexT> host_out(length);
+        buffer.CopyHostDataToGpu(host_in.data(), length, false, mode);
+        buffer.CopyGpuDataToHost(host_out.data(), length, false, mode);
+        CHECK(host_out == host_in);
+    }
+}
+
+TEST_CASE("TransferEngine copies on a non-blocking stream",
+          "[TransferEngine]") {
+    constexpr std::size_t num_bytes = std::size_t{1} << 24U;
+    cudaStream_t stream_id{nullptr};
+    PL_CUDA_IS_SUCCESS(
+        cudaStreamCreateWithFlags(&stream_id, cudaStreamNonBlocking));
+    {
+        DataBuffer<std::int8_t, int> buffer(num_bytes,
+                                            DevTag<int>{0, stream_id});
+        DataBuffer<std::int8_t, int> copy(num_bytes,
+                                          DevTag<int>{0, stream_id});
+        std::vector<std::int8_t> host(num_bytes, 7);
+        buffer.CopyHostDataToGpu(host.data(), num_bytes);
+
+        // No implicit ordering with the default stream, so direct copies
+        // must wait for the memsets queued on the stream of the buffers
+        for (const auto mode : {TransferMode::Direct, TransferMode::Auto,
+                                TransferMode::Staged,
+                                TransferMode::Registered}) {
+            buffer.zeroInit();
+            std::fill(host.begin(), host.end(), 7);
+            buffer.CopyGpuDataToHost(host.data(), num_bytes, false, mode);
+            CHECK(std::all_of(host.begin(), host.end(),
+                              [](std::int8_t x) { return x == 0; }));
+        }
+
+        std::fill(host.begin(), host.end(), 3);
+        buffer.CopyHostDataToGpu(host.data(), num_bytes, false,
+                                 TransferMode::Direct);
+        copy.zeroInit();
+        copy.CopyGpuDataToGpu(buffer);
+        std::fill(host.begin(), host.end(), 0);
+        copy.CopyGpuDataToHost(host.data(), num_bytes, false,
+                               TransferMode::Direct);
+        CHECK(std::all_of(host.begin(), host.end(),
+                          [](std::int8_t x) { return x == 3; }));
+    }
+    PL_CUDA_IS_SUCCESS(cudaStreamDestroy(stream_id));
+}
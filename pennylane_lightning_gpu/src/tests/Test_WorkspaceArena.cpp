@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "DevTag.hpp"
+#include "WorkspaceArena.hpp"
+
+#include <cuda.h>
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+TEST_CASE("WorkspaceArena::WorkspaceArena", "[WorkspaceArena]") {
+    REQUIRE(std::is_constructible<WorkspaceArena<int>,
+                                  const DevTag<int> &>::value);
+    REQUIRE_FALSE(std::is_copy_constructible<WorkspaceArena<int>>::value);
+    REQUIRE_FALSE(std::is_move_constructible<WorkspaceArena<int>>::value);
+}
+
+TEST_CASE("WorkspaceArena::acquire", "[WorkspaceArena]") {
+    DevTag<int> dev_tag{0, 0};
+    WorkspaceArena<int> arena{dev_tag};
+
+    SECTION("Empty requests do not allocate") {
+        CHECK(arena.acquire(0) == nullptr);
+        CHECK(arena.getCapacity() == 0);
+        CHECK(arena.getNumAllocations() == 0);
+    }
+    SECTION("Workspace is reused and only grows") {
+        void *ptr = arena.acquire(1024);
+        REQUIRE(ptr != nullptr);
+        CHECK(arena.getCapacity() == 1024);
+        CHECK(arena.acquire(512) == ptr);
+        CHECK(arena.acquire(1024) == ptr);
+        CHECK(arena.getNumAllocations() == 1);
+        CHECK(arena.getCapacity() == 1024);
+
+        REQUIRE(arena.acquire(4096) != nullptr);
+        CHECK(arena.getNumAllocations() == 2);
+        CHECK(arena.getCapacity() == 4096);
+        CHECK(arena.getHighWaterMark() == 4096);
+    }
+    SECTION("Release frees the workspace") {
+        arena.acquire(2048);
+        arena.release();
+        CHECK(arena.getCapacity() == 0);
+        CHECK(arena.getHighWaterMark() == 2048);
+        REQUIRE(arena.acquire(16) != nullptr);
+        CHECK(arena.getNumAllocations() == 2);
+        CHECK(arena.getCapacity() == 16);
+    }
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Error.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+/**
+ * @file DLPack.hpp
+ * Export of device buffers as DLPack tensors, and the stream handshake of the
+ * DLPack and `__cuda_array_interface__` protocols.
+ *
+ * The structs below follow the stable DLPack ABI (v0.8), so that the capsules
+ * can be consumed by any framework implementing `from_dlpack`.
+ */
+
+namespace Pennylane::CUDA {
+
+/// DLPack device types used by this module.
+enum DLDeviceType : std::int32_t {
+    kDLCPU = 1,
+    kDLCUDA = 2,
+};
+
+/// DLPack data type codes used by this module.
+enum DLDataTypeCode : std::uint8_t {
+    kDLComplex = 5U,
+};
+
+struct DLDevice {
+    std::int32_t device_type;
+    std::int32_t device_id;
+};
+
+struct DLDataType {
+    std::uint8_t code;
+    std::uint8_t bits;
+    std::uint16_t lanes;
+};
+
+struct DLTensor {
+    void *data;
+    DLDevice device;
+    std::int32_t ndim;
+    DLDataType dtype;
+    std::int64_t *shape;
+    std::int64_t *strides;
+    std::uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(DLManagedTensor *self);
+};
+
+/**
+ * @brief DLPack data type of a CUDA complex type.
+ */
+template <class CFP_t> constexpr auto getDLDataType() -> DLDataType {
+    static_assert(std::is_same_v<CFP_t, cuFloatComplex> ||
+                      std::is_same_v<CFP_t, cuDoubleComplex>,
+                  "Only complex state-vector data can be exported");
+    return {kDLComplex, static_cast<std::uint8_t>(8 * sizeof(CFP_t)), 1};
+}
+
+/**
+ * @brief Type string of a CUDA complex type in the `__cuda_array_interface__`
+ * protocol.
+ */
+template <class CFP_t> constexpr auto getCudaArrayTypestr() -> const char * {
+    static_assert(std::is_same_v<CFP_t, cuFloatComplex> ||
+                      std::is_same_v<CFP_t, cuDoubleComplex>,
+                  "Only complex state-vector data can be exported");
+    return std::is_same_v<CFP_t, cuFloatComplex> ? "<c8" : "<c16";
+}
+
+/**
+ * @brief Wrap a contiguous device buffer into a one-dimensional DLPack tensor.
+ *
+ * The tensor does not own the buffer. Its deleter calls `release_owner` on
+ * `owner`, which must keep the buffer alive until then, and frees the
+ * tensor itself.
+ *
+ * @tparam CFP_t CUDA complex type of the buffer.
+ * @param data Device buffer.
+ * @param length Number of elements of the buffer.
+ * @param device_id Device holding the buffer.
+ * @param owner Handle keeping the buffer alive.
+ * @param release_owner Function releasing `owner`.
+ */
+template <class CFP_t>
+auto makeDLManagedTensor(CFP_t *data, std::size_t length, int device_id,
+                         void *owner, void (*release_owner)(void *))
+    -> DLManagedTensor * {
+    // The shape is stored with the tensor, so that both are freed together
+    struct Context {
+        DLManagedTensor tensor;
+        std::int64_t shape[1];
+        void *owner;
+        void (*release_owner)(void *);
+    };
+    auto *ctx = new Context{};
+    ctx->shape[0] = static_cast<std::int64_t>(length);
+    ctx->owner = owner;
+    ctx->release_owner = release_owner;
+
+    DLTensor &tensor = ctx->tensor.dl_tensor;
+    tensor.data = static_cast<void *>(data);
+    tensor.device = {kDLCUDA, device_id};
+    tensor.ndim = 1;
+    tensor.dtype = getDLDataType<CFP_t>();
+    tensor.shape = ctx->shape;
+    tensor.strides = nullptr;
+    tensor.byte_offset = 0;
+
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](DLManagedTensor *self) {
+        auto *context = static_cast<Context *>(self->manager_ctx);
+        if (context->release_owner != nullptr) {
+            context->release_owner(context->owner);
+        }
+        delete context;
+    };
+    return &ctx->tensor;
+}
+
+/**
+ * @brief Decode a stream handle passed through the DLPack or
+ * `__cuda_array_interface__` protocols, where 1 and 2 denote the legacy and
+ * per-thread default streams.
+ */
+inline auto streamFromProtocol(std::uintptr_t stream) -> cudaStream_t {
+    if (stream == 1) {
+        return cudaStreamLegacy;
+    }
+    if (stream == 2) {
+        return cudaStreamPerThread;
+    }
+    return reinterpret_cast<cudaStream_t>(stream); // NOLINT
+}
+
+/**
+ * @brief Encode a stream handle for the `__cuda_array_interface__` protocol,
+ * which reserves 0 and reports the default stream as the legacy stream.
+ */
+inline auto streamToProtocol(cudaStream_t stream) -> std::uintptr_t {
+    if (stream == nullptr || stream == cudaStreamLegacy) {
+        return 1;
+    }
+    if (stream == cudaStreamPerThread) {
+        return 2;
+    }
+    return reinterpret_cast<std::uintptr_t>(stream); // NOLINT
+}
+
+/**
+ * @brief Order all work submitted so far to `producer` before any work later
+ * submitted to `consumer`, without blocking the host.
+ *
+ * @param producer Stream writing the data.
+ * @param consumer Stream reading the data.
+ * @param device_id Device of the streams.
+ */
+inline void streamWaitFor(cudaStream_t producer, cudaStream_t consumer,
+                          int device_id) {
+    if (producer == consumer) {
+        return;
+    }
+    int current_device = 0;
+    PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_device));
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id));
+    cudaEvent_t event;
+    PL_CUDA_IS_SUCCESS(
+        cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    PL_CUDA_IS_SUCCESS(cudaEventRecord(event, producer));
+    PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(consumer, event, 0));
+    // Destruction is deferred by the runtime until the event completes
+    PL_CUDA_IS_SUCCESS(cudaEventDestroy(event));
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(current_device));
+}
+
+} // namespace Pennylane::CUDA
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <memory>
+
 #include "DevTag.hpp"
+#include "DeviceAllocator.hpp"
+#include "TransferEngine.hpp"
 #include "cuda.h"
 #include "cuda_helpers.hpp"
 
@@ -10,6 +14,9 @@ namespace Pennylane::CUDA {
  * @brief Data storage class for CUDA memory. Maintains an associated stream and
  * device ID taken during time of allocation.
  *
+ * Memory is obtained from a DeviceAllocator, by default the process-wide
+ * stream-ordered caching pool, and is returned to it on destruction.
+ *
  * @tparam GPUDataT GPU data type.
  * @tparam DevTagT Device tag index type.
  */
@@ -33,10 +40,7 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         : length_{length}, dev_tag_{device_id, stream_id}, gpu_buffer_{
                                                                nullptr} {
         if (alloc_memory && (length > 0)) {
-            dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocate();
         }
     }
 
@@ -44,10 +48,7 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                bool alloc_memory = true)
         : length_{length}, dev_tag_{dev}, gpu_buffer_{nullptr} {
         if (alloc_memory && (length > 0)) {
-            dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocate();
         }
     }
 
@@ -55,13 +56,40 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                bool alloc_memory = true)
         : length_{length}, dev_tag_{std::move(dev)}, gpu_buffer_{nullptr} {
         if (alloc_memory && (length > 0)) {
-            dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocate();
         }
     }
 
+    /**
+     * @brief Construct a buffer using a given allocator.
+     *
+     * @param length Number of elements in data buffer.
+     * @param dev Associated device and stream.
+     * @param allocator Allocator providing the device memory.
+     */
+    DataBuffer(std::size_t length, const DevTag<DevTagT> &dev,
+               std::shared_ptr<DeviceAllocator> allocator)
+        : length_{length}, dev_tag_{dev}, gpu_buffer_{nullptr},
+          allocator_{std::move(allocator)} {
+        PL_ABORT_IF_NOT(allocator_, "Invalid allocator.");
+        if (length > 0) {
+            allocate();
+        }
+    }
+
+    /**
+     * @brief Construct a non-owning view of existing device memory. The memory
+     * is not freed by the buffer, and must outlive it.
+     *
+     * @param gpu_data Device pointer to the first element of the view.
+     * @param length Number of elements in the view.
+     * @param dev Device and stream the memory belongs to.
+     */
+    DataBuffer(GPUDataT *gpu_data, std::size_t length,
+               const DevTag<DevTagT> &dev)
+        : length_{length}, dev_tag_{dev}, gpu_buffer_{gpu_data},
+          owns_memory_{false} {}
+
     // Buffer should never be default initialized
     DataBuffer() = delete;
 
@@ -70,13 +98,12 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
             int local_dev_id = -1;
             PL_CUDA_IS_SUCCESS(cudaGetDevice(&local_dev_id));
 
+            deallocate();
             length_ = other.length_;
             dev_tag_ =
                 DevTag<DevTagT>{local_dev_id, other.dev_tag_.getStreamID()};
-            dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length_));
+            allocator_ = other.allocator_;
+            allocate();
             CopyGpuDataToGpu(other.gpu_buffer_, other.length_);
         }
         return *this;
@@ -86,22 +113,21 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         if (this != &other) {
             int local_dev_id = -1;
             PL_CUDA_IS_SUCCESS(cudaGetDevice(&local_dev_id));
+            deallocate();
             length_ = other.length_;
+            allocator_ = other.allocator_;
             if (local_dev_id == other.dev_tag_.getDeviceID()) {
                 dev_tag_ = std::move(other.dev_tag_);
                 dev_tag_.refresh();
 
                 gpu_buffer_ = other.gpu_buffer_;
+                owns_memory_ = other.owns_memory_;
             } else {
                 dev_tag_ =
                     DevTag<DevTagT>{local_dev_id, other.dev_tag_.getStreamID()};
-                dev_tag_.refresh();
-
-                PL_CUDA_IS_SUCCESS(
-                    cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                               sizeof(GPUDataT) * length_));
+                allocate();
                 CopyGpuDataToGpu(other.gpu_buffer_, other.length_);
-                PL_CUDA_IS_SUCCESS(cudaFree(other.gpu_buffer_));
+                other.deallocate();
                 other.dev_tag_ = {};
             }
             other.length_ = 0;
@@ -110,25 +136,34 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         return *this;
     };
 
-    virtual ~DataBuffer() {
-        if (gpu_buffer_ != nullptr) {
-            PL_CUDA_IS_SUCCESS(cudaFree(gpu_buffer_));
-        }
-    };
+    virtual ~DataBuffer() { deallocate(); };
 
     /**
-     * @brief Zero-initialize the GPU buffer.
+     * @brief Zero-initialize the GPU buffer. The memset is enqueued on the
+     * stream of the buffer.
      *
      */
     void zeroInit() {
-        PL_CUDA_IS_SUCCESS(
-            cudaMemset(gpu_buffer_, 0, length_ * sizeof(GPUDataT)));
+        PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+            gpu_buffer_, 0, length_ * sizeof(GPUDataT), getStream()));
     }
 
     auto getData() -> GPUDataT * { return gpu_buffer_; }
     auto getData() const -> const GPUDataT * { return gpu_buffer_; }
     auto getLength() const { return length_; }
 
+    /**
+     * @brief Check whether the buffer frees its memory, i.e. is not a view.
+     */
+    auto ownsMemory() const -> bool { return owns_memory_; }
+
+    /**
+     * @brief Get the allocator the buffer memory comes from.
+     */
+    auto getAllocator() const -> const std::shared_ptr<DeviceAllocator> & {
+        return allocator_;
+    }
+
     /**
      * @brief Get the CUDA stream for the given object.
      *
@@ -159,9 +194,10 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                 getData(), gpu_in, sizeof(GPUDataT) * getLength(),
                 cudaMemcpyDeviceToDevice, getStream()));
         } else {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(getData(), gpu_in,
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+                getData(), gpu_in, sizeof(GPUDataT) * getLength(),
+                cudaMemcpyDefault, getStream()));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
         }
     }
 
@@ -176,40 +212,51 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
     /**
      * @brief Explicitly copy data from host memory to GPU device.
      *
+     * Synchronous copies, and copies with an explicit transfer mode, go
+     * through the TransferEngine of the device, which stages large pageable
+     * buffers through pinned memory.
      */
     template <class HostDataT = GPUDataT>
     void CopyHostDataToGpu(const HostDataT *host_in, std::size_t length,
-                           bool async = false) {
+                           bool async = false,
+                           TransferMode mode = TransferMode::Auto) {
         PL_ABORT_IF_NOT(
             (getLength() * sizeof(GPUDataT)) == (length * sizeof(HostDataT)),
             "Sizes do not match for host & GPU data. Please ensure the source "
             "buffer is not larger than the destination buffer");
-        if (async) {
+        if (async && mode == TransferMode::Auto) {
             PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
                 getData(), host_in, sizeof(GPUDataT) * getLength(),
                 cudaMemcpyHostToDevice, getStream()));
         } else {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(getData(), host_in,
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+            TransferEngine::getInstance(getDevice())
+                .copyHostToDevice(getData(), host_in,
+                                  sizeof(GPUDataT) * getLength(), getStream(),
+                                  mode);
         }
     }
 
     /**
      * @brief Explicitly copy data from GPU device to host memory.
      *
+     * Synchronous copies, and copies with an explicit transfer mode, go
+     * through the TransferEngine of the device, which stages large pageable
+     * buffers through pinned memory.
      */
     template <class HostDataT = GPUDataT>
-    inline void CopyGpuDataToHost(HostDataT *host_out, std::size_t length,
-                                  bool async = false) const {
+    inline void
+    CopyGpuDataToHost(HostDataT *host_out, std::size_t length,
+                      bool async = false,
+                      TransferMode mode = TransferMode::Auto) const {
         PL_ABORT_IF_NOT(
             (getLength() * sizeof(GPUDataT)) == (length * sizeof(HostDataT)),
             "Sizes do not match for host & GPU data. Please ensure the source "
             "buffer is not larger than the destination buffer");
-        if (!async) {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(host_out, getData(),
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+        if (!async || mode != TransferMode::Auto) {
+            TransferEngine::getInstance(getDevice())
+                .copyDeviceToHost(host_out, getData(),
+                                  sizeof(GPUDataT) * getLength(), getStream(),
+                                  mode);
         } else {
             PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
                 host_out, getData(), sizeof(GPUDataT) * getLength(),
@@ -221,5 +268,23 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
     std::size_t length_;
     DevTag<DevTagT> dev_tag_;
     GPUDataT *gpu_buffer_;
+    bool owns_memory_{true};
+    std::shared_ptr<DeviceAllocator> allocator_{DeviceAllocator::getDefault()};
+
+    void allocate() {
+        dev_tag_.refresh();
+        gpu_buffer_ = static_cast<GPUDataT *>(
+            allocator_->allocate(sizeof(GPUDataT) * length_,
+                                 dev_tag_.getDeviceID(), getStream()));
+        owns_memory_ = true;
+    }
+
+    void deallocate() {
+        if (owns_memory_ && gpu_buffer_ != nullptr) {
+            allocator_->deallocate(gpu_buffer_, sizeof(GPUDataT) * length_,
+                                   dev_tag_.getDeviceID(), getStream());
+        }
+        gpu_buffer_ = nullptr;
+    }
 };
 } // namespace Pennylane::CUDA
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Counters describing the device memory traffic of an allocator.
+ */
+struct AllocatorStats {
+    /// Number of allocation requests.
+    std::size_t num_requests{0};
+    /// Number of requests served from cached blocks.
+    std::size_t num_cache_hits{0};
+    /// Number of calls to cudaMalloc.
+    std::size_t num_device_allocations{0};
+    /// Number of calls to cudaFree.
+    std::size_t num_device_frees{0};
+    /// Bytes currently handed out to buffers.
+    std::size_t bytes_in_use{0};
+    /// Largest value reached by `bytes_in_use`.
+    std::size_t peak_bytes_in_use{0};
+    /// Bytes held in the cache, free for reuse.
+    std::size_t bytes_cached{0};
+};
+
+/**
+ * @brief Interface of the device memory allocators used by DataBuffer.
+ *
+ * Memory is requested and returned together with the device and the stream
+ * it is used on, so that implementations may reuse blocks in stream order.
+ */
+class DeviceAllocator {
+  public:
+    virtual ~DeviceAllocator() = default;
+
+    /**
+     * @brief Allocate device memory.
+     *
+     * @param bytes Number of bytes, larger than 0.
+     * @param device_id Device to allocate on, which must be current.
+     * @param stream_id Stream the memory is first used on.
+     * @return void* Device pointer.
+     */
+    virtual auto allocate(std::size_t bytes, int device_id,
+                          cudaStream_t stream_id) -> void * = 0;
+
+    /**
+     * @brief Return device memory obtained from `allocate`.
+     *
+     * @param ptr Device pointer.
+     * @param bytes Number of bytes requested at allocation.
+     * @param device_id Device the memory belongs to.
+     * @param stream_id Stream the memory was last used on.
+     */
+    virtual void deallocate(void *ptr, std::size_t bytes, int device_id,
+                            cudaStream_t stream_id) = 0;
+
+    /**
+     * @brief Free any memory the allocator holds on to. Must be called before
+     * resetting the devices.
+     */
+    virtual void releaseCached() {}
+
+    [[nodiscard]] virtual auto getStats() const -> AllocatorStats = 0;
+
+    /**
+     * @brief Get the allocator of newly created DataBuffer objects.
+     */
+    static auto getDefault() -> std::shared_ptr<DeviceAllocator>;
+
+    /**
+     * @brief Set the allocator of newly created DataBuffer objects. Existing
+     * buffers keep returning their memory to the allocator they got it from.
+     *
+     * @param allocator Allocator, or nullptr to restore the caching pool.
+     */
+    static void setDefault(std::shared_ptr<DeviceAllocator> allocator);
+};
+
+/**
+ * @brief Allocator calling cudaMalloc and cudaFree on every request. Each
+ * free implicitly synchronizes the device.
+ */
+class CudaMallocAllocator final : public DeviceAllocator {
+  public:
+    auto allocate(std::size_t bytes, [[maybe_unused]] int device_id,
+                  [[maybe_unused]] cudaStream_t stream_id) -> void * override {
+        void *ptr = nullptr;
+        PL_CUDA_IS_SUCCESS(cudaMalloc(&ptr, bytes));
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.num_requests++;
+        stats_.num_device_allocations++;
+        stats_.bytes_in_use += bytes;
+        stats_.peak_bytes_in_use =
+            std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+        return ptr;
+    }
+
+    void deallocate(void *ptr, std::size_t bytes,
+                    [[maybe_unused]] int device_id,
+                    [[maybe_unused]] cudaStream_t stream_id) override {
+        PL_CUDA_IS_SUCCESS(cudaFree(ptr));
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.num_device_frees++;
+        stats_.bytes_in_use -= bytes;
+    }
+
+    [[nodiscard]] auto getStats() const -> AllocatorStats override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+  private:
+    mutable std::mutex mutex_;
+    AllocatorStats stats_;
+};
+
+/**
+ * @brief Stream-ordered caching allocator, binning blocks per device by size
+ * class.
+ *
+ * Requests up to `max_bin_bytes` are rounded up to power-of-2 size classes.
+ * Larger requests, such as state-vectors, are rounded up to a multiple of
+ * `large_granularity` only, so that they are not inflated up to twice their
+ * size, and reuse the smallest cached block that fits them within an eighth
+ * of their size.
+ *
+ * Returned blocks are kept in their bin rather than freed, and an event is
+ * recorded on the stream they were last used on. A later request fitting a
+ * cached block on the same device reuses it without any synchronization
+ * if it comes from the same stream, whose ordering protects the pending work,
+ * or if the block's event shows that work has completed. Otherwise a new
+ * block is allocated. Should cudaMalloc run out of memory, the cached blocks
+ * of the device are freed and the allocation is retried.
+ *
+ * The cache is bounded, so that idle blocks do not hold memory away from the
+ * library workspaces and other processes. Returning a block past the bound
+ * frees the oldest blocks of its device, largest size classes first.
+ */
+class CachingDeviceAllocator final : public DeviceAllocator {
+  public:
+    /// Smallest size class in bytes.
+    static constexpr std::size_t min_bin_bytes = 512;
+    /// Largest power-of-2 size class in bytes.
+    static constexpr std::size_t max_bin_bytes = std::size_t{1} << 20U;
+    /// Granularity in bytes of the blocks of larger requests.
+    static constexpr std::size_t large_granularity = std::size_t{2} << 20U;
+    /// Larger requests reuse blocks larger by at most this fraction of them.
+    static constexpr std::size_t max_waste_divisor = 8;
+    /// Fraction of the device memory cached by default.
+    static constexpr std::size_t default_cache_divisor = 4;
+
+    /**
+     * @brief Create an empty cache.
+     *
+     * @param max_cached_bytes Bytes the cache may hold before freeing the
+     * returned blocks.
+     */
+    explicit CachingDeviceAllocator(
+        std::size_t max_cached_bytes = getDefaultMaxCachedBytes())
+        : max_cached_bytes_{max_cached_bytes} {}
+    CachingDeviceAllocator(const CachingDeviceAllocator &) = delete;
+    CachingDeviceAllocator &operator=(const CachingDeviceAllocator &) = delete;
+
+    ~CachingDeviceAllocator() override {
+        // Errors are ignored, as the CUDA runtime may already be shut down
+        for (auto &[key, bin] : cached_) {
+            for (auto &block : bin) {
+                cudaEventDestroy(block.event);
+                cudaFree(block.ptr);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the default bound of the cache: the value in bytes of the
+     * `PL_GPU_MAX_CACHED_BYTES` environment variable if it is set, and
+     * otherwise a quarter of the memory of the current device.
+     */
+    [[nodiscard]] static auto getDefaultMaxCachedBytes() -> std::size_t {
+        if (const char *value = std::getenv("PL_GPU_MAX_CACHED_BYTES")) {
+            char *end = nullptr;
+            const auto max_cached_bytes = std::strtoull(value, &end, 10);
+            const bool is_valid = (end != value && *end == '\0');
+            PL_ABORT_IF_NOT(is_valid, "PL_GPU_MAX_CACHED_BYTES must be a "
+                                      "number of bytes.");
+            return static_cast<std::size_t>(max_cached_bytes);
+        }
+        std::size_t free_bytes = 0;
+        std::size_t total_bytes = 0;
+        PL_CUDA_IS_SUCCESS(cudaMemGetInfo(&free_bytes, &total_bytes));
+        return total_bytes / default_cache_divisor;
+    }
+
+    [[nodiscard]] auto getMaxCachedBytes() const -> std::size_t {
+        return max_cached_bytes_;
+    }
+
+    /**
+     * @brief Get the size class of a request: the next power of 2 up to
+     * `max_bin_bytes`, and the next multiple of `large_granularity` above.
+     */
+    [[nodiscard]] static auto getBinBytes(std::size_t bytes) -> std::size_t {
+        if (bytes > max_bin_bytes) {
+            return (bytes + large_granularity - 1) / large_granularity *
+                   large_granularity;
+        }
+        std::size_t bin_bytes = min_bin_bytes;
+        while (bin_bytes < bytes) {
+            bin_bytes <<= 1U;
+        }
+        return bin_bytes;
+    }
+
+    auto allocate(std::size_t bytes, int device_id, cudaStream_t stream_id)
+        -> void * override {
+        const std::size_t bin_bytes = getBinBytes(bytes);
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.num_requests++;
+
+        // Small requests use their size class only, large ones the best fit
+        const std::size_t max_fit_bytes =
+            (bin_bytes > max_bin_bytes)
+                ? bin_bytes + bin_bytes / max_waste_divisor
+                : bin_bytes;
+        for (auto bin_it = cached_.lower_bound({device_id, bin_bytes});
+             bin_it != cached_.end() && bin_it->first.first == device_id &&
+             bin_it->first.second <= max_fit_bytes;
+             ++bin_it) {
+            auto &bin = bin_it->second;
+            for (auto it = bin.rbegin(); it != bin.rend(); ++it) {
+                if (it->stream_id == stream_id ||
+                    cudaEventQuery(it->event) == cudaSuccess) {
+                    Block block = *it;
+                    bin.erase(std::next(it).base());
+                    block.stream_id = stream_id;
+                    stats_.num_cache_hits++;
+                    stats_.bytes_cached -= block.bytes;
+                    return handOut(block);
+                }
+            }
+        }
+
+        Block block{nullptr, bin_bytes, device_id, stream_id, nullptr};
+        cudaError_t err = cudaMalloc(&block.ptr, bin_bytes);
+        if (err == cudaErrorMemoryAllocation) {
+            // Clear the error, then retry with the cache of the device emptied
+            cudaGetLastError();
+            releaseDevice(device_id);
+            err = cudaMalloc(&block.ptr, bin_bytes);
+        }
+        PL_CUDA_IS_SUCCESS(err);
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&block.event, cudaEventDisableTiming));
+        stats_.num_device_allocations++;
+        return handOut(block);
+    }
+
+    void deallocate(void *ptr, [[maybe_unused]] std::size_t bytes,
+                    [[maybe_unused]] int device_id,
+                    cudaStream_t stream_id) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = live_.find(ptr);
+        PL_ABORT_IF(it == live_.end(),
+                    "Pointer was not allocated by this allocator.");
+        Block block = it->second;
+        live_.erase(it);
+        stats_.bytes_in_use -= block.bytes;
+
+        block.stream_id = stream_id;
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(block.event, stream_id));
+        cached_[{block.device_id, block.bytes}].push_back(block);
+        stats_.bytes_cached += block.bytes;
+        if (stats_.bytes_cached > max_cached_bytes_) {
+            trimDevice(block.device_id);
+        }
+    }
+
+    void releaseCached() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &[key, bin] : cached_) {
+            for (auto &block : bin) {
+                freeBlock(block);
+            }
+            bin.clear();
+        }
+    }
+
+    [[nodiscard]] auto getStats() const -> AllocatorStats override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+  private:
+    struct Block {
+        void *ptr;
+        std::size_t bytes; // Size class
+        int device_id;
+        cudaStream_t stream_id;
+        cudaEvent_t event;
+    };
+
+    std::size_t max_cached_bytes_;
+    mutable std::mutex mutex_;
+    std::map<std::pair<int, std::size_t>, std::vector<Block>> cached_;
+    std::unordered_map<void *, Block> live_;
+    AllocatorStats stats_;
+
+    auto handOut(const Block &block) -> void * {
+        live_.emplace(block.ptr, block);
+        stats_.bytes_in_use += block.bytes;
+        stats_.peak_bytes_in_use =
+            std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+        return block.ptr;
+    }
+
+    void freeBlock(const Block &block) {
+        // cudaFree waits for the work using the block
+        PL_CUDA_IS_SUCCESS(cudaEventDestroy(block.event));
+        PL_CUDA_IS_SUCCESS(cudaFree(block.ptr));
+        stats_.num_device_frees++;
+        stats_.bytes_cached -= block.bytes;
+    }
+
+    /**
+     * @brief Free the oldest blocks of a device, largest size classes first,
+     * until the cache is within its bound.
+     */
+    void trimDevice(int device_id) {
+        for (auto it = cached_.rbegin(); it != cached_.rend(); ++it) {
+            if (it->first.first != device_id) {
+                continue;
+            }
+            auto &bin = it->second;
+            std::size_t num_freed = 0;
+            while (num_freed < bin.size() &&
+                   stats_.bytes_cached > max_cached_bytes_) {
+                freeBlock(bin[num_freed++]);
+            }
+            bin.erase(bin.begin(),
+                      bin.begin() + static_cast<std::ptrdiff_t>(num_freed));
+            if (stats_.bytes_cached <= max_cached_bytes_) {
+                return;
+            }
+        }
+    }
+
+    void releaseDevice(int device_id) {
+        for (auto &[key, bin] : cached_) {
+            if (key.first != device_id) {
+                continue;
+            }
+            for (auto &block : bin) {
+                freeBlock(block);
+            }
+            bin.clear();
+        }
+    }
+};
+
+/// @cond DEV
+namespace detail {
+inline auto defaultAllocatorSlot() -> std::shared_ptr<DeviceAllocator> & {
+    static std::shared_ptr<DeviceAllocator> allocator =
+        std::make_shared<CachingDeviceAllocator>();
+    return allocator;
+}
+inline auto defaultAllocatorMutex() -> std::mutex & {
+    static std::mutex mutex;
+    return mutex;
+}
+} // namespace detail
+/// @endcond
+
+inline auto DeviceAllocator::getDefault() -> std::shared_ptr<DeviceAllocator> {
+    std::lock_guard<std::mutex> lock(detail::defaultAllocatorMutex());
+    return detail::defaultAllocatorSlot();
+}
+
+inline void
+DeviceAllocator::setDefault(std::shared_ptr<DeviceAllocator> allocator) {
+    std::lock_guard<std::mutex> lock(detail::defaultAllocatorMutex());
+    detail::defaultAllocatorSlot() =
+        (allocator) ? std::move(allocator)
+                    : std::make_shared<CachingDeviceAllocator>();
+}
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "DevicePool.hpp"
+#include "TSQueue.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Persistent pool of worker threads, one per GPU device, pulling tasks
+ * from a shared queue.
+ *
+ * Tasks are not bound to a device ahead of time: whichever worker is idle
+ * takes the next task, so uneven task costs are balanced across the devices
+ * as they run. The workers are started on the first submission and live until
+ * the executor is destroyed, and each worker keeps a store of device-local
+ * state (e.g. warm state-vectors) that persists across tasks and calls.
+ *
+ * @tparam DeviceIndexType Device index type.
+ */
+template <typename DeviceIndexType = int> class DeviceExecutor {
+  public:
+    using Task = std::function<void(DeviceIndexType)>;
+
+    /**
+     * @brief Create an executor over the first `num_devices` devices.
+     *
+     * @param num_devices Number of devices, and hence of workers.
+     */
+    explicit DeviceExecutor(std::size_t num_devices =
+                                DevicePool<DeviceIndexType>::getTotalDevices())
+        : workers_(num_devices) {}
+    DeviceExecutor(const DeviceExecutor &) = delete;
+    DeviceExecutor(DeviceExecutor &&) = delete;
+    DeviceExecutor &operator=(const DeviceExecutor &) = delete;
+    DeviceExecutor &operator=(DeviceExecutor &&) = delete;
+
+    ~DeviceExecutor() {
+        std::lock_guard<std::mutex> lock(start_mutex_);
+        if (!started_) {
+            return;
+        }
+        // An invalid task stops the worker popping it
+        for (std::size_t i = 0; i < workers_.size(); i++) {
+            tasks_.push(std::packaged_task<void(DeviceIndexType)>{});
+        }
+        for (auto &worker : workers_) {
+            worker.thread.join();
+        }
+    }
+
+    /**
+     * @brief Get the executor shared by the process, over all devices.
+     */
+    static auto getInstance() -> DeviceExecutor & {
+        static DeviceExecutor instance;
+        return instance;
+    }
+
+    /**
+     * @brief Queue a task to run on the next idle device.
+     *
+     * @param task Task receiving the index of the device it runs on, which is
+     * the current device of the calling thread.
+     * @return std::future<void> Future holding any exception thrown by the
+     * task.
+     */
+    auto submit(Task task) -> std::future<void> {
+        PL_ABORT_IF(workers_.empty(), "No GPU device available.");
+        start();
+        // Exceptions, including a failure to select the device, are stored in
+        // the future of the task
+        std::packaged_task<void(DeviceIndexType)> packaged(
+            [task = std::move(task)](DeviceIndexType dev_id) {
+                DevicePool<DeviceIndexType>::setDeviceIdx(dev_id);
+                task(dev_id);
+            });
+        auto future = packaged.get_future();
+        tasks_.push(std::move(packaged));
+        return future;
+    }
+
+    /**
+     * @brief Get the device-local state of type `StateT` of the worker of a
+     * device, default-constructing it on first use. Must only be called from
+     * a task running on that device, which has exclusive access to it.
+     *
+     * @tparam StateT State type.
+     * @param dev_id Device index given to the task.
+     */
+    template <class StateT>
+    auto getLocalState(DeviceIndexType dev_id) -> StateT & {
+        auto &slot = workers_.at(static_cast<std::size_t>(dev_id))
+                         .local_state[std::type_index(typeid(StateT))];
+        if (!slot) {
+            slot = std::make_shared<StateT>();
+        }
+        return *std::static_pointer_cast<StateT>(slot);
+    }
+
+    /**
+     * @brief Release the device-local state of all workers, waiting for the
+     * tasks currently running. Must be called while the CUDA runtime is still
+     * alive if the state holds device memory.
+     */
+    void clearLocalState() {
+        for (auto &worker : workers_) {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.local_state.clear();
+        }
+    }
+
+    [[nodiscard]] auto getNumWorkers() const -> std::size_t {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Get the number of tasks started so far by the worker of a device.
+     */
+    [[nodiscard]] auto getNumTasksStarted(DeviceIndexType dev_id) const
+        -> std::size_t {
+        return workers_.at(static_cast<std::size_t>(dev_id))
+            .num_tasks_started;
+    }
+
+  private:
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex; // Held while running a task
+        std::unordered_map<std::type_index, std::shared_ptr<void>> local_state;
+        std::atomic<std::size_t> num_tasks_started{0};
+    };
+
+    TSQueue<std::packaged_task<void(DeviceIndexType)>> tasks_;
+    std::vector<Worker> workers_;
+    std::mutex start_mutex_;
+    bool started_{false};
+
+    void start() {
+        std::lock_guard<std::mutex> lock(start_mutex_);
+        if (started_) {
+            return;
+        }
+        for (std::size_t i = 0; i < workers_.size(); i++) {
+            workers_[i].thread = std::thread(
+                &DeviceExecutor::run, this, static_cast<DeviceIndexType>(i));
+        }
+        started_ = true;
+    }
+
+    void run(DeviceIndexType dev_id) {
+        Worker &worker = workers_[static_cast<std::size_t>(dev_id)];
+        while (true) {
+            std::packaged_task<void(DeviceIndexType)> task;
+            tasks_.wait_and_pop(task);
+            if (!task.valid()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.num_tasks_started++;
+            task(dev_id);
+        }
+    }
+};
+
+} // namespace Pennylane::CUDA
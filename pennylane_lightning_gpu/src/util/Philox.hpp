@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file Philox.hpp
+ * Counter-based Philox4x32-10 random number generator.
+ */
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Counter-based Philox4x32-10 generator (Salmon et al., SC'11), as
+ * implemented by cuRAND and Random123.
+ *
+ * Each 128-bit block of output is a pure function of the seed and of a
+ * block counter, so a stream is reproduced exactly from its seed, and any
+ * position of it can be reached without generating the preceding blocks.
+ */
+class Philox4x32 {
+  public:
+    using Block = std::array<std::uint32_t, 4>;
+
+    explicit Philox4x32(std::uint64_t seed = 0) { setSeed(seed); }
+
+    /**
+     * @brief Restart the stream of the given seed from its first block.
+     */
+    void setSeed(std::uint64_t seed) {
+        seed_ = seed;
+        counter_ = 0;
+    }
+
+    [[nodiscard]] auto getSeed() const -> std::uint64_t { return seed_; }
+
+    /**
+     * @brief Get the index of the next block to be generated.
+     */
+    [[nodiscard]] auto getCounter() const -> std::uint64_t {
+        return counter_;
+    }
+
+    /**
+     * @brief Get the block of the given index of the stream, leaving the
+     * position of the generator unchanged.
+     */
+    [[nodiscard]] auto block(std::uint64_t index) const -> Block {
+        return generate({static_cast<std::uint32_t>(index),
+                         static_cast<std::uint32_t>(index >> 32U), 0, 0},
+                        {static_cast<std::uint32_t>(seed_),
+                         static_cast<std::uint32_t>(seed_ >> 32U)});
+    }
+
+    /**
+     * @brief Apply the ten rounds of Philox4x32 to a counter.
+     *
+     * @param ctr 128-bit counter.
+     * @param key 64-bit key.
+     */
+    static auto generate(Block ctr, std::array<std::uint32_t, 2> key)
+        -> Block {
+        for (std::size_t round = 0; round < 10; round++) {
+            const std::uint64_t prod0 = std::uint64_t{M0} * ctr[0];
+            const std::uint64_t prod1 = std::uint64_t{M1} * ctr[2];
+            ctr = {static_cast<std::uint32_t>(prod1 >> 32U) ^ ctr[1] ^ key[0],
+                   static_cast<std::uint32_t>(prod1),
+                   static_cast<std::uint32_t>(prod0 >> 32U) ^ ctr[3] ^ key[1],
+                   static_cast<std::uint32_t>(prod0)};
+            key[0] += W0;
+            key[1] += W1;
+        }
+        return ctr;
+    }
+
+    /**
+     * @brief Fill an array with uniform doubles in [0, 1), with 53 random
+     * bits each, and advance the stream past the blocks used.
+     *
+     * Each block gives two doubles. A call always starts on a new block, so
+     * the output of a call only depends on the seed and on the sizes of the
+     * previous calls.
+     *
+     * @param out Host array to fill.
+     * @param length Number of elements of `out`.
+     */
+    void fillUniform(double *out, std::size_t length) {
+        for (std::size_t i = 0; i < length; i += 2) {
+            const Block bits = block(counter_++);
+            out[i] = toUniform(bits[0], bits[1]);
+            if (i + 1 < length) {
+                out[i + 1] = toUniform(bits[2], bits[3]);
+            }
+        }
+    }
+
+  private:
+    static constexpr std::uint32_t M0 = 0xD2511F53U;
+    static constexpr std::uint32_t M1 = 0xCD9E8D57U;
+    static constexpr std::uint32_t W0 = 0x9E3779B9U;
+    static constexpr std::uint32_t W1 = 0xBB67AE85U;
+
+    static auto toUniform(std::uint32_t hi, std::uint32_t lo) -> double {
+        // 27 + 26 bits, as in genrand_res53
+        return ((hi >> 5U) * 67108864.0 + (lo >> 6U)) / 9007199254740992.0;
+    }
+
+    std::uint64_t seed_{0};
+    std::uint64_t counter_{0};
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "Error.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Pinned host memory through which small host-to-device copies are
+ * enqueued on a stream without blocking the host.
+ *
+ * A `cudaMemcpyAsync` from pageable memory waits for the work queued on its
+ * stream before copying, so uploading a gate matrix in the middle of a circuit
+ * stalls the host until all previous gates have run. The pool instead copies
+ * the source into a pinned block on the host and enqueues the DMA from there,
+ * so the upload is ordered on the stream like a kernel launch and the source
+ * can be reused as soon as the call returns.
+ *
+ * Blocks are filled one after the other. A block is refilled only once the
+ * copies recorded on it have completed, and a new block is allocated when none
+ * is free, so the host waits only for copies larger than a block. These are
+ * made directly, through a pageable `cudaMemcpyAsync`.
+ *
+ * All copies go to the device current at the call, on the stream given at
+ * construction.
+ */
+class StagingPool {
+  public:
+    /// Default size in bytes of each pinned block.
+    static constexpr std::size_t default_block_bytes = std::size_t{1} << 20U;
+
+    /**
+     * @brief Counters of the copies made through a pool.
+     */
+    struct Stats {
+        std::size_t num_staged{0};
+        std::size_t num_direct{0};
+        std::size_t num_blocks{0};
+        std::size_t bytes_staged{0};
+    };
+
+    /**
+     * @brief Create a pool for a stream. No pinned memory is allocated until
+     * the first staged copy.
+     *
+     * @param stream_id Stream the copies are enqueued on.
+     * @param block_bytes Size in bytes of each pinned block.
+     */
+    explicit StagingPool(cudaStream_t stream_id = 0,
+                         std::size_t block_bytes = default_block_bytes)
+        : stream_id_{stream_id}, block_bytes_{block_bytes} {
+        PL_ABORT_IF(block_bytes_ == 0, "Blocks must hold at least one byte.");
+    }
+    StagingPool(const StagingPool &) = delete;
+    StagingPool &operator=(const StagingPool &) = delete;
+    ~StagingPool() { release(); }
+
+    /**
+     * @brief Enqueue a copy of host memory to the device on the stream of the
+     * pool. The host memory may be modified once the call returns.
+     *
+     * @param dst Device pointer.
+     * @param src Host pointer.
+     * @param bytes Number of bytes.
+     */
+    void copyHostToDevice(void *dst, const void *src, std::size_t bytes) {
+        if (bytes == 0) {
+            return;
+        }
+        if (bytes > block_bytes_) {
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, src, bytes,
+                                               cudaMemcpyHostToDevice,
+                                               stream_id_));
+            stats_.num_direct++;
+            return;
+        }
+
+        Block &block = acquire(bytes);
+        char *staged = block.data + block.used;
+        std::memcpy(staged, src, bytes);
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, staged, bytes,
+                                           cudaMemcpyHostToDevice, stream_id_));
+        // The event tracks the last copy out of the block
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(block.done, stream_id_));
+        block.used += alignUp(bytes);
+        stats_.num_staged++;
+        stats_.bytes_staged += bytes;
+    }
+
+    /**
+     * @brief Free the pinned blocks, once the copies out of them have
+     * completed. Blocks are allocated again by the next staged copy.
+     */
+    void release() {
+        // Errors are ignored, as the CUDA runtime may already be shut down
+        for (auto &block : blocks_) {
+            cudaEventSynchronize(block.done);
+            cudaEventDestroy(block.done);
+            cudaFreeHost(block.data);
+        }
+        blocks_.clear();
+        current_ = 0;
+    }
+
+    [[nodiscard]] auto getBlockBytes() const -> std::size_t {
+        return block_bytes_;
+    }
+
+    [[nodiscard]] auto getStats() const -> Stats { return stats_; }
+
+  private:
+    /// Alignment of the copies within a block.
+    static constexpr std::size_t alignment_ = 256;
+
+    struct Block {
+        char *data;
+        std::size_t used;
+        cudaEvent_t done;
+    };
+
+    cudaStream_t stream_id_;
+    std::size_t block_bytes_;
+    std::vector<Block> blocks_;
+    std::size_t current_{0};
+    Stats stats_;
+
+    static auto alignUp(std::size_t bytes) -> std::size_t {
+        return (bytes + alignment_ - 1) / alignment_ * alignment_;
+    }
+
+    /**
+     * @brief Get a block with room for `bytes`, moving to the next free block
+     * or allocating one when the current block is full.
+     */
+    auto acquire(std::size_t bytes) -> Block & {
+        if (!blocks_.empty() &&
+            blocks_[current_].used + bytes <= block_bytes_) {
+            return blocks_[current_];
+        }
+        for (std::size_t i = 1; i <= blocks_.size(); i++) {
+            const std::size_t next = (current_ + i) % blocks_.size();
+            const cudaError_t status = cudaEventQuery(blocks_[next].done);
+            if (status == cudaSuccess) {
+                current_ = next;
+                blocks_[current_].used = 0;
+                return blocks_[current_];
+            }
+            PL_ABORT_IF_NOT(status == cudaErrorNotReady,
+                            cudaGetErrorString(status));
+        }
+
+        Block block{nullptr, 0, nullptr};
+        PL_CUDA_IS_SUCCESS(cudaMallocHost(
+            reinterpret_cast<void **>(&block.data), block_bytes_));
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&block.done, cudaEventDisableTiming));
+        blocks_.push_back(block);
+        current_ = blocks_.size() - 1;
+        stats_.num_blocks++;
+        return blocks_[current_];
+    }
+};
+
+} // namespace Pennylane::CUDA
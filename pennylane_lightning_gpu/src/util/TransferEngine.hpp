@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Error.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief How host memory is moved to and from a device.
+ */
+enum class TransferMode {
+    /// Staged for large pageable buffers, direct otherwise.
+    Auto,
+    /// A single copy on the stream.
+    Direct,
+    /// Chunks pipelined through pinned bounce buffers on two streams.
+    Staged,
+    /// The host buffer is page-locked for the duration of the copy.
+    Registered,
+};
+
+/**
+ * @brief Parse a transfer mode from its lower-case name.
+ */
+inline auto transferModeFromString(const std::string &name) -> TransferMode {
+    if (name == "auto") {
+        return TransferMode::Auto;
+    }
+    if (name == "direct") {
+        return TransferMode::Direct;
+    }
+    if (name == "staged") {
+        return TransferMode::Staged;
+    }
+    if (name == "registered") {
+        return TransferMode::Registered;
+    }
+    std::string message = "Unknown transfer mode " + name +
+                          ". Expected one of auto, direct, staged or "
+                          "registered.";
+    throw Pennylane::Util::LightningException(message);
+}
+
+/**
+ * @brief Copy engine between pageable host memory and one device.
+ *
+ * A copy from pageable memory is performed by the driver through its own
+ * small pinned buffer, one block after the other, and blocks the host. The
+ * staged mode instead splits the copy into chunks moved through two pinned
+ * bounce buffers, alternating between two streams, so that the host copy of
+ * one chunk overlaps the DMA of the other. The bounce buffers are allocated
+ * on first use and reused by later copies. The registered mode page-locks the
+ * host buffer itself, which pays off for large buffers copied once.
+ *
+ * All copies are ordered after the work queued on the stream passed in, and
+ * have completed when the call returns.
+ */
+class TransferEngine {
+  public:
+    /// Default size in bytes of each of the two bounce buffers.
+    static constexpr std::size_t default_chunk_bytes = std::size_t{8} << 20U;
+
+    /**
+     * @brief Counters of the copies performed by an engine.
+     */
+    struct Stats {
+        std::size_t num_direct{0};
+        std::size_t num_staged{0};
+        std::size_t num_registered{0};
+        std::size_t num_chunks{0};
+        std::size_t bytes_transferred{0};
+    };
+
+    /**
+     * @brief Create an engine for a device. No resources are allocated until
+     * the first staged copy.
+     *
+     * @param device_id Device the copies go to and come from.
+     * @param chunk_bytes Size in bytes of each bounce buffer.
+     */
+    explicit TransferEngine(int device_id,
+                            std::size_t chunk_bytes = default_chunk_bytes)
+        : device_id_{device_id}, chunk_bytes_{chunk_bytes} {
+        PL_ABORT_IF(chunk_bytes_ == 0, "Chunks must hold at least one byte.");
+    }
+    TransferEngine(const TransferEngine &) = delete;
+    TransferEngine &operator=(const TransferEngine &) = delete;
+
+    ~TransferEngine() { release(); }
+
+    /**
+     * @brief Get the engine shared by the process for a device.
+     */
+    static auto getInstance(int device_id) -> TransferEngine & {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto &engine = registry()[device_id];
+        if (!engine) {
+            engine = std::make_unique<TransferEngine>(device_id);
+        }
+        return *engine;
+    }
+
+    /**
+     * @brief Release the pinned memory and streams of all shared engines.
+     * Must be called before resetting the devices.
+     */
+    static void releaseAll() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (auto &[device_id, engine] : registry()) {
+            engine->release();
+        }
+    }
+
+    /**
+     * @brief Copy host memory to the device.
+     *
+     * @param dst Device pointer.
+     * @param src Host pointer.
+     * @param bytes Number of bytes.
+     * @param stream_id Stream whose queued work the copy is ordered after.
+     * @param mode Transfer mode.
+     */
+    void copyHostToDevice(void *dst, const void *src, std::size_t bytes,
+                          cudaStream_t stream_id,
+                          TransferMode mode = TransferMode::Auto) {
+        if (bytes == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        const DeviceGuard guard(device_id_);
+        switch (resolve(mode, src, bytes)) {
+        case TransferMode::Staged: {
+            init();
+            waitFor(stream_id);
+            auto *dst_bytes = static_cast<char *>(dst);
+            const auto *src_bytes = static_cast<const char *>(src);
+            std::size_t chunk = 0;
+            for (std::size_t offset = 0; offset < bytes;
+                 offset += chunk_bytes_, chunk++) {
+                const std::size_t slot = chunk % 2;
+                const std::size_t size = std::min(chunk_bytes_, bytes - offset);
+                // The previous copy out of this bounce buffer must be done
+                PL_CUDA_IS_SUCCESS(cudaEventSynchronize(done_[slot]));
+                std::memcpy(pinned_[slot], src_bytes + offset, size);
+                PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+                    dst_bytes + offset, pinned_[slot], size,
+                    cudaMemcpyHostToDevice, streams_[slot]));
+                PL_CUDA_IS_SUCCESS(
+                    cudaEventRecord(done_[slot], streams_[slot]));
+            }
+            synchronize();
+            stats_.num_staged++;
+            stats_.num_chunks += chunk;
+            break;
+        }
+        case TransferMode::Registered: {
+            const bool registered = registerHost(src, bytes);
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, src, bytes,
+                                               cudaMemcpyHostToDevice,
+                                               stream_id));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
+            if (registered) {
+                PL_CUDA_IS_SUCCESS(cudaHostUnregister(const_cast<void *>(src)));
+            }
+            stats_.num_registered++;
+            break;
+        }
+        default:
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, src, bytes,
+                                               cudaMemcpyDefault, stream_id));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
+            stats_.num_direct++;
+        }
+        stats_.bytes_transferred += bytes;
+    }
+
+    /**
+     * @brief Copy device memory to the host.
+     *
+     * @param dst Host pointer.
+     * @param src Device pointer.
+     * @param bytes Number of bytes.
+     * @param stream_id Stream whose queued work the copy is ordered after.
+     * @param mode Transfer mode.
+     */
+    void copyDeviceToHost(void *dst, const void *src, std::size_t bytes,
+                          cudaStream_t stream_id,
+                          TransferMode mode = TransferMode::Auto) {
+        if (bytes == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        const DeviceGuard guard(device_id_);
+        switch (resolve(mode, dst, bytes)) {
+        case TransferMode::Staged: {
+            init();
+            waitFor(stream_id);
+            auto *dst_bytes = static_cast<char *>(dst);
+            const auto *src_bytes = static_cast<const char *>(src);
+            const std::size_t num_chunks =
+                (bytes + chunk_bytes_ - 1) / chunk_bytes_;
+            auto issue = [&](std::size_t chunk) {
+                const std::size_t slot = chunk % 2;
+                const std::size_t offset = chunk * chunk_bytes_;
+                PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+                    pinned_[slot], src_bytes + offset,
+                    std::min(chunk_bytes_, bytes - offset),
+                    cudaMemcpyDeviceToHost, streams_[slot]));
+                PL_CUDA_IS_SUCCESS(
+                    cudaEventRecord(done_[slot], streams_[slot]));
+            };
+            issue(0);
+            for (std::size_t chunk = 0; chunk < num_chunks; chunk++) {
+                // Keep the next chunk in flight while this one is unpacked
+                if (chunk + 1 < num_chunks) {
+                    issue(chunk + 1);
+                }
+                const std::size_t slot = chunk % 2;
+                const std::size_t offset = chunk * chunk_bytes_;
+                PL_CUDA_IS_SUCCESS(cudaEventSynchronize(done_[slot]));
+                std::memcpy(dst_bytes + offset, pinned_[slot],
+                            std::min(chunk_bytes_, bytes - offset));
+            }
+            stats_.num_staged++;
+            stats_.num_chunks += num_chunks;
+            break;
+        }
+        case TransferMode::Registered: {
+            const bool registered = registerHost(dst, bytes);
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, src, bytes,
+                                               cudaMemcpyDeviceToHost,
+                                               stream_id));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
+            if (registered) {
+                PL_CUDA_IS_SUCCESS(cudaHostUnregister(dst));
+            }
+            stats_.num_registered++;
+            break;
+        }
+        default:
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(dst, src, bytes,
+                                               cudaMemcpyDefault, stream_id));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream_id));
+            stats_.num_direct++;
+        }
+        stats_.bytes_transferred += bytes;
+    }
+
+    /**
+     * @brief Free the bounce buffers and streams. They are allocated again by
+     * the next staged copy.
+     */
+    void release() {
+        if (!initialized_) {
+            return;
+        }
+        // Errors are ignored, as the CUDA runtime may already be shut down
+        for (std::size_t slot = 0; slot < 2; slot++) {
+            cudaEventDestroy(done_[slot]);
+            cudaStreamDestroy(streams_[slot]);
+            cudaFreeHost(pinned_[slot]);
+        }
+        cudaEventDestroy(ready_);
+        initialized_ = false;
+    }
+
+    [[nodiscard]] auto getChunkBytes() const -> std::size_t {
+        return chunk_bytes_;
+    }
+
+    [[nodiscard]] auto getStats() const -> Stats {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * @brief Check whether memory is pageable host memory, which the driver
+     * cannot copy by DMA without staging. Pinned, device and managed memory
+     * are not.
+     */
+    [[nodiscard]] static auto isPageable(const void *ptr) -> bool {
+        cudaPointerAttributes attributes{};
+        if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+            // Older runtimes report pageable memory as an error
+            cudaGetLastError();
+            return true;
+        }
+        return attributes.type == cudaMemoryTypeUnregistered;
+    }
+
+  private:
+    /// Selects a device for the lifetime of a scope.
+    class DeviceGuard {
+      public:
+        explicit DeviceGuard(int device_id) {
+            PL_CUDA_IS_SUCCESS(cudaGetDevice(&previous_));
+            PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id));
+        }
+        DeviceGuard(const DeviceGuard &) = delete;
+        DeviceGuard &operator=(const DeviceGuard &) = delete;
+        ~DeviceGuard() { cudaSetDevice(previous_); }
+
+      private:
+        int previous_{0};
+    };
+
+    int device_id_;
+    std::size_t chunk_bytes_;
+    bool initialized_{false};
+    std::array<void *, 2> pinned_{nullptr, nullptr};
+    std::array<cudaStream_t, 2> streams_{};
+    std::array<cudaEvent_t, 2> done_{};
+    cudaEvent_t ready_{};
+    mutable std::mutex mutex_;
+    Stats stats_;
+
+    static auto registry() -> std::map<int, std::unique_ptr<TransferEngine>> & {
+        static std::map<int, std::unique_ptr<TransferEngine>> engines;
+        return engines;
+    }
+    static auto registryMutex() -> std::mutex & {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    auto resolve(TransferMode mode, const void *host_ptr,
+                 std::size_t bytes) const -> TransferMode {
+        if (mode != TransferMode::Auto) {
+            return mode;
+        }
+        return (bytes > chunk_bytes_ && isPageable(host_ptr))
+                   ? TransferMode::Staged
+                   : TransferMode::Direct;
+    }
+
+    void init() {
+        if (initialized_) {
+            return;
+        }
+        for (std::size_t slot = 0; slot < 2; slot++) {
+            PL_CUDA_IS_SUCCESS(cudaMallocHost(&pinned_[slot], chunk_bytes_));
+            PL_CUDA_IS_SUCCESS(cudaStreamCreateWithFlags(
+                &streams_[slot], cudaStreamNonBlocking));
+            PL_CUDA_IS_SUCCESS(cudaEventCreateWithFlags(
+                &done_[slot], cudaEventDisableTiming));
+            // Leave the event complete, so the first wait returns at once
+            PL_CUDA_IS_SUCCESS(cudaEventRecord(done_[slot], streams_[slot]));
+        }
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&ready_, cudaEventDisableTiming));
+        initialized_ = true;
+    }
+
+    /**
+     * @brief Order the copy streams after the work queued on a stream.
+     */
+    void waitFor(cudaStream_t stream_id) {
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(ready_, stream_id));
+        for (auto stream : streams_) {
+            PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(stream, ready_, 0));
+        }
+    }
+
+    void synchronize() {
+        for (auto stream : streams_) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream));
+        }
+    }
+
+    /**
+     * @brief Page-lock host memory.
+     *
+     * @return bool Whether the memory was registered by this call, and must
+     * be unregistered.
+     */
+    static auto registerHost(const void *ptr, std::size_t bytes) -> bool {
+        const auto err = cudaHostRegister(const_cast<void *>(ptr), bytes,
+                                          cudaHostRegisterDefault);
+        if (err == cudaErrorHostMemoryAlreadyRegistered) {
+            cudaGetLastError();
+            return false;
+        }
+        PL_CUDA_IS_SUCCESS(err);
+        return true;
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "cuda.h"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Device scratch memory reused across library calls requiring an
+ * external workspace. The buffer only grows, so after the first few calls of a
+ * circuit no further device allocations (and their implicit device
+ * synchronizations) take place. All work using the arena must be ordered on the
+ * associated stream.
+ *
+ * @tparam DevTagT Device tag index type.
+ */
+template <class DevTagT = int> class WorkspaceArena {
+  public:
+    WorkspaceArena() = delete;
+    WorkspaceArena(const WorkspaceArena &other) = delete;
+    WorkspaceArena(WorkspaceArena &&other) = delete;
+    explicit WorkspaceArena(const DevTag<DevTagT> &dev_tag)
+        : dev_tag_{dev_tag} {}
+    ~WorkspaceArena() = default;
+
+    /**
+     * @brief Get a device pointer to at least `size_bytes` of scratch memory.
+     * The returned pointer remains valid until the next call requesting a
+     * larger size, or until `release` is called.
+     *
+     * @param size_bytes Required workspace size in bytes.
+     * @return void* Device pointer, or nullptr if `size_bytes` is 0.
+     */
+    auto acquire(std::size_t size_bytes) -> void * {
+        if (size_bytes == 0) {
+            return nullptr;
+        }
+        high_water_mark_ = std::max(high_water_mark_, size_bytes);
+        if (getCapacity() < size_bytes) {
+            // Free the old block first to keep a single workspace alive
+            buffer_.reset();
+            buffer_ = std::make_unique<DataBuffer<std::int8_t, DevTagT>>(
+                size_bytes, dev_tag_, true);
+            num_allocations_++;
+        }
+        return buffer_->getData();
+    }
+
+    /**
+     * @brief Free the device memory held by the arena. The high-water mark is
+     * kept.
+     */
+    void release() { buffer_.reset(); }
+
+    /**
+     * @brief Get the size in bytes of the currently held device block.
+     */
+    [[nodiscard]] auto getCapacity() const -> std::size_t {
+        return (buffer_) ? buffer_->getLength() : 0;
+    }
+
+    /**
+     * @brief Get the largest workspace size in bytes requested so far.
+     */
+    [[nodiscard]] auto getHighWaterMark() const -> std::size_t {
+        return high_water_mark_;
+    }
+
+    /**
+     * @brief Get the number of device allocations made by the arena.
+     */
+    [[nodiscard]] auto getNumAllocations() const -> std::size_t {
+        return num_allocations_;
+    }
+
+  private:
+    DevTag<DevTagT> dev_tag_;
+    std::unique_ptr<DataBuffer<std::int8_t, DevTagT>> buffer_{nullptr};
+    std::size_t high_water_mark_{0};
+    std::size_t num_allocations_{0};
+};
+
+} // namespace Pennylane::CUDA
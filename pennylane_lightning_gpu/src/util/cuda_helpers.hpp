@@ -3,8 +3,11 @@
 
 #pragma once
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <cuComplex.h>
@@ -13,7 +16,6 @@
 #include <cusparse_v2.h>
 #include <custatevec.h>
 
-#include "DevTag.hpp"
 #include "Error.hpp"
 #include "Util.hpp"
 
@@ -371,22 +373,154 @@ template <class CFP_t> inline static constexpr auto INVSQRT2() -> CFP_t {
 }
 
 /**
- * @brief cuBLAS backed inner product for GPU data.
+ * @brief Creation and destruction of library handles kept by
+ * `HandleRegistry`.
+ *
+ * @tparam HandleT Library handle type.
+ */
+template <class HandleT> struct HandleTraits;
+
+template <> struct HandleTraits<cublasHandle_t> {
+    static auto create(cudaStream_t stream_id) -> cublasHandle_t {
+        cublasHandle_t handle;
+        PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
+        PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
+        return handle;
+    }
+    static void destroy(cublasHandle_t handle) { cublasDestroy(handle); }
+};
+
+template <> struct HandleTraits<cusparseHandle_t> {
+    static auto create(cudaStream_t stream_id) -> cusparseHandle_t {
+        cusparseHandle_t handle;
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreate(&handle));
+        PL_CUSPARSE_IS_SUCCESS(cusparseSetStream(handle, stream_id));
+        return handle;
+    }
+    static void destroy(cusparseHandle_t handle) { cusparseDestroy(handle); }
+};
+
+/**
+ * @brief Process-wide registry of library handles, one per (device, stream)
+ * pair. Handles are created lazily on first use, bound to their stream, and
+ * reused by all later calls, avoiding a create/destroy round-trip for every
+ * library call. The handles are destroyed by `clear`, which is called at
+ * module teardown and on device reset.
+ *
+ * A handle must not be used concurrently from several host threads; work
+ * submitted to the same stream from different threads must be externally
+ * serialized, as it already is for the stream itself.
+ *
+ * @tparam HandleT Library handle type, `cublasHandle_t` or
+ * `cusparseHandle_t`.
+ */
+template <class HandleT> class HandleRegistry {
+  public:
+    HandleRegistry(const HandleRegistry &) = delete;
+    HandleRegistry(HandleRegistry &&) = delete;
+    HandleRegistry &operator=(const HandleRegistry &) = delete;
+    HandleRegistry &operator=(HandleRegistry &&) = delete;
+
+    /**
+     * @brief Get the process-wide registry.
+     */
+    static auto getInstance() -> HandleRegistry & {
+        static HandleRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Get the handle bound to the given device and stream, creating it
+     * on first use. The device is made current before the handle is created.
+     *
+     * @param dev_id Device index.
+     * @param stream_id Stream the handle submits work to.
+     * @return HandleT
+     */
+    auto getHandle(int dev_id, cudaStream_t stream_id) -> HandleT {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto key = std::make_pair(dev_id, stream_id);
+        if (auto it = handles_.find(key); it != handles_.end()) {
+            return it->second;
+        }
+        int current_dev_id = 0;
+        PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_dev_id));
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+        HandleT handle = HandleTraits<HandleT>::create(stream_id);
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(current_dev_id));
+        handles_.emplace(key, handle);
+        num_created_++;
+        return handle;
+    }
+
+    /**
+     * @brief Destroy all held handles. Later requests create new ones.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        destroyAll();
+    }
+
+    /**
+     * @brief Get the number of handles currently held.
+     */
+    [[nodiscard]] auto getNumHandles() -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return handles_.size();
+    }
+
+    /**
+     * @brief Get the number of handles created since the process started.
+     */
+    [[nodiscard]] auto getNumCreated() -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_created_;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::map<std::pair<int, cudaStream_t>, HandleT> handles_;
+    std::size_t num_created_{0};
+
+    HandleRegistry() = default;
+    // The CUDA runtime may already be shut down at process exit, so errors
+    // from destroying leftover handles are ignored.
+    ~HandleRegistry() { destroyAll(); }
+
+    void destroyAll() {
+        for (auto &[key, handle] : handles_) {
+            cudaSetDevice(key.first);
+            HandleTraits<HandleT>::destroy(handle);
+        }
+        handles_.clear();
+    }
+};
+
+using CublasHandleRegistry = HandleRegistry<cublasHandle_t>;
+using CusparseHandleRegistry = HandleRegistry<cusparseHandle_t>;
+
+/**
+ * @brief Release the handles of all registries.
+ */
+inline void clearHandleRegistries() {
+    CublasHandleRegistry::getInstance().clear();
+    CusparseHandleRegistry::getInstance().clear();
+}
+
+/**
+ * @brief cuBLAS backed inner product for GPU data, using the given handle.
  *
  * @tparam T Complex data-type. Accepts cuFloatComplex and cuDoubleComplex
+ * @param handle cuBLAS handle bound to the stream holding the data.
  * @param v1 Device data pointer 1
  * @param v2 Device data pointer 2
- * @param data_size Lengtyh of device data.
+ * @param data_size Length of device data.
  * @return T Inner-product result
  */
-template <class T = cuDoubleComplex, class DevTypeID = int>
-inline auto innerProdC_CUDA(const T *v1, const T *v2, const int data_size,
-                            int dev_id, cudaStream_t stream_id) -> T {
+template <class T = cuDoubleComplex>
+inline auto innerProdC_CUDA(cublasHandle_t handle, const T *v1, const T *v2,
+                            const int data_size) -> T {
     T result{0.0, 0.0}; // Host result
-    cublasHandle_t handle;
-    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
-    PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
-    PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
 
     if constexpr (std::is_same_v<T, cuFloatComplex>) {
         PL_CUBLAS_IS_SUCCESS(
@@ -395,30 +529,73 @@ inline auto innerProdC_CUDA(const T *v1, const T *v2, const int data_size,
         PL_CUBLAS_IS_SUCCESS(
             cublasZdotc(handle, data_size, v1, 1, v2, 1, &result));
     }
-    PL_CUBLAS_IS_SUCCESS(cublasDestroy(handle));
     return result;
 }
 
 /**
- * @brief cuBLAS backed GPU C/ZAXPY.
+ * @brief cuBLAS backed inner product for GPU data.
+ *
+ * @tparam T Complex data-type. Accepts cuFloatComplex and cuDoubleComplex
+ * @param v1 Device data pointer 1
+ * @param v2 Device data pointer 2
+ * @param data_size Lengtyh of device data.
+ * @return T Inner-product result
+ */
+template <class T = cuDoubleComplex, class DevTypeID = int>
+inline auto innerProdC_CUDA(const T *v1, const T *v2, const int data_size,
+                            int dev_id, cudaStream_t stream_id) -> T {
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+    return innerProdC_CUDA(
+        CublasHandleRegistry::getInstance().getHandle(dev_id, stream_id), v1,
+        v2, data_size);
+}
+
+/**
+ * @brief cuBLAS backed inner products of a vector with each column of a
+ * matrix, computed as a single conjugate-transposed C/ZGEMV. The results stay
+ * on the device, so no host synchronization is required.
+ *
+ * @tparam T Complex data-type. Accepts cuFloatComplex and cuDoubleComplex
+ * @param handle cuBLAS handle bound to the stream holding the data.
+ * @param mat Device pointer to the column-major matrix of `num_vectors`
+ * columns of length `data_size`.
+ * @param v Device data pointer of length `data_size`.
+ * @param result Device pointer receiving `num_vectors` values, with
+ * `result[j]` set to the inner product of column `j` and `v`.
+ * @param data_size Length of `v` and of each column.
+ * @param num_vectors Number of columns of `mat`.
+ */
+template <class T = cuDoubleComplex>
+inline void innerProdsC_CUDA(cublasHandle_t handle, const T *mat, const T *v,
+                             T *result, const int data_size,
+                             const int num_vectors) {
+    const T alpha{1.0, 0.0};
+    const T beta{0.0, 0.0};
+    if constexpr (std::is_same_v<T, cuFloatComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasCgemv(handle, CUBLAS_OP_C, data_size,
+                                         num_vectors, &alpha, mat, data_size,
+                                         v, 1, &beta, result, 1));
+    } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasZgemv(handle, CUBLAS_OP_C, data_size,
+                                         num_vectors, &alpha, mat, data_size,
+                                         v, 1, &beta, result, 1));
+    }
+}
+
+/**
+ * @brief cuBLAS backed GPU C/ZAXPY, using the given handle.
  *
  * @tparam CFP_t Complex data-type. Accepts std::complex<float> and
  * std::complex<double>
+ * @param handle cuBLAS handle bound to the stream holding the data.
  * @param a scaling factor
  * @param v1 Device data pointer 1 (data to be modified)
  * @param v2 Device data pointer 2 (the result data)
  * @param data_size Length of device data.
  */
-template <class CFP_t = std::complex<double>, class T = cuDoubleComplex,
-          class DevTypeID = int>
-inline auto scaleAndAddC_CUDA(const CFP_t a, const T *v1, T *v2,
-                              const int data_size, DevTypeID dev_id,
-                              cudaStream_t stream_id) {
-    cublasHandle_t handle;
-    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
-    PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
-    PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
-
+template <class CFP_t = std::complex<double>, class T = cuDoubleComplex>
+inline auto scaleAndAddC_CUDA(cublasHandle_t handle, const CFP_t a,
+                              const T *v1, T *v2, const int data_size) {
     if constexpr (std::is_same_v<T, cuComplex>) {
         const cuComplex alpha{a.real(), a.imag()};
         PL_CUBLAS_IS_SUCCESS(
@@ -428,7 +605,27 @@ inline auto scaleAndAddC_CUDA(const CFP_t a, const T *v1, T *v2,
         PL_CUBLAS_IS_SUCCESS(
             cublasZaxpy(handle, data_size, &alpha, v1, 1, v2, 1));
     }
-    PL_CUBLAS_IS_SUCCESS(cublasDestroy(handle));
+}
+
+/**
+ * @brief cuBLAS backed GPU C/ZAXPY.
+ *
+ * @tparam CFP_t Complex data-type. Accepts std::complex<float> and
+ * std::complex<double>
+ * @param a scaling factor
+ * @param v1 Device data pointer 1 (data to be modified)
+ * @param v2 Device data pointer 2 (the result data)
+ * @param data_size Length of device data.
+ */
+template <class CFP_t = std::complex<double>, class T = cuDoubleComplex,
+          class DevTypeID = int>
+inline auto scaleAndAddC_CUDA(const CFP_t a, const T *v1, T *v2,
+                              const int data_size, DevTypeID dev_id,
+                              cudaStream_t stream_id) {
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+    scaleAndAddC_CUDA(CublasHandleRegistry::getInstance().getHandle(
+                          static_cast<int>(dev_id), stream_id),
+                      a, v1, v2, data_size);
 }
 
 /**
@@ -444,11 +641,9 @@ template <class CFP_t = std::complex<double>, class T = cuDoubleComplex,
           class DevTypeID = int>
 inline auto scaleC_CUDA(const CFP_t a, T *v1, const int data_size,
                         DevTypeID dev_id, cudaStream_t stream_id) {
-
-    cublasHandle_t handle;
     PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
-    PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
-    PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
+    cublasHandle_t handle = CublasHandleRegistry::getInstance().getHandle(
+        static_cast<int>(dev_id), stream_id);
     cudaDataType_t data_type;
 
     if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
@@ -461,8 +656,6 @@ inline auto scaleC_CUDA(const CFP_t a, T *v1, const int data_size,
     PL_CUBLAS_IS_SUCCESS(cublasScalEx(handle, data_size,
                                       reinterpret_cast<const void *>(&a),
                                       data_type, v1, data_type, 1, data_type));
-
-    PL_CUBLAS_IS_SUCCESS(cublasDestroy(handle));
 }
 
 /**
@@ -521,7 +714,11 @@ inline int getGPUIdx() {
     return result;
 }
 
-inline static void deviceReset() { PL_CUDA_IS_SUCCESS(cudaDeviceReset()); }
+inline static void deviceReset() {
+    // Handles are invalidated by the reset, so release them beforehand
+    clearHandleRegistries();
+    PL_CUDA_IS_SUCCESS(cudaDeviceReset());
+}
 
 /**
  * @brief Checks to see if the given GPU supports the
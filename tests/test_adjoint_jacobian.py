@@ -22,7 +22,11 @@ import pennylane as qml
 from pennylane import numpy as np
 from pennylane import QNode, qnode
 from scipy.stats import unitary_group
-from pennylane_lightning_gpu.lightning_gpu_qubit_ops import DevPool
+from pennylane_lightning_gpu.lightning_gpu_qubit_ops import (
+    AdjointJacobianGPU_C128,
+    DevPool,
+    allocator_stats,
+)
 
 try:
     from pennylane_lightning_gpu.lightning_gpu import CPP_BINARY_AVAILABLE
@@ -810,6 +814,68 @@ def test_integration_custom_wires_batching(returns):
     assert np.allclose(j_gpu, j_lightning, atol=1e-7)
 
 
+@pytest.mark.parametrize("tile_size", [1, 2])
+def test_integration_memory_budget(tile_size):
+    """Integration tests that compare to lightning.qubit when the adjoint Jacobian processes the
+    observables in tiles fitting a device memory budget"""
+
+    # lambda and mu are held besides the tile, and the observables allocate no scratch states
+    sv_bytes = 16 * 2 ** len(custom_wires)
+    budget_bytes = (2 + tile_size) * sv_bytes
+    num_observables = len(custom_wires) + 1
+    assert (
+        AdjointJacobianGPU_C128.getObservableTileSize(
+            len(custom_wires), num_observables, budget_bytes
+        )
+        == tile_size
+    )
+
+    dev_lightning = qml.device("lightning.qubit", wires=custom_wires)
+    dev_gpu = qml.device("lightning.gpu", wires=custom_wires, adjoint_memory_bytes=budget_bytes)
+
+    def circuit(params):
+        circuit_ansatz(params, wires=custom_wires)
+        return [qml.expval(qml.PauliZ(w)) for w in custom_wires] + [
+            qml.expval(qml.PauliX(custom_wires[0]) @ qml.PauliY(custom_wires[3]))
+        ]
+
+    n_params = 30
+    np.random.seed(1337)
+    params = np.random.rand(n_params)
+
+    qnode_gpu = qml.QNode(circuit, dev_gpu, diff_method="adjoint")
+    qnode_lightning = qml.QNode(circuit, dev_lightning, diff_method="adjoint")
+
+    j_gpu = qml.jacobian(qnode_gpu)(params)
+    j_lightning = qml.jacobian(qnode_lightning)(params)
+
+    assert np.allclose(j_gpu, j_lightning, atol=1e-7)
+
+
+def test_integration_reuses_device_memory():
+    """Tests that repeated adjoint Jacobians are served from the device memory cached by the
+    allocator rather than new device allocations"""
+
+    dev_gpu = qml.device("lightning.gpu", wires=custom_wires)
+
+    def circuit(params):
+        circuit_ansatz(params, wires=custom_wires)
+        return [qml.expval(qml.PauliZ(w)) for w in custom_wires]
+
+    np.random.seed(1337)
+    params = np.random.rand(30)
+    qnode_gpu = qml.QNode(circuit, dev_gpu, diff_method="adjoint")
+
+    j_first = qml.jacobian(qnode_gpu)(params)
+    stats_first = allocator_stats()
+    j_second = qml.jacobian(qnode_gpu)(params)
+    stats_second = allocator_stats()
+
+    assert np.allclose(j_first, j_second)
+    assert stats_second["num_cache_hits"] > stats_first["num_cache_hits"]
+    assert stats_second["num_device_allocations"] == stats_first["num_device_allocations"]
+
+
 @pytest.mark.parametrize(
     "returns",
     [
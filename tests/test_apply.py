@@ -23,7 +23,11 @@ import pytest
 from pennylane import DeviceError
 
 try:
-    from pennylane_lightning_gpu.lightning_gpu import CPP_BINARY_AVAILABLE
+    from pennylane_lightning_gpu.lightning_gpu import (
+        CPP_BINARY_AVAILABLE,
+        CompiledCircuitGPU_C128,
+        PLException,
+    )
     import pennylane_lightning_gpu as plg
 
     if not CPP_BINARY_AVAILABLE:
@@ -474,6 +478,232 @@ class TestApply:
 
         assert np.allclose(state_vector, np.array(expected_output), atol=tol, rtol=0)
 
+    @pytest.mark.parametrize("gate_fusion", [1, 2, 3])
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_gate_fusion(self, tol, gate_fusion, c_dtype):
+        """Tests that fusing consecutive gates yields the same state as applying them one by one."""
+        ops = [
+            qml.Hadamard(wires=0),
+            qml.RX(0.3, wires=1),
+            qml.CNOT(wires=[0, 1]),
+            qml.RZ(0.5, wires=1),
+            qml.Rot(0.1, 0.2, 0.3, wires=2),
+            qml.QubitUnitary(U2, wires=[1, 2]),
+            qml.IsingXX(0.7, wires=[2, 0]),
+            qml.CRY(1.1, wires=[1, 2]),
+            qml.Toffoli(wires=[2, 1, 0]),
+            qml.SingleExcitation(0.6, wires=[2, 0]),
+        ]
+
+        dev_ref = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        dev_ref.apply(ops)
+
+        dev = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype, gate_fusion=gate_fusion)
+        dev.apply(ops)
+
+        assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_diagonal_folding(self, tol, c_dtype):
+        """Tests that runs of diagonal gates are folded without changing the resulting state."""
+        ops = [
+            qml.Hadamard(wires=0),
+            qml.Hadamard(wires=1),
+            qml.Hadamard(wires=2),
+            qml.IsingZZ(0.3, wires=[0, 1]),
+            qml.IsingZZ(0.5, wires=[1, 2]),
+            qml.MultiRZ(0.9, wires=[0, 1, 2]),
+            qml.CZ(wires=[2, 0]),
+            qml.CRZ(1.1, wires=[1, 2]),
+            qml.ControlledPhaseShift(0.4, wires=[2, 1]),
+            qml.PhaseShift(0.6, wires=0),
+            qml.S(wires=1),
+            qml.T(wires=2),
+            qml.RX(0.8, wires=0),
+            qml.RZ(1.3, wires=2),
+        ]
+
+        dev_ref = qml.device("default.qubit", wires=3)
+        dev_ref.apply(ops)
+
+        dev = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        dev.apply(ops)
+
+        assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_gate_cache_eviction(self, tol, c_dtype):
+        """Tests that parametric gates are evicted from a bounded gate cache without changing the
+        resulting state."""
+        angles = np.linspace(0.1, 0.8, 8)
+        ops = [qml.Hadamard(wires=0), qml.Hadamard(wires=2)]
+        ops += [qml.SingleExcitation(angle, wires=[0, 1]) for angle in angles]
+        ops += [qml.SingleExcitation(angles[-1], wires=[1, 2])]
+
+        dev_ref = qml.device("default.qubit", wires=3)
+        dev_ref.apply(ops)
+
+        dev = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype, gate_cache_bytes=512)
+        dev.apply(ops)
+
+        assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+        stats = dev.gate_cache_stats
+        assert stats["misses"] == len(angles)
+        assert stats["hits"] == 1
+        assert stats["evictions"] > 0
+        assert stats["capacity_bytes"] == 512
+
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_named_and_matrix_gates(self, tol, c_dtype):
+        """Tests that a circuit interleaving named gates, adjoints and gates applied as explicit
+        matrices is applied in order by a single native call."""
+        ops = [
+            qml.Hadamard(wires=0),
+            qml.adjoint(qml.S(wires=0)),
+            qml.RX(0.3, wires=1),
+            qml.QubitUnitary(qml.matrix(qml.RY(0.7, wires=2)), wires=2),
+            qml.CNOT(wires=[2, 0]),
+            qml.SX(wires=1),
+            qml.Rot(0.1, 0.2, 0.3, wires=2),
+            qml.ISWAP(wires=[0, 2]),
+            qml.IsingZZ(0.5, wires=[1, 2]),
+            qml.QubitUnitary(qml.matrix(qml.CRX(0.9, wires=[1, 0])), wires=[1, 0]),
+        ]
+
+        dev_ref = qml.device("default.qubit", wires=3)
+        dev_ref.apply(ops)
+
+        dev = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        dev.apply(ops)
+
+        assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+    def test_apply_tape_errors(self):
+        """Tests that invalid packed circuits are rejected before any gate is applied."""
+        dev = qml.device("lightning.gpu", wires=2)
+        opcodes = dev._gate_opcodes
+        state = dev._gpu_state
+        empty_matrix = np.empty(0, dtype=np.complex128)
+        invalid_opcode = np.array([opcodes["Matrix"] + 1], dtype=np.uint8)
+        rx_opcode = np.array([opcodes["RX"]], dtype=np.uint8)
+        offsets = np.array([0, 1], dtype=np.uintp)
+        inverses = np.array([False])
+
+        with pytest.raises(PLException, match="Invalid gate opcode"):
+            state.apply_tape(invalid_opcode, offsets, [0], [], inverses, empty_matrix)
+        with pytest.raises(PLException, match="Gate wire index out of range"):
+            state.apply_tape(rx_opcode, offsets, [2], [0.1], inverses, empty_matrix)
+        with pytest.raises(PLException, match="Insufficient number of gate parameters"):
+            state.apply_tape(rx_opcode, offsets, [0], [], inverses, empty_matrix)
+        with pytest.raises(PLException, match="Incompatible number of gate parameters"):
+            state.apply_tape(rx_opcode, offsets, [0], [0.1, 0.2], inverses, empty_matrix)
+
+        state_vector = np.zeros(4, dtype=np.complex128)
+        dev.syncD2H(state_vector)
+        assert np.allclose(state_vector, [1, 0, 0, 0])
+
+    @pytest.mark.parametrize("gate_fusion", [0, 2, 3])
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_compiled_circuit(self, tol, gate_fusion, c_dtype):
+        """Tests that a compiled circuit replayed with new parameters gives the same states as
+        applying the circuit directly, and that it is only compiled again once its structure
+        changes."""
+
+        def ops(x):
+            return [
+                qml.Hadamard(wires=0),
+                qml.RX(x, wires=1),
+                qml.CNOT(wires=[0, 1]),
+                qml.adjoint(qml.S(wires=2)),
+                qml.Rot(x, 0.2, -x, wires=2),
+                qml.QubitUnitary(U2, wires=[1, 2]),
+                qml.ISWAP(wires=[0, 2]),
+                qml.CRY(2 * x, wires=[1, 2]),
+                qml.Toffoli(wires=[2, 1, 0]),
+                qml.SingleExcitation(x, wires=[2, 0]),
+            ]
+
+        dev_ref = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        dev = qml.device(
+            "lightning.gpu",
+            wires=3,
+            c_dtype=c_dtype,
+            gate_fusion=gate_fusion,
+            compile_circuits=True,
+        )
+
+        for x in (0.3, 1.1, -0.7):
+            dev_ref.reset()
+            dev_ref.apply(ops(x))
+            dev.reset()
+            dev.apply(ops(x))
+            assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+            if x == 0.3:
+                circuit = dev._compiled_circuit[1]
+            assert dev._compiled_circuit[1] is circuit
+
+        assert circuit.getNumOps() == 10
+        assert circuit.getNumParams() == 6
+        if gate_fusion > 0:
+            assert circuit.getNumCompiledOps() < 10
+
+        dev.reset()
+        dev.apply(ops(0.3)[:-1])
+        assert dev._compiled_circuit[1] is not circuit
+
+    @pytest.mark.parametrize("gate_fusion", [0, 2])
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_apply_cuda_graph(self, tol, gate_fusion, c_dtype):
+        """Tests that replaying a compiled circuit as a CUDA graph with new parameters gives the
+        same states as applying the circuit directly"""
+
+        def ops(x):
+            return [
+                qml.Hadamard(wires=0),
+                qml.RX(x, wires=1),
+                qml.CNOT(wires=[0, 1]),
+                qml.adjoint(qml.S(wires=2)),
+                qml.Rot(x, 0.2, -x, wires=2),
+                qml.QubitUnitary(U2, wires=[1, 2]),
+                qml.ISWAP(wires=[0, 2]),
+                qml.adjoint(qml.CRY(2 * x, wires=[1, 2])),
+                qml.MultiRZ(-x, wires=[0, 1, 2]),
+                qml.SingleExcitation(x, wires=[2, 0]),
+            ]
+
+        dev_ref = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        dev = qml.device(
+            "lightning.gpu",
+            wires=3,
+            c_dtype=c_dtype,
+            gate_fusion=gate_fusion,
+            cuda_graph=True,
+        )
+
+        for x in (0.3, 1.1, -0.7):
+            dev_ref.reset()
+            dev_ref.apply(ops(x))
+            dev.reset()
+            dev.apply(ops(x))
+            assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+            if x == 0.3:
+                circuit = dev._compiled_circuit[1]
+            assert dev._compiled_circuit[1] is circuit
+
+    def test_compiled_circuit_errors(self):
+        """Tests that invalid circuit structures and parameters are rejected"""
+        dev = qml.device("lightning.gpu", wires=2)
+        empty_matrix = np.empty(0, dtype=np.complex128)
+        with pytest.raises(PLException, match="Gate wire index out of range"):
+            CompiledCircuitGPU_C128(2, ["RX"], [[2]], [False], [empty_matrix])
+        with pytest.raises(PLException, match="Currently unsupported gate"):
+            CompiledCircuitGPU_C128(2, ["QFT"], [[0, 1]], [False], [empty_matrix])
+
+        circuit = CompiledCircuitGPU_C128(2, ["RX", "CNOT"], [[0], [0, 1]], [False, False], [])
+        with pytest.raises(PLException, match="Incompatible number of tape parameters"):
+            circuit.execute(dev._gpu_state, np.array([0.1, 0.2]))
+
     def test_apply_errors_qubit_state_vector(self, qubit_device_2_wires):
         """Test that apply fails for incorrect state preparation, and > 2 qubit gates"""
         with pytest.raises(ValueError, match="Sum of amplitudes-squared does not equal one."):
@@ -1252,6 +1482,65 @@ class TestApplyCQMethod:
         assert np.allclose(state_vector, starting_state, atol=tol, rtol=0)
 
 
+class TestTransferModes:
+    """Tests for the host-device transfer modes of syncH2D and syncD2H."""
+
+    @pytest.mark.parametrize("C", [np.complex64, np.complex128])
+    @pytest.mark.parametrize("mode", ["auto", "direct", "staged", "registered"])
+    def test_round_trip(self, C, mode):
+        """Test that the state vector survives a round trip in each mode, for a
+        state larger than a staging chunk."""
+        num_wires = 20
+        dev = qml.device("lightning.gpu", wires=num_wires, c_dtype=C)
+
+        rng = np.random.default_rng(42)
+        state_in = rng.random(2**num_wires) + 1j * rng.random(2**num_wires)
+        state_in = (state_in / np.linalg.norm(state_in)).astype(C)
+        dev.syncH2D(state_in, transfer_mode=mode)
+
+        state_out = np.zeros(2**num_wires, dtype=C)
+        dev.syncD2H(state_out, transfer_mode=mode)
+        assert np.array_equal(state_out, state_in)
+
+    def test_unknown_mode(self):
+        """Test that an unknown transfer mode raises an error."""
+        dev = qml.device("lightning.gpu", wires=2)
+        state_vector = np.zeros(4, dtype=np.complex128)
+        with pytest.raises(PLException, match="Unknown transfer mode"):
+            dev.syncD2H(state_vector, transfer_mode="pinned")
+
+
+class TestSynchronize:
+    """Tests for the stream-ordered execution of the device."""
+
+    @pytest.mark.parametrize("C", [np.complex64, np.complex128])
+    def test_synchronize(self, C, tol):
+        """Test that the device is idle after synchronizing, and that host matrices uploaded
+        mid-circuit are applied in order with the other gates."""
+        num_wires = 12
+        ops = (
+            [qml.BasisState(np.array([1, 0] * (num_wires // 2)), wires=range(num_wires))]
+            + [qml.QubitUnitary(U2, wires=[i, i + 1]) for i in range(num_wires - 1)]
+            + [qml.Hadamard(wires=i) for i in range(num_wires)]
+        )
+        dev = qml.device("lightning.gpu", wires=num_wires, c_dtype=C)
+        dev.apply(ops)
+        dev.synchronize()
+        assert dev.query()
+
+        dev_ref = qml.device("default.qubit", wires=num_wires)
+        dev_ref.apply(ops)
+        assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+    def test_query_reset(self):
+        """Test that a reset device reports its work as done once synchronized."""
+        dev = qml.device("lightning.gpu", wires=3)
+        dev.reset()
+        dev.synchronize()
+        assert dev.query()
+        assert np.allclose(dev.state, np.eye(8)[0])
+
+
 # Tolerance for non-analytic tests
 TOL_STOCHASTIC = 0.05
 
@@ -0,0 +1,133 @@
+# Copyright 2018-2022 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the exchange of the device state of :mod:`pennylane_lightning_gpu.LightningGPU`
+with other GPU array libraries, through DLPack and ``__cuda_array_interface__``.
+"""
+import gc
+
+import pytest
+
+import numpy as np
+import pennylane as qml
+
+try:
+    from pennylane_lightning_gpu.lightning_gpu import CPP_BINARY_AVAILABLE, PLException
+
+    if not CPP_BINARY_AVAILABLE:
+        raise ImportError("PennyLane-Lightning-GPU is unsupported on this platform")
+except (ImportError, ModuleNotFoundError):
+    pytest.skip(
+        "PennyLane-Lightning-GPU is unsupported on this platform. Skipping.",
+        allow_module_level=True,
+    )
+
+ops = [qml.Hadamard(wires=0), qml.CNOT(wires=[0, 1]), qml.RY(0.4, wires=2)]
+
+
+@pytest.mark.parametrize("C, typestr", [(np.complex64, "<c8"), (np.complex128, "<c16")])
+def test_cuda_array_interface(C, typestr):
+    """Test that the state vector describes its device buffer."""
+    dev = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    interface = dev.gpu_state.__cuda_array_interface__
+
+    assert interface["shape"] == (8,)
+    assert interface["typestr"] == typestr
+    assert interface["strides"] is None
+    assert interface["version"] == 3
+    assert interface["data"][0] != 0
+    assert interface["data"][1] is False
+    assert interface["stream"] != 0
+
+
+def test_dlpack_device():
+    """Test that the state vector reports the CUDA device holding it."""
+    dev = qml.device("lightning.gpu", wires=2)
+    device_type, device_id = dev.gpu_state.__dlpack_device__()
+    assert device_type == 2
+    assert device_id == dev.gpu_state.getCurrentGPU()
+
+
+@pytest.mark.parametrize("C", [np.complex64, np.complex128])
+def test_cupy_views(C, tol):
+    """Test that CuPy views alias the device state, through both protocols."""
+    cp = pytest.importorskip("cupy")
+    dev = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    dev.apply(ops)
+
+    for view in (cp.asarray(dev.gpu_state), cp.from_dlpack(dev.gpu_state)):
+        assert view.dtype == C
+        assert np.allclose(cp.asnumpy(view), dev.state, atol=tol, rtol=0)
+
+    # Views see the later operations, without a copy
+    view = cp.from_dlpack(dev.gpu_state)
+    dev.apply([qml.PauliX(wires=2)])
+    assert np.allclose(cp.asnumpy(view), dev.state, atol=tol, rtol=0)
+
+
+def test_dlpack_view_keeps_state_alive(tol):
+    """Test that a DLPack view outlives the device it was created from."""
+    cp = pytest.importorskip("cupy")
+    dev = qml.device("lightning.gpu", wires=3)
+    dev.apply(ops)
+    expected = dev.state
+
+    view = cp.from_dlpack(dev.gpu_state)
+    del dev
+    gc.collect()
+    assert np.allclose(cp.asnumpy(view), expected, atol=tol, rtol=0)
+
+
+@pytest.mark.parametrize("C", [np.complex64, np.complex128])
+def test_torch_view(C, tol):
+    """Test that PyTorch imports the device state through DLPack."""
+    torch = pytest.importorskip("torch")
+    if not torch.cuda.is_available():
+        pytest.skip("PyTorch was built without CUDA support")
+    dev = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    dev.apply(ops)
+
+    view = torch.from_dlpack(dev.gpu_state)
+    assert view.is_cuda
+    assert np.allclose(view.cpu().numpy(), dev.state, atol=tol, rtol=0)
+
+
+@pytest.mark.parametrize("C", [np.complex64, np.complex128])
+def test_sync_device_to_device(C, tol):
+    """Test that a CuPy array is copied into the state vector on the device."""
+    cp = pytest.importorskip("cupy")
+    dev_ref = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    dev_ref.apply(ops)
+
+    dev = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    dev.syncD2D(cp.asarray(dev_ref.state))
+    assert np.allclose(dev.state, dev_ref.state, atol=tol, rtol=0)
+
+    # Round trip through an exported view
+    dev_copy = qml.device("lightning.gpu", wires=3, c_dtype=C)
+    dev_copy.syncD2D(cp.asarray(dev.gpu_state))
+    assert np.allclose(dev_copy.state, dev_ref.state, atol=tol, rtol=0)
+
+
+def test_sync_device_to_device_errors():
+    """Test that incompatible device arrays are rejected."""
+    cp = pytest.importorskip("cupy")
+    dev = qml.device("lightning.gpu", wires=2)
+
+    with pytest.raises(PLException, match="does not match the precision"):
+        dev.syncD2D(cp.zeros(4, dtype=cp.complex64))
+    with pytest.raises(PLException, match="does not match the size"):
+        dev.syncD2D(cp.zeros(8, dtype=cp.complex128))
+    with pytest.raises(PLException, match="must be contiguous"):
+        dev.syncD2D(cp.zeros(8, dtype=cp.complex128)[::2])
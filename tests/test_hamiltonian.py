@@ -92,3 +92,44 @@ class TestHamiltonianExpval:
         expected = 1
 
         assert np.allclose(res, expected)
+
+
+class TestPauliGrouping:
+    """Tests for the grouped evaluation of Hamiltonians on more than 13 wires."""
+
+    num_wires = 14
+
+    def _hamiltonian(self):
+        rng = np.random.default_rng(42)
+        paulis = [qml.Identity, qml.PauliX, qml.PauliY, qml.PauliZ]
+        coeffs, ops = [], []
+        for _ in range(60):
+            wires = rng.choice(self.num_wires, size=rng.integers(1, 5), replace=False)
+            factors = [paulis[rng.integers(4)](int(w)) for w in wires]
+            ops.append(qml.operation.Tensor(*factors) if len(factors) > 1 else factors[0])
+            coeffs.append(rng.normal())
+        return qml.Hamiltonian(coeffs, ops)
+
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_grouped_matches_per_word(self, c_dtype):
+        """Test that grouping the Pauli words gives the per-word expectation value"""
+        ham = self._hamiltonian()
+        results = []
+        for pauli_grouping in (True, False):
+            dev = LightningGPU(
+                wires=self.num_wires, c_dtype=c_dtype, pauli_grouping=pauli_grouping
+            )
+
+            @qml.qnode(dev)
+            def circuit():
+                for w in range(self.num_wires):
+                    qml.RX(0.1 * (w + 1), wires=w)
+                    qml.RY(-0.05 * w, wires=w)
+                for w in range(self.num_wires - 1):
+                    qml.CNOT(wires=[w, w + 1])
+                return qml.expval(ham)
+
+            results.append(circuit())
+
+        atol = 1e-4 if c_dtype == np.complex64 else 1e-8
+        assert np.allclose(results[0], results[1], atol=atol, rtol=0)
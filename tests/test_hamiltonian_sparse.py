@@ -66,6 +66,40 @@ class TestHamiltonianExpval:
 
         assert np.allclose(res, expected)
 
+    def test_hamiltonian_variance_reuses_device_matrix(self, qubit_device_3_wires, tol):
+        """Test var(H) of a sparse Hamiltonian, and that repeated measurements reuse the native
+        observable holding the device copy of the matrix"""
+
+        dev = qubit_device_3_wires
+        obs = qml.Identity(0) @ qml.PauliX(1) @ qml.PauliY(2)
+        H = qml.Hamiltonian([1.0, 1.0], [qml.Identity(1), obs])
+
+        state_vector = np.array(
+            [
+                0.0 + 0.0j,
+                0.0 + 0.1j,
+                0.1 + 0.1j,
+                0.1 + 0.2j,
+                0.2 + 0.2j,
+                0.3 + 0.3j,
+                0.3 + 0.4j,
+                0.4 + 0.5j,
+            ],
+            dtype=np.complex64,
+        )
+
+        dev.syncH2D(state_vector)
+        Hmat = qml.utils.sparse_hamiltonian(H)
+        H_sparse = qml.SparseHamiltonian(Hmat, wires=range(3))
+
+        assert np.allclose(dev.expval(H_sparse), 1, atol=tol)
+        native_obs = dev._sparse_ham_cache[1]
+
+        # H = I + P with P^2 = I, hence <H^2> = 2<H>
+        assert np.allclose(dev.var(H_sparse), 1, atol=tol)
+        assert np.allclose(dev.expval(H_sparse), 1, atol=tol)
+        assert dev._sparse_ham_cache[1] is native_obs
+
 
 class TestSparseExpval:
     """Tests for the expval function"""
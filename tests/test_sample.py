@@ -88,3 +88,117 @@ class TestSample:
         # s1 should only contain 1 and -1, which is guaranteed if
         # they square to 1
         assert np.allclose(s1**2, 1, atol=tol, rtol=0)
+
+
+class TestPackedSamples:
+    """Tests for the packed samples and the counts computed from them."""
+
+    @pytest.fixture(params=[np.complex64, np.complex128])
+    def dev(self, request):
+        return qml.device("lightning.gpu", wires=3, shots=1000, c_dtype=request.param)
+
+    def test_packed_samples(self, dev):
+        """Tests that packed samples are sorted basis-state indices matching the
+        binary representation of the samples"""
+        dev.apply([qml.Hadamard(wires=0), qml.CNOT(wires=[0, 1]), qml.RX(0.7, wires=2)])
+        dev._samples = dev.generate_samples()
+        packed = dev._current_packed_samples()
+
+        assert packed.shape == (dev.shots,)
+        assert np.all(np.diff(packed) >= 0)
+        assert np.array_equal(dev._samples @ np.array([4, 2, 1]), packed)
+
+    def test_generate_counts(self, dev):
+        """Tests that the counts drawn on the device are distinct, sorted and sum to the
+        number of shots"""
+        dev.apply([qml.PauliX(wires=0), qml.Hadamard(wires=2)])
+        outcomes, frequencies = dev._gpu_state.GenerateCounts(dev.shots)
+
+        assert np.all(np.diff(outcomes) > 0)
+        assert set(outcomes) <= {4, 5}
+        assert frequencies.sum() == dev.shots
+
+    def test_estimate_probability(self, dev):
+        """Tests that probabilities estimated from the packed samples match those of the
+        binary representation"""
+        dev.apply([qml.Hadamard(wires=0), qml.CNOT(wires=[0, 1]), qml.RX(0.7, wires=2)])
+        dev._samples = dev.generate_samples()
+
+        for wires in ([0], [2, 0], [1, 2, 0]):
+            indices = dev._samples[:, wires] @ (2 ** np.arange(len(wires) - 1, -1, -1))
+            expected = np.bincount(indices, minlength=2 ** len(wires)) / dev.shots
+            assert np.allclose(dev.estimate_probability(wires=wires), expected)
+            assert np.allclose(
+                dev.estimate_probability(wires=wires, shot_range=(10, 510)),
+                np.bincount(indices[10:510], minlength=2 ** len(wires)) / 500,
+            )
+
+    def test_estimate_probability_empty_shot_range(self, dev):
+        """Tests that estimating probabilities from a shot range without samples raises a
+        ValueError"""
+        dev.apply([qml.Hadamard(wires=0)])
+        dev._samples = dev.generate_samples()
+
+        with pytest.raises(ValueError, match="selects no samples"):
+            dev.estimate_probability(wires=[0], shot_range=(10, 10))
+
+    def test_counts(self):
+        """Tests the counts of bitstrings and of observables"""
+        dev = qml.device("lightning.gpu", wires=3, shots=1000)
+
+        @qml.qnode(dev)
+        def circuit():
+            qml.PauliX(wires=0)
+            qml.Hadamard(wires=2)
+            return qml.counts(wires=[0, 1]), qml.counts(qml.PauliZ(2))
+
+        bitstrings, eigvals = circuit()
+        assert bitstrings == {"10": 1000}
+        assert set(eigvals) <= {-1, 1}
+        assert sum(eigvals.values()) == 1000
+
+    def test_counts_diagonalized(self):
+        """Tests the counts of an observable measured in a rotated basis"""
+        dev = qml.device("lightning.gpu", wires=2, shots=1000)
+
+        @qml.qnode(dev)
+        def circuit():
+            qml.Hadamard(wires=0)
+            qml.PauliX(wires=1)
+            return qml.counts(qml.PauliX(0) @ qml.PauliZ(1))
+
+        assert circuit() == {-1.0: 1000}
+
+
+class TestSeededSampler:
+    """Tests for the seeded and reusable sampler of the device."""
+
+    def test_seed_reproduces_samples(self):
+        """Tests that devices with the same seed draw the same samples"""
+
+        def circuit():
+            qml.Hadamard(wires=0)
+            qml.RX(0.7, wires=1)
+            qml.CNOT(wires=[0, 2])
+            return qml.sample()
+
+        results = [
+            qml.QNode(circuit, qml.device("lightning.gpu", wires=3, shots=100, seed=seed))()
+            for seed in (7, 7, 8)
+        ]
+        assert np.array_equal(results[0], results[1])
+        assert not np.array_equal(results[0], results[2])
+
+    def test_sampler_reuse(self):
+        """Tests that the sampler is only preprocessed again once the state changes"""
+        dev = qml.device("lightning.gpu", wires=3, shots=100)
+        dev.apply([qml.Hadamard(wires=0), qml.CNOT(wires=[0, 2])])
+
+        dev._samples = dev.generate_samples()
+        dev._gpu_state.GenerateCounts(dev.shots)
+        dev._gpu_state.GenerateSamplesPacked(dev.shots)
+        assert dev._gpu_state.getNumSamplerPreprocesses() == 1
+
+        dev.apply([qml.PauliX(wires=1)])
+        dev._samples = dev.generate_samples()
+        assert dev._gpu_state.getNumSamplerPreprocesses() == 2
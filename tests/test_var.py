@@ -121,3 +121,44 @@ class TestTensorVar:
         ) / 4
 
         assert np.allclose(res, expected, tol)
+
+
+class TestVarObservables:
+    """Tests the variance of each kind of observable against default.qubit"""
+
+    H = np.array(
+        [
+            [0.5, 0.2 + 0.5j, 0.1 - 0.3j, 0.3],
+            [0.2 - 0.5j, -1.0, 0.4j, 0.6 + 0.1j],
+            [0.1 + 0.3j, -0.4j, 0.7, 0.2 - 0.2j],
+            [0.3, 0.6 - 0.1j, 0.2 + 0.2j, 0.1],
+        ]
+    )
+
+    @pytest.mark.parametrize(
+        "obs",
+        [
+            qml.PauliY(1),
+            qml.PauliX(0) @ qml.PauliZ(2),
+            qml.Hadamard(1),
+            qml.Hermitian(np.diag([0.5, -1.5, 2.0, 0.25]), wires=[2, 0]),
+            qml.Hermitian(H, wires=[1, 0]),
+            qml.PauliZ(0) @ qml.Hermitian(H, wires=[1, 2]),
+        ],
+    )
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_var_matches_default_qubit(self, obs, c_dtype):
+        """Test the variance of Pauli words, diagonal and dense observables"""
+
+        def circuit():
+            qml.RX(0.4, wires=0)
+            qml.RY(-0.7, wires=1)
+            qml.RX(1.1, wires=2)
+            qml.CNOT(wires=[0, 1])
+            qml.CRY(0.3, wires=[1, 2])
+            return qml.var(obs)
+
+        res = qml.QNode(circuit, qml.device("lightning.gpu", wires=3, c_dtype=c_dtype))()
+        expected = qml.QNode(circuit, qml.device("default.qubit", wires=3))()
+        atol = 1e-5 if c_dtype == np.complex64 else 1e-8
+        assert np.allclose(res, expected, atol=atol, rtol=0)
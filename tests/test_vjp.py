@@ -70,3 +70,31 @@ class TestVectorJacobianProduct:
         vjp2 = dev.adjoint_jacobian(tape2, use_device_state=True)
 
         assert np.allclose(vjp1, vjp2.ravel(order="C"), atol=tol, rtol=0)
+
+    def test_hamiltonian_and_observables(self, tol, dev):
+        """Tests that the vjp of a tape mixing Hamiltonian and single observable measurements
+        contracts the Jacobian with dy."""
+        x, y, z = [0.5, 0.3, -0.7]
+
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=[0])
+            qml.Rot(x, y, z, wires=[1])
+            qml.CNOT(wires=[1, 2])
+            qml.RY(-0.2, wires=[2])
+            qml.expval(qml.PauliX(0))
+            qml.expval(
+                qml.Hamiltonian([0.3, -1.2], [qml.PauliZ(0) @ qml.PauliY(1), qml.PauliX(2)])
+            )
+            qml.expval(qml.PauliZ(1))
+            qml.expval(qml.PauliY(2))
+
+        tape.trainable_params = {0, 1, 2, 3, 4}
+        dy = np.array([1.0, -0.5, 2.0, 0.25])
+
+        dev.execute(tape)
+        vjp = dev.vjp(tape.measurements, dy, use_device_state=True)(tape)
+
+        dev.execute(tape)
+        jac = dev.adjoint_jacobian(tape, use_device_state=True)
+
+        assert np.allclose(vjp, dy @ jac, atol=tol, rtol=0)
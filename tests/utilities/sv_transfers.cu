@@ -1,39 +1,136 @@
+#include <algorithm>
+#include <chrono>
 #include <complex>
 #include <cstddef>
+#include <cstdlib>
 #include <cuComplex.h>
 #include <cuda.h>
+#include <iomanip>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "TransferEngine.hpp"
+
+using Pennylane::CUDA::TransferEngine;
+using Pennylane::CUDA::TransferMode;
+
 /**
- * @brief Simple utility to transfer data from device to host or vice-versa.
+ * @brief Utility comparing the ways of transferring the statevector data
+ * between the host and the device: direct copies from pageable memory,
+ * chunks staged through pinned bounce buffers, copies from a page-locked
+ * (registered) host buffer, and direct copies from memory allocated pinned.
  * Adapted from
  * https://www.microway.com/hpc-tech-tips/cuda-host-to-device-transfers-and-data-movement/
- *
- * @param num_qubits
  */
 
+namespace {
+/**
+ * @brief Time a callable, returning the mean duration of a call in seconds.
+ */
+template <class Func> double timeCalls(Func &&func, std::size_t repeats) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < repeats; i++) {
+        func();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(repeats);
+}
+
+void report(const std::string &name, std::size_t data_size, double h2d,
+            double d2h, bool valid) {
+    const double gigabytes = static_cast<double>(data_size) / 1e9;
+    std::cout << std::left << std::setw(12) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(10)
+              << gigabytes / h2d << std::setw(10) << gigabytes / d2h
+              << ((valid) ? "" : "  MISMATCH") << std::endl;
+}
+} // namespace
+
 template <typename DataType = cuDoubleComplex>
-void transferTimings(std::size_t num_qubits) {
-    const std::size_t num_elements = (0b1 << num_qubits);
+void transferTimings(std::size_t num_qubits, std::size_t repeats) {
+    const std::size_t num_elements = std::size_t{1} << num_qubits;
     const std::size_t data_size = num_elements * sizeof(DataType);
 
-    std::vector<DataType> data_host(num_elements, {0, 0});
+    std::vector<DataType> data_host(num_elements);
+    for (std::size_t i = 0; i < num_elements; i++) {
+        data_host[i] = {static_cast<double>(i % 1024), 0.0};
+    }
+    std::vector<DataType> data_out(num_elements);
     DataType *data_device;
     cudaMalloc((void **)&data_device, data_size);
 
-    cudaMemcpy(data_device, data_host.data(), data_size,
-               cudaMemcpyHostToDevice);
-    cudaMemcpy(data_host.data(), data_device, data_size,
-               cudaMemcpyDeviceToHost);
+    auto check = [&](const DataType *out) {
+        for (std::size_t i = 0; i < num_elements; i += 4097) {
+            if (out[i].x != data_host[i].x) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::cout << std::left << std::setw(12) << "mode" << std::right
+              << std::setw(10) << "H2D GB/s" << std::setw(10) << "D2H GB/s"
+              << std::endl;
+
+    auto &engine = TransferEngine::getInstance(0);
+    for (const auto &entry :
+         {std::pair{"direct", TransferMode::Direct},
+          std::pair{"staged", TransferMode::Staged},
+          std::pair{"registered", TransferMode::Registered}}) {
+        const TransferMode mode = entry.second;
+        std::fill(data_out.begin(), data_out.end(), DataType{0, 0});
+        const double h2d = timeCalls(
+            [&] {
+                engine.copyHostToDevice(data_device, data_host.data(),
+                                        data_size, 0, mode);
+            },
+            repeats);
+        const double d2h = timeCalls(
+            [&] {
+                engine.copyDeviceToHost(data_out.data(), data_device,
+                                        data_size, 0, mode);
+            },
+            repeats);
+        report(entry.first, data_size, h2d, d2h, check(data_out.data()));
+    }
+
+    // Upper bound: host memory allocated pinned from the start
+    DataType *data_pinned;
+    cudaMallocHost((void **)&data_pinned, data_size);
+    std::copy(data_host.begin(), data_host.end(), data_pinned);
+    const double h2d = timeCalls(
+        [&] {
+            cudaMemcpy(data_device, data_pinned, data_size,
+                       cudaMemcpyHostToDevice);
+        },
+        repeats);
+    std::fill(data_pinned, data_pinned + num_elements, DataType{0, 0});
+    const double d2h = timeCalls(
+        [&] {
+            cudaMemcpy(data_pinned, data_device, data_size,
+                       cudaMemcpyDeviceToHost);
+        },
+        repeats);
+    report("pinned", data_size, h2d, d2h, check(data_pinned));
 
+    cudaFreeHost(data_pinned);
     cudaFree(data_device);
+    TransferEngine::releaseAll();
 }
 
 int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <num_qubits> [repeats]"
+                  << std::endl;
+        return 1;
+    }
     std::size_t num_qubits = std::atoi(argv[1]);
-    auto b = (0b1 << num_qubits);
+    std::size_t repeats = (argc > 2) ? std::atoi(argv[2]) : 5;
+    auto b = (std::size_t{1} << num_qubits) * sizeof(cuDoubleComplex);
     std::cout << "Using " << num_qubits << " qubits totaling " << b << " bytes."
               << std::endl;
-    transferTimings<cuDoubleComplex>(num_qubits);
+    transferTimings<cuDoubleComplex>(num_qubits, repeats);
 }